@@ -0,0 +1 @@
+SELECT @x FROM t;
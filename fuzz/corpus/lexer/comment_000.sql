@@ -0,0 +1,2 @@
+-- line comment
+SELECT 1;
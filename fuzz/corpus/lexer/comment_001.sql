@@ -0,0 +1 @@
+SELECT 1; -- trailing
\ No newline at end of file
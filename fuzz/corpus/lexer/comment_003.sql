@@ -0,0 +1 @@
+/* block */ SELECT 1;
\ No newline at end of file
@@ -0,0 +1 @@
+SELECT /* inline */ 1;
@@ -0,0 +1,4 @@
+/* multi
+line
+comment */
+SELECT 1;
\ No newline at end of file
@@ -0,0 +1 @@
+/* nested /* not */ SELECT 1 */
\ No newline at end of file
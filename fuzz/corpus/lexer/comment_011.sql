@@ -0,0 +1,3 @@
+SELECT 1 /* unterminated
+over
+lines
\ No newline at end of file
@@ -0,0 +1,2 @@
+-- comment with 'quote
+SELECT 'x';
\ No newline at end of file
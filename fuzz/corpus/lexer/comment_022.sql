@@ -0,0 +1 @@
+/* comment with 'quote */ SELECT 'x';
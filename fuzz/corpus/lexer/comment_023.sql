@@ -0,0 +1 @@
+SELECT 2 - -3;
\ No newline at end of file
@@ -0,0 +1 @@
+outeR fROM HaVinG deLETE cReaTE UnIQuE tabLe by blOb ForEiGn OUTER_x FROM_x HAVING_x
@@ -0,0 +1 @@
+InDeX NULl oUter on OrdeR teXT KEy ofFSet creAte drOP INDEX_x NULL_x OUTER_x
@@ -0,0 +1 @@
+fOreign real daTE deletE Offset iNdeX HaViNG INt nuLL TexT FOREIGN_x REAL_x DATE_x
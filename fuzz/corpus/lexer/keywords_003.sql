@@ -0,0 +1 @@
+ValUeS NoT havinG Or As REfeReNcEs KEy OrdEr InSERt InDeX VALUES_x NOT_x HAVING_x
@@ -0,0 +1 @@
+daTe taBle REfERENces eNgiNE dESC vAluES AND iNSERt JoIN INt DATE_x TABLE_x REFERENCES_x
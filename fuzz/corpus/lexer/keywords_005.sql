@@ -0,0 +1 @@
+Index VALues lImIt EnGIne asc anAlYzE hAvIng DaTE OUTeR CreaTe INDEX_x VALUES_x LIMIT_x
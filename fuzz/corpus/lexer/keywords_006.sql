@@ -0,0 +1 @@
+CreATe lEft inserT bLob droP JoiN rEal Or AS TeXT CREATE_x LEFT_x INSERT_x
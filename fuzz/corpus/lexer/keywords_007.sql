@@ -0,0 +1 @@
+blOB Engine haVINg Order dElEte timestAMP SELecT cREaTE JOIn DESC BLOB_x ENGINE_x HAVING_x
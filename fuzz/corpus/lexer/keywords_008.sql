@@ -0,0 +1 @@
+as inT date OR dROp INsErT uPdAte EnGiNE By taBle AS_x INT_x DATE_x
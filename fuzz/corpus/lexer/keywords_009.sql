@@ -0,0 +1 @@
+key riGHT rEFerEncES timeStaMP oFfset reaL teXt anAlYZE inDEx ValUEs KEY_x RIGHT_x REFERENCES_x
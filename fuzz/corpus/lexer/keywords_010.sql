@@ -0,0 +1 @@
+InSeRT blob HAvinG iNdEX TimEsTamP anD drOp DelEtE aSC LImIt INSERT_x BLOB_x HAVING_x
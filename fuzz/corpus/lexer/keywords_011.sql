@@ -0,0 +1 @@
+daTE LImit DESC INnEr InSErt eNGinE UpdAte aS PRimaRY key DATE_x LIMIT_x DESC_x
@@ -0,0 +1 @@
+SELECT id FROM t
\ No newline at end of file
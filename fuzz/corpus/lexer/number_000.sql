@@ -0,0 +1 @@
+SELECT 0 FROM t WHERE x = 0;
@@ -0,0 +1 @@
+SELECT 7 FROM t WHERE x = 7;
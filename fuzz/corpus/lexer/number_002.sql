@@ -0,0 +1 @@
+SELECT 42 FROM t WHERE x = 42;
@@ -0,0 +1 @@
+SELECT 3.14 FROM t WHERE x = 3.14;
@@ -0,0 +1 @@
+SELECT 0.5 FROM t WHERE x = 0.5;
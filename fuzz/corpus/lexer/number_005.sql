@@ -0,0 +1 @@
+SELECT 10. FROM t WHERE x = 10.;
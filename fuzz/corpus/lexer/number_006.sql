@@ -0,0 +1 @@
+SELECT 1.2.3 FROM t WHERE x = 1.2.3;
@@ -0,0 +1 @@
+SELECT 00012 FROM t WHERE x = 00012;
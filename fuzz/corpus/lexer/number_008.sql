@@ -0,0 +1 @@
+SELECT 1e5 FROM t WHERE x = 1e5;
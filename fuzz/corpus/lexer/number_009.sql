@@ -0,0 +1 @@
+SELECT 999999999999999999999999999999 FROM t WHERE x = 999999999999999999999999999999;
@@ -0,0 +1 @@
+SELECT 12345678901234567890.0987654321 FROM t WHERE x = 12345678901234567890.0987654321;
@@ -0,0 +1 @@
+SELECT .5 FROM t WHERE x = .5;
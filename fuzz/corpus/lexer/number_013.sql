@@ -0,0 +1 @@
+SELECT 5.a FROM t WHERE x = 5.a;
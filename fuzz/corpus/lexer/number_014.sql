@@ -0,0 +1 @@
+SELECT 1..2 FROM t WHERE x = 1..2;
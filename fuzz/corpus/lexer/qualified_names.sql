@@ -0,0 +1 @@
+SELECT s.t.c, t.*, 1.5.x FROM s.t;
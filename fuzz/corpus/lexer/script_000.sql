@@ -0,0 +1,39 @@
+SELECT qty, total, price FROM products WHERE 338.052 ORDER BY total LIMIT 26;
+SELECT created_at, name, x FROM Customer WHERE (465.114) ORDER BY name LIMIT 80;
+DELETE FROM t WHERE 508614;
+DELETE FROM users WHERE 435562;
+DELETE FROM line_items WHERE 'y_2' + 'email' * name < email + 446.347 >= id <> 842361;
+SELECT email, y_2, price FROM t WHERE (email + 'created_at' OR (9128)) ORDER BY qty LIMIT 42;
+UPDATE line_items SET email = (649.546) * name <> 'total' <= 773.874 % 391088 != 153.322 WHERE created_at;
+DELETE FROM users WHERE 819.103;
+SELECT qty, name, id FROM products WHERE 975357 ORDER BY x LIMIT 78;
+UPDATE Customer SET id = 228217 WHERE created_at;
+UPDATE line_items SET email = 'x' WHERE 834502;
+-- passo 83
+/* bloco
+   price */ SELECT (307.596);
+-- passo 53
+/* bloco
+   total */ SELECT 675784;
+SELECT price, total, id FROM line_items WHERE ((id) <= 180025 < 383.735) * x >= 'qty' * 'price' = qty ORDER BY y_2 LIMIT 97;
+SELECT email, name, qty FROM _tmp1 WHERE ('email') < (487874) AND ('name') < price + 27112 * 301865 - 'created_at' * 218442 ORDER BY email LIMIT 48;
+SELECT price, total, name FROM orders WHERE email AND (580.044) < 277614 = 230.047 OR (768646) * 437976 ORDER BY x LIMIT 30;
+-- passo 5
+/* bloco
+   id */ SELECT 318493;
+DELETE FROM t WHERE (654237);
+SELECT qty, price, y_2 FROM Customer WHERE 'created_at' ORDER BY created_at LIMIT 2;
+SELECT y_2, email, created_at FROM _tmp1 WHERE ('id' * 956030 * (641.570)) - ('total') ORDER BY x LIMIT 11;
+DELETE FROM orders WHERE name;
+UPDATE _tmp1 SET created_at = 436.053 % 15967 * 'total' != 26.517 AND name WHERE 652181;
+SELECT id, price, email FROM users WHERE 772575 OR total + 'created_at' - 319.139 + ('y_2' OR id) ORDER BY email LIMIT 61;
+SELECT qty, name, created_at FROM t WHERE id = ((347.186 <= 'qty')) ORDER BY price LIMIT 15;
+SELECT y_2, name, email FROM line_items WHERE ('name') ORDER BY id LIMIT 48;
+INSERT INTO products (id, name, price) VALUES (269, 'v54', 0.9012);
+-- passo 48
+/* bloco
+   qty */ SELECT 365413 OR 722533 = 532365 >= 326.563 * 271254;
+SELECT total, price, name FROM orders WHERE ('total') + 'created_at' + 'total' ORDER BY qty LIMIT 86;
+-- passo 29
+/* bloco
+   price */ SELECT ((782.378 OR 20612)) > (974.620);
@@ -0,0 +1,55 @@
+INSERT INTO orders (id, name, price) VALUES (733, 'v25', 0.5192);
+SELECT x, qty, email FROM Customer WHERE (547029) ORDER BY price LIMIT 51;
+-- passo 15
+/* bloco
+   email */ SELECT 'name' <> 777488 AND 222311 != 'total' % 817728 % 2.695 / 484.919 * 89422 < 11.479;
+UPDATE t SET name = 'qty' AND 901.643 / qty < 'x' < 949447 WHERE (695.886 OR (name) <= 'y_2');
+DELETE FROM Customer WHERE 126.902 = (total OR 493.730 OR 117.928 >= 'total');
+-- passo 6
+/* bloco
+   total */ SELECT ('id');
+-- passo 80
+/* bloco
+   name */ SELECT 655651;
+SELECT name, id, price FROM line_items WHERE 589406 <> 'id' ORDER BY y_2 LIMIT 6;
+SELECT total, y_2, qty FROM Customer WHERE 'price' ORDER BY total LIMIT 71;
+SELECT x, qty, name FROM users WHERE (900167) != qty ORDER BY email LIMIT 100;
+INSERT INTO _tmp1 (id, name, price) VALUES (777, 'v10', 0.2931);
+-- passo 63
+/* bloco
+   x */ SELECT 'name' % ('email') != 'price' != (754.770) % 911797;
+-- passo 39
+/* bloco
+   total */ SELECT 'qty' % (920.596) OR 'y_2';
+UPDATE t SET name = (('total' >= 'total')) < 62.631 WHERE (180.693 <= 817510) + (663478) = 636628 OR 567.184 <> 593.120;
+SELECT qty, price, y_2 FROM products WHERE 'x' ORDER BY name LIMIT 77;
+DELETE FROM users WHERE 'name' * (221.722);
+UPDATE users SET y_2 = y_2 - 'created_at' AND ((504693)) AND id WHERE 81565;
+DELETE FROM users WHERE (474306) != 149702;
+DELETE FROM t WHERE (246.757) <= (x) * qty % total <> 60274;
+SELECT y_2, email, created_at FROM line_items WHERE 832.245 ORDER BY price LIMIT 47;
+DELETE FROM users WHERE 144781 >= 87.421;
+INSERT INTO orders (id, name, price) VALUES (140, 'v78', 0.6699);
+INSERT INTO t (id, name, price) VALUES (315, 'v25', 0.0100);
+-- passo 92
+/* bloco
+   id */ SELECT (94717) OR email = ('email') <= name < 21692;
+-- passo 21
+/* bloco
+   name */ SELECT (274118 >= (name) != (127447 OR 'id'));
+DELETE FROM t WHERE ('email' OR email) = 422.136 - name / total AND created_at <= name % 166.978;
+SELECT y_2, price, qty FROM line_items WHERE 293.599 ORDER BY created_at LIMIT 32;
+SELECT y_2, created_at, total FROM _tmp1 WHERE ('email' < (('qty'))) ORDER BY total LIMIT 2;
+UPDATE orders SET qty = ((309858)) WHERE (371314 > 436995) > 'name' % name != price <> 'email' < 'x' != (total OR 608.085);
+INSERT INTO line_items (id, name, price) VALUES (912, 'v1', 0.0256);
+UPDATE t SET x = 'total' WHERE (((229.272) < ('total')));
+DELETE FROM line_items WHERE name OR 655.926 OR 661757 < 60.170 <= total % 614675 * (913454) <= name;
+SELECT name, price, created_at FROM users WHERE (((715.458 * 903.855))) ORDER BY qty LIMIT 58;
+-- passo 2
+/* bloco
+   id */ SELECT 'id';
+SELECT qty, y_2, name FROM t WHERE 6.163 ORDER BY total LIMIT 78;
+UPDATE line_items SET name = 'qty' WHERE ((price % 335.015) <> 'qty' % 279.133 AND 97130);
+-- passo 59
+/* bloco
+   qty */ SELECT 226991;
@@ -0,0 +1,36 @@
+DELETE FROM t WHERE 'created_at';
+-- passo 68
+/* bloco
+   qty */ SELECT (513.028 >= (325885) AND 561.991 / 'price');
+UPDATE products SET total = ('email' + 999.940 > created_at) <> 451624 WHERE (660032);
+-- passo 91
+/* bloco
+   y_2 */ SELECT total;
+SELECT created_at, id, total FROM Customer WHERE email <> 615.332 < 'y_2' < 'price' AND 273885 ORDER BY y_2 LIMIT 34;
+INSERT INTO users (id, name, price) VALUES (172, 'v45', 0.3472);
+SELECT created_at, price, name FROM orders WHERE ((935.844 * price)) < (x >= 206.433 % 962.885) ORDER BY x LIMIT 60;
+-- passo 37
+/* bloco
+   price */ SELECT 485.525 - (359.295) > created_at + 310709 - 184.543 / 964388 + 'qty';
+DELETE FROM line_items WHERE qty + x + y_2 < 65764 <> 843226 != 541883;
+DELETE FROM t WHERE 658.436 != 556168 / 'email' = 415595 / 94.965 >= ('name' > x);
+-- passo 58
+/* bloco
+   total */ SELECT x <> 'qty' % 446667;
+-- passo 93
+/* bloco
+   email */ SELECT 763.618;
+SELECT email, y_2, x FROM orders WHERE (((925.357)) = x) ORDER BY id LIMIT 63;
+SELECT created_at, price, name FROM users WHERE 144.242 != email ORDER BY id LIMIT 10;
+INSERT INTO t (id, name, price) VALUES (837, 'v82', 0.6795);
+DELETE FROM Customer WHERE (x);
+UPDATE products SET y_2 = 617845 WHERE ((335.505)) / 918844 >= 500.002 <= 959504 AND 380539 > 362.653;
+-- passo 51
+/* bloco
+   email */ SELECT 323.200;
+INSERT INTO Customer (id, name, price) VALUES (240, 'v44', 0.1508);
+INSERT INTO users (id, name, price) VALUES (910, 'v85', 0.4531);
+DELETE FROM line_items WHERE (301.489) >= 924.778 <= x OR (941339) > 228919;
+-- passo 64
+/* bloco
+   name */ SELECT id;
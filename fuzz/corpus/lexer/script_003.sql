@@ -0,0 +1,49 @@
+UPDATE _tmp1 SET price = 642.486 WHERE 'x' <= ('email') <= (id <> 164289);
+INSERT INTO t (id, name, price) VALUES (785, 'v11', 0.3578);
+UPDATE line_items SET email = 'created_at' AND 772.606 = price > 'qty' AND 63088 % 773426 < 463006 > (id) AND 'total' <> 'created_at' / 759.167 WHERE (136.525 - 890.970 > 52.128 + 434.809) > 159307;
+UPDATE orders SET y_2 = 'name' = (id) * total = 'price' + y_2 WHERE qty % created_at <> 'id' < 'created_at' <> ((total / 727360));
+INSERT INTO _tmp1 (id, name, price) VALUES (118, 'v11', 0.8431);
+SELECT id, total, email FROM _tmp1 WHERE (746.206 <= 824.991) >= y_2 > 'email' <= 927.329 < 852862 OR id <> 102.803 ORDER BY x LIMIT 85;
+SELECT total, created_at, qty FROM products WHERE (('email' < 340.095)) + 590.591 = 'y_2' ORDER BY name LIMIT 26;
+INSERT INTO line_items (id, name, price) VALUES (981, 'v37', 0.6179);
+UPDATE users SET x = (430.967) WHERE price;
+INSERT INTO products (id, name, price) VALUES (880, 'v9', 0.0799);
+DELETE FROM line_items WHERE (('x' <> 'total' * qty > email));
+SELECT name, id, x FROM orders WHERE (823.993 != 816.849 = 988.681 - (created_at)) ORDER BY created_at LIMIT 39;
+INSERT INTO Customer (id, name, price) VALUES (389, 'v55', 0.8566);
+UPDATE products SET qty = 'x' WHERE email >= ((273.557) / 425726 / 899808);
+SELECT x, price, id FROM Customer WHERE (840883) AND name <> 740514 OR 160.144 AND 560.575 ORDER BY created_at LIMIT 42;
+-- passo 27
+/* bloco
+   price */ SELECT 343529 > 728.240 > (email) % (932596);
+DELETE FROM products WHERE 271.174 + 194.375 + 481.041 * 'y_2' - price + price = 662.746 + x;
+INSERT INTO users (id, name, price) VALUES (156, 'v63', 0.2705);
+-- passo 41
+/* bloco
+   x */ SELECT 44106;
+UPDATE line_items SET y_2 = 952528 WHERE 512125 - created_at % qty OR 41.223;
+UPDATE users SET x = email - 711779 / qty WHERE ((866.638 AND 'x')) * 948735;
+DELETE FROM line_items WHERE y_2 AND 251769 != 663.613 OR (594.866 + 'x') <> ((844.537)) = 'x';
+-- passo 30
+/* bloco
+   name */ SELECT 'price';
+UPDATE products SET price = (323557) WHERE (945.005) >= ('y_2') * 266.344 % 'id' != ('name') != (36812 + created_at);
+DELETE FROM orders WHERE 'id' < 963.023 = 48.324 * 170026 > (401573);
+UPDATE products SET x = 438.296 WHERE (((837.108) + y_2));
+UPDATE line_items SET email = (11.746 = email AND name AND 392.570) OR 735.660 WHERE email;
+-- passo 73
+/* bloco
+   qty */ SELECT (price % 287.485 >= 607.680) - (517.270 / 'id' <= 'name' / 347116);
+-- passo 26
+/* bloco
+   created_at */ SELECT 'created_at' = 'name' <> 371.349 > 'price' != x <> qty != qty >= id OR 557.754 = 'email' + ('x') - x < y_2;
+INSERT INTO _tmp1 (id, name, price) VALUES (284, 'v66', 0.4367);
+DELETE FROM orders WHERE 'y_2' + name OR ('email' - 'x' AND 903557);
+DELETE FROM _tmp1 WHERE 628172 + (id + total) < price * y_2 < id < 705.931 != ('y_2');
+INSERT INTO users (id, name, price) VALUES (725, 'v83', 0.7355);
+DELETE FROM users WHERE 369652 OR 317428 != qty > 545390 AND 'price' AND 942.746 >= 'email';
+SELECT x, price, email FROM orders WHERE ('id' < qty AND email + email) < 168940 ORDER BY total LIMIT 67;
+SELECT qty, y_2, price FROM _tmp1 WHERE (437.992) AND (691.147) <= 67.932 - name * 720936 - 'price' >= (qty) OR 703300 - 693339 != 401616 ORDER BY id LIMIT 9;
+UPDATE users SET created_at = 381297 = 174305 AND 977540 WHERE x > (created_at) - (508519 <> 'email') != 581737;
+DELETE FROM _tmp1 WHERE total;
+INSERT INTO t (id, name, price) VALUES (174, 'v65', 0.8647);
@@ -0,0 +1,20 @@
+SELECT x, created_at, qty FROM users WHERE (317.819 > x > y_2) < email OR price != 299023 % 679.120 != 391865 <= 309.889 / 'email' ORDER BY id LIMIT 73;
+UPDATE Customer SET price = 'created_at' WHERE ((126391) * 929590 <> 828391);
+UPDATE _tmp1 SET total = 819.600 WHERE 'name';
+UPDATE Customer SET y_2 = ((942428 <> 598018)) <> (682.386 AND 'price' = 'qty' <> 'email') WHERE qty + 582.353 = total > 122832 > 766.191 * 'y_2' >= id >= price + name;
+-- passo 40
+/* bloco
+   created_at */ SELECT ((83.927));
+SELECT id, created_at, name FROM users WHERE (('price')) <> 'name' - 'x' ORDER BY qty LIMIT 80;
+SELECT x, total, name FROM Customer WHERE 113136 ORDER BY created_at LIMIT 65;
+DELETE FROM t WHERE 'qty' <= 214578 * 'created_at';
+UPDATE t SET created_at = 93466 WHERE qty;
+-- passo 66
+/* bloco
+   email */ SELECT ((name)) % ('y_2') AND 769.148 * 63.197 > 'price';
+SELECT id, y_2, price FROM _tmp1 WHERE 632989 * 742291 != 'total' / 795619 >= 867.422 AND 469.215 ORDER BY email LIMIT 23;
+UPDATE _tmp1 SET qty = id AND 848.493 % 413570 + 856645 AND 'email' <> 336.409 OR email WHERE 748.903 = name / ('x') % 899.665 <= y_2 > qty != (523.680 - 229646) <> 211522 != 634245 * y_2;
+SELECT y_2, id, created_at FROM orders WHERE 977929 * 602.112 / y_2 AND (564727 / 'name') >= total != 'email' * 352370 / 618.210 ORDER BY price LIMIT 82;
+INSERT INTO line_items (id, name, price) VALUES (87, 'v18', 0.1931);
+UPDATE users SET y_2 = 'x' WHERE (y_2) = (351872) != 849.499 < 998317 < 365.848 <= 'price' > 897.525;
+DELETE FROM line_items WHERE (((937.956) % (created_at)));
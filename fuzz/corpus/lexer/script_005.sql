@@ -0,0 +1,36 @@
+-- passo 35
+/* bloco
+   email */ SELECT x;
+SELECT qty, id, email FROM orders WHERE qty >= 577654 <> x > price - name ORDER BY x LIMIT 21;
+SELECT qty, email, x FROM orders WHERE 'total' % ((179.899)) ORDER BY id LIMIT 58;
+-- passo 87
+/* bloco
+   id */ SELECT 'email' < 'price' * id OR ('email') <= 938514 AND 688.009 AND 'name' OR 'created_at' >= 'name' != created_at;
+SELECT created_at, qty, id FROM line_items WHERE 'y_2' AND email + 850717 = 'id' != 892751 != 359898 > 185.934 = 857.559 ORDER BY created_at LIMIT 8;
+INSERT INTO orders (id, name, price) VALUES (928, 'v78', 0.3019);
+SELECT total, x, name FROM _tmp1 WHERE 'id' ORDER BY qty LIMIT 84;
+DELETE FROM line_items WHERE 581032 != (103715) = ('email') <= 204.573 != 504063 = qty;
+DELETE FROM users WHERE 215763;
+SELECT created_at, name, x FROM _tmp1 WHERE 87.551 <= 864385 OR 121.626 > id OR created_at + 389857 = 267459 * 'name' <> (443194 OR 'total') ORDER BY email LIMIT 61;
+SELECT id, x, created_at FROM orders WHERE id ORDER BY created_at LIMIT 11;
+UPDATE Customer SET name = (77792) WHERE 'name' * (625.186 < 'qty') * qty;
+INSERT INTO line_items (id, name, price) VALUES (3, 'v89', 0.2227);
+DELETE FROM users WHERE 687.437;
+INSERT INTO products (id, name, price) VALUES (677, 'v85', 0.3302);
+SELECT total, y_2, id FROM line_items WHERE name ORDER BY total LIMIT 65;
+DELETE FROM products WHERE x;
+-- passo 60
+/* bloco
+   price */ SELECT 458573;
+-- passo 5
+/* bloco
+   name */ SELECT 53.757;
+INSERT INTO _tmp1 (id, name, price) VALUES (849, 'v46', 0.4066);
+UPDATE orders SET x = (570319) WHERE 120801 + 'email';
+-- passo 25
+/* bloco
+   created_at */ SELECT (((649622))) < 597.794;
+UPDATE users SET x = 375.175 <> 'qty' OR (90384) AND (email = (933203)) WHERE ((name >= 420.127 <> 183.368));
+UPDATE users SET qty = (('created_at') < ('price') AND 119610) WHERE 674.341 - qty + 237.368 <> 'email' / 240.563 % 'id' != 'x';
+INSERT INTO Customer (id, name, price) VALUES (979, 'v13', 0.9789);
+DELETE FROM users WHERE ('total' < (email) < 'qty' = 273.965 OR y_2);
@@ -0,0 +1,32 @@
+INSERT INTO line_items (id, name, price) VALUES (23, 'v46', 0.2223);
+SELECT qty, x, price FROM orders WHERE (x) ORDER BY id LIMIT 49;
+INSERT INTO products (id, name, price) VALUES (698, 'v51', 0.6757);
+DELETE FROM t WHERE (645.241);
+-- passo 89
+/* bloco
+   price */ SELECT 140521 % (704506 AND x) > 620689 % 'qty' - 862.430 > id;
+SELECT name, id, y_2 FROM t WHERE (qty AND 'y_2') <= 486537 / 'created_at' + 'email' < (('email' >= 'price')) ORDER BY price LIMIT 61;
+-- passo 25
+/* bloco
+   qty */ SELECT (635.610 <> 914697 < price AND 457890 OR 509.561);
+INSERT INTO _tmp1 (id, name, price) VALUES (887, 'v55', 0.3880);
+INSERT INTO users (id, name, price) VALUES (187, 'v92', 0.5775);
+INSERT INTO orders (id, name, price) VALUES (486, 'v75', 0.5377);
+DELETE FROM _tmp1 WHERE 'name' / 572.836 - 674596 % 62819 / 'created_at' * 962511;
+DELETE FROM users WHERE 474214 / ((y_2)) <= (871180) OR (221350) != 'email' + 'qty' OR 455115;
+DELETE FROM _tmp1 WHERE 22962;
+UPDATE users SET price = 43.059 WHERE name AND (total) - 'qty' / 519.086 OR 683329;
+DELETE FROM line_items WHERE 632599 % 'id' > ('name') % total + 233258;
+-- passo 9
+/* bloco
+   price */ SELECT 251.877;
+SELECT name, total, price FROM t WHERE 'created_at' % 281.638 < 'y_2' ORDER BY email LIMIT 30;
+UPDATE users SET email = ('qty') != qty - 'qty' != 314949 WHERE (411117 = 'total' / 'y_2' + 558.463 AND 498395);
+-- passo 22
+/* bloco
+   price */ SELECT 222316;
+INSERT INTO _tmp1 (id, name, price) VALUES (564, 'v28', 0.9792);
+UPDATE Customer SET created_at = (963609) WHERE ('qty');
+UPDATE orders SET id = ((212.932 <= 'id')) < 895.056 WHERE ('email');
+INSERT INTO Customer (id, name, price) VALUES (296, 'v72', 0.6829);
+SELECT email, name, id FROM t WHERE ('x' != email / 135.742 / x * (id)) ORDER BY total LIMIT 30;
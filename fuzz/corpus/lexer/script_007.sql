@@ -0,0 +1,15 @@
+SELECT total, qty, price FROM t WHERE (((39108 / 'id'))) ORDER BY x LIMIT 90;
+DELETE FROM products WHERE 'name' < 'x' AND 731.737 + (474.552) <= ('qty') <= (price) >= 154987 + 732.750 <= 439.345 * 558.529;
+SELECT created_at, x, id FROM t WHERE 835.425 = total ORDER BY name LIMIT 59;
+-- passo 18
+/* bloco
+   x */ SELECT price OR 438.027 OR 328766 OR (141915 / 873.101) AND 102935;
+DELETE FROM users WHERE total;
+SELECT total, name, x FROM users WHERE id ORDER BY id LIMIT 51;
+UPDATE orders SET qty = ((('created_at'))) % 436.745 WHERE x;
+DELETE FROM users WHERE 414250 < ('email' > 392.394) <> 870795 * 990.892 OR 'qty' AND total;
+INSERT INTO products (id, name, price) VALUES (384, 'v25', 0.4147);
+-- passo 87
+/* bloco
+   x */ SELECT ('x') > ((990.463));
+DELETE FROM products WHERE 590427 + ('x' < 'name') * (y_2) + 861.225 = (181.439);
@@ -0,0 +1,21 @@
+-- passo 83
+/* bloco
+   total */ SELECT 380215 > (9.506) % ('email') <= ('id' > 522060);
+DELETE FROM users WHERE (('price' AND 298910) % (365405));
+INSERT INTO line_items (id, name, price) VALUES (749, 'v36', 0.1168);
+-- passo 12
+/* bloco
+   created_at */ SELECT 270.048;
+-- passo 32
+/* bloco
+   id */ SELECT 779.455;
+UPDATE users SET created_at = 943391 WHERE ((924.545 = 360209) != (637882 / 130.742));
+DELETE FROM products WHERE 445880 + 366235 AND 'email' - email != 'name' AND 629966;
+SELECT y_2, email, price FROM orders WHERE (803.201 AND (196662)) OR (701800 + 916.064 < 483715) ORDER BY price LIMIT 4;
+-- passo 16
+/* bloco
+   x */ SELECT ('name' <= 516923 AND 876.122 % name);
+-- passo 65
+/* bloco
+   price */ SELECT 96763 - 'x';
+INSERT INTO Customer (id, name, price) VALUES (417, 'v38', 0.7506);
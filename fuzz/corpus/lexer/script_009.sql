@@ -0,0 +1,22 @@
+INSERT INTO t (id, name, price) VALUES (697, 'v76', 0.4638);
+DELETE FROM orders WHERE y_2;
+INSERT INTO line_items (id, name, price) VALUES (109, 'v15', 0.7237);
+UPDATE _tmp1 SET y_2 = created_at * 432.273 < ('name') + (174.996) + 'created_at' WHERE 'x' <> price = 'id' >= x >= 527820 != 439.599 >= (623.291 OR 560.481) < 'created_at' AND 274726 <= 918984;
+DELETE FROM Customer WHERE (((446158))) < ('email');
+-- passo 76
+/* bloco
+   qty */ SELECT email;
+DELETE FROM orders WHERE 'created_at';
+UPDATE t SET qty = id + 907800 / (45.979) OR (709.243) % name <= (625.362 * 174.099 < total = id) WHERE 859428 AND 334707 != 385.115 < 788.643 <= 787.560 <= email - 947.430 + 124.972;
+INSERT INTO Customer (id, name, price) VALUES (467, 'v58', 0.6526);
+SELECT created_at, email, x FROM products WHERE (861.470) != 839809 > 296652 <> 'price' > id >= 395747 ORDER BY y_2 LIMIT 98;
+-- passo 61
+/* bloco
+   created_at */ SELECT 'y_2';
+SELECT total, price, email FROM products WHERE 'id' < 713.909 <= 76.342 / 'y_2' <= ('qty') ORDER BY name LIMIT 53;
+SELECT email, price, created_at FROM t WHERE (23.398 + 'y_2' <= 'created_at' + email OR 369.218 + 597.671 = created_at != email) ORDER BY email LIMIT 28;
+DELETE FROM t WHERE 534.947;
+-- passo 46
+/* bloco
+   name */ SELECT 416.384 + 'y_2' - 730370 - 794.595 < (created_at OR 563150) AND (887804) + price AND 18.525 / 473074;
+SELECT qty, name, y_2 FROM orders WHERE 'price' != ('x' - qty) <= ('total') * 940023 = 'total' ORDER BY total LIMIT 69;
@@ -0,0 +1,16 @@
+INSERT INTO orders (id, name, price) VALUES (353, 'v42', 0.0653);
+UPDATE users SET x = x WHERE (632.584 <> (qty) / id + 835.638 OR 'price' = 19.788);
+SELECT name, x, total FROM users WHERE name <> 'qty' OR 'y_2' >= y_2 * 'email' OR 697585 >= ('qty') ORDER BY qty LIMIT 40;
+SELECT email, total, created_at FROM Customer WHERE 91.275 ORDER BY y_2 LIMIT 16;
+DELETE FROM users WHERE 215922 <= (673190) != 489045;
+-- passo 61
+/* bloco
+   created_at */ SELECT 681114 - qty * ('qty') + 263.233 * 774114 - qty < 5459 > qty AND 116.089 / 'created_at' <> 193263;
+INSERT INTO t (id, name, price) VALUES (798, 'v89', 0.7524);
+INSERT INTO line_items (id, name, price) VALUES (547, 'v21', 0.2068);
+INSERT INTO orders (id, name, price) VALUES (400, 'v9', 0.4690);
+UPDATE _tmp1 SET name = y_2 - 'email' <= (681.552 AND 'qty') WHERE 786.228 >= (('x') = price != 171.684);
+DELETE FROM t WHERE email;
+-- passo 46
+/* bloco
+   created_at */ SELECT email;
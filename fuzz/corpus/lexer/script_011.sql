@@ -0,0 +1,18 @@
+INSERT INTO orders (id, name, price) VALUES (927, 'v47', 0.2249);
+UPDATE line_items SET price = (qty >= 489.991 / 'price') >= 'name' < 'email' OR 876.750 OR 132524 WHERE 'name' % created_at % 'price' * (308.953) != total;
+INSERT INTO orders (id, name, price) VALUES (518, 'v27', 0.8887);
+DELETE FROM orders WHERE 339580;
+INSERT INTO products (id, name, price) VALUES (977, 'v51', 0.0117);
+-- passo 12
+/* bloco
+   name */ SELECT (name > 546187) < (name <> id) = 255156 / price - created_at;
+UPDATE orders SET y_2 = qty - 49.614 % (('name')) OR 486135 WHERE email;
+-- passo 40
+/* bloco
+   y_2 */ SELECT (137111 <> 251298) OR (created_at OR 617.046) * (name);
+INSERT INTO t (id, name, price) VALUES (262, 'v4', 0.3026);
+-- passo 62
+/* bloco
+   y_2 */ SELECT ('id') <> 'id';
+UPDATE orders SET price = id WHERE x;
+UPDATE users SET name = 463.469 > 'y_2' WHERE 'price' >= qty;
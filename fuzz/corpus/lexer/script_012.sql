@@ -0,0 +1,60 @@
+-- passo 46
+/* bloco
+   x */ SELECT (540.456 >= 963287 * 657.997) != 111408 OR (505752) - 'y_2' != 'email';
+SELECT y_2, name, email FROM products WHERE ((113.837)) ORDER BY created_at LIMIT 70;
+INSERT INTO products (id, name, price) VALUES (11, 'v52', 0.3694);
+-- passo 97
+/* bloco
+   created_at */ SELECT (email != 22.632 <= name != (id) > 310.370 < 'name');
+SELECT email, x, id FROM orders WHERE 64523 ORDER BY price LIMIT 98;
+UPDATE Customer SET price = 867.544 != qty + 77.233 <> ('y_2') OR 723996 * 453079 OR 'y_2' - 418.297 WHERE 703.738;
+INSERT INTO _tmp1 (id, name, price) VALUES (355, 'v5', 0.3470);
+UPDATE orders SET created_at = 'x' > 'total' - 349.312 WHERE 'price';
+INSERT INTO _tmp1 (id, name, price) VALUES (698, 'v95', 0.5784);
+UPDATE users SET name = (name > 62.510 = 220068 = x) OR 286.666 WHERE ((274.767));
+DELETE FROM t WHERE 833.500 + 'qty' * id < 'y_2' = ('id') >= created_at < y_2 <> 'name';
+-- passo 1
+/* bloco
+   total */ SELECT (x <= x >= 682.956) < id > 976639 + name <= price < (total AND name);
+-- passo 67
+/* bloco
+   y_2 */ SELECT (503262) / ('x') + ('email') AND 302062;
+INSERT INTO users (id, name, price) VALUES (94, 'v26', 0.3561);
+SELECT price, id, email FROM t WHERE 339738 ORDER BY x LIMIT 72;
+INSERT INTO Customer (id, name, price) VALUES (611, 'v14', 0.1128);
+-- passo 82
+/* bloco
+   name */ SELECT (191892 - id AND 276794 * price) AND 730558 AND 'name';
+INSERT INTO products (id, name, price) VALUES (454, 'v94', 0.1115);
+-- passo 9
+/* bloco
+   price */ SELECT (592427);
+INSERT INTO products (id, name, price) VALUES (126, 'v28', 0.7209);
+UPDATE t SET id = ('qty' <= 146945 > 'y_2' < 'created_at' / 618.985) WHERE 'name';
+DELETE FROM _tmp1 WHERE (x) OR (260372) != ('y_2' <= 'created_at') OR 731270;
+-- passo 56
+/* bloco
+   created_at */ SELECT 'created_at' OR 837623;
+UPDATE t SET total = (('created_at' - 957.582 OR 85.497 / 844037)) WHERE x;
+DELETE FROM _tmp1 WHERE price;
+-- passo 49
+/* bloco
+   y_2 */ SELECT created_at * name - 607.963 != x < 904.189 % name <= x;
+-- passo 11
+/* bloco
+   price */ SELECT 'id';
+INSERT INTO _tmp1 (id, name, price) VALUES (626, 'v38', 0.1103);
+DELETE FROM users WHERE (email);
+DELETE FROM _tmp1 WHERE 'qty' OR 63854 <= 559000 != 696125 < y_2 AND 744.236 % (997.839) < 375.352 >= 'x' <> price / 'price';
+INSERT INTO orders (id, name, price) VALUES (325, 'v87', 0.0073);
+UPDATE users SET qty = created_at > 54082 <= 783482 / 890546 WHERE 920.100;
+INSERT INTO users (id, name, price) VALUES (163, 'v85', 0.1405);
+DELETE FROM t WHERE id + 'qty';
+UPDATE _tmp1 SET qty = 774.871 * 'email' + 'total' AND 496.248 AND 'qty' / 'total' * 362786 <> 695454 AND 932.151 != 400.713 WHERE 'created_at' >= 795.293 < 185685 >= (total <> name);
+UPDATE t SET y_2 = ('qty') WHERE 748580;
+SELECT y_2, id, total FROM users WHERE (y_2) ORDER BY x LIMIT 33;
+DELETE FROM products WHERE (986.864 AND (746330)) + (name) = name / email + 348.835 * x / 173.586;
+-- passo 72
+/* bloco
+   x */ SELECT ('id');
+UPDATE products SET total = 374571 < (754.686 >= qty) * 379566 <= email != 426604 = 'email' WHERE (('total') - 'id' / 138.660);
@@ -0,0 +1,38 @@
+-- passo 2
+/* bloco
+   qty */ SELECT email;
+DELETE FROM line_items WHERE name;
+UPDATE orders SET name = 469939 % y_2 = 52300 <= (579.635) = 66790 >= 'created_at' WHERE (450.578);
+-- passo 95
+/* bloco
+   y_2 */ SELECT ((((312479))));
+SELECT created_at, price, x FROM orders WHERE ('price') ORDER BY price LIMIT 56;
+UPDATE _tmp1 SET total = y_2 <> (262016) / ('name') > 'price' - 'total' WHERE qty;
+UPDATE t SET email = ((838.608) <> (price) >= 385.575) WHERE (721448) / (319.223) <= (982599 != 'x') >= ((331.238));
+DELETE FROM t WHERE 73933;
+DELETE FROM orders WHERE ((y_2 - 141.966 != 'price' <= 928047));
+SELECT name, created_at, id FROM Customer WHERE created_at ORDER BY created_at LIMIT 94;
+SELECT created_at, email, y_2 FROM _tmp1 WHERE ((620723) OR (422.075) >= 180.439 = id >= 'email') ORDER BY name LIMIT 20;
+-- passo 88
+/* bloco
+   x */ SELECT 'x' = 'name' = 297639 = 789593 OR 499.396 AND 449702;
+INSERT INTO Customer (id, name, price) VALUES (42, 'v48', 0.6156);
+-- passo 94
+/* bloco
+   email */ SELECT ((name < 'total') <> (419.855 * 989.300));
+INSERT INTO Customer (id, name, price) VALUES (828, 'v48', 0.9033);
+INSERT INTO Customer (id, name, price) VALUES (256, 'v15', 0.8521);
+-- passo 93
+/* bloco
+   price */ SELECT 52.115 >= 'name' > 616.309 / 'price' <= 213.967 - 317861 != 78850;
+UPDATE users SET total = 668.788 * 55.697 + 'y_2' <> 405.768 = (qty <= 121160 > 560.235 <> qty) WHERE 'y_2' AND 893.174 % qty - x OR 871.895 != 241271 - y_2 - (230159);
+INSERT INTO t (id, name, price) VALUES (323, 'v58', 0.3403);
+-- passo 67
+/* bloco
+   created_at */ SELECT (998267 - 969545 > x = y_2 % 513.777);
+INSERT INTO products (id, name, price) VALUES (673, 'v29', 0.6910);
+DELETE FROM t WHERE 'price';
+-- passo 76
+/* bloco
+   id */ SELECT 'email' - total OR price % total * y_2 + 651.378 * 168.466 <= 503.596;
+DELETE FROM t WHERE 785848 + email != name >= 111.501 != 425.651;
@@ -0,0 +1,45 @@
+INSERT INTO products (id, name, price) VALUES (78, 'v21', 0.6566);
+INSERT INTO t (id, name, price) VALUES (485, 'v69', 0.0990);
+SELECT total, name, x FROM orders WHERE 'price' <> 'id' < 930.181 <> (934620) AND (364437) ORDER BY email LIMIT 93;
+-- passo 5
+/* bloco
+   price */ SELECT ((187.362 - 417.779)) >= 833644;
+UPDATE t SET id = ('email' AND (781986) >= created_at >= 'created_at') WHERE 227268;
+INSERT INTO products (id, name, price) VALUES (13, 'v6', 0.8035);
+-- passo 50
+/* bloco
+   y_2 */ SELECT (891113 <> 913841) <> ((email)) % 'x' - 996738 * 857488 <= 574.798 != ((680235));
+DELETE FROM products WHERE 'qty' != (price) AND total = 464.030 * ('email' >= 'y_2' >= ('created_at'));
+DELETE FROM line_items WHERE (748.147);
+-- passo 71
+/* bloco
+   id */ SELECT (('created_at') >= (price));
+DELETE FROM users WHERE id - 'name' % 'total' >= 'qty' > 'y_2' <> 619.947;
+INSERT INTO line_items (id, name, price) VALUES (515, 'v46', 0.5228);
+UPDATE _tmp1 SET price = ((price OR 593983 - 434.155 = 'id')) WHERE (677.324);
+SELECT qty, email, created_at FROM products WHERE (975.603) % ('x') % 'id' = 233099 <> 779720 ORDER BY qty LIMIT 4;
+UPDATE products SET x = 'y_2' - x OR 'total' * 449411 * id >= ('qty' OR 466.979 = 129867 / 734069) WHERE 631.153;
+-- passo 7
+/* bloco
+   total */ SELECT id != ('created_at') < 490.133 % (626.142 < (823.234));
+INSERT INTO line_items (id, name, price) VALUES (26, 'v85', 0.4402);
+-- passo 67
+/* bloco
+   qty */ SELECT 'total' AND (634141 AND 760.197 != 565841 > 'total');
+INSERT INTO orders (id, name, price) VALUES (323, 'v46', 0.4470);
+SELECT x, y_2, name FROM line_items WHERE 'id' < ((360379)) ORDER BY x LIMIT 81;
+-- passo 95
+/* bloco
+   email */ SELECT (548224 % created_at) OR 325281 >= (88.277) >= 678701 + 701148 <= 726524;
+UPDATE line_items SET name = (489.679) / 'total' % (('created_at')) WHERE ('created_at' / 400.037);
+INSERT INTO _tmp1 (id, name, price) VALUES (27, 'v28', 0.5366);
+DELETE FROM line_items WHERE 'price';
+DELETE FROM users WHERE price;
+-- passo 47
+/* bloco
+   created_at */ SELECT (453938);
+UPDATE orders SET qty = 490003 WHERE (262.457) % 422.818 / 559361 <> 55.679 <> (666.776 != 'qty') <= 'name';
+DELETE FROM Customer WHERE 593.187;
+-- passo 98
+/* bloco
+   total */ SELECT 'created_at';
@@ -0,0 +1,23 @@
+-- passo 14
+/* bloco
+   total */ SELECT (total) <> 593540 <> 258478 AND 'email' <= (914.900 != (638.070));
+-- passo 83
+/* bloco
+   id */ SELECT email;
+INSERT INTO _tmp1 (id, name, price) VALUES (436, 'v60', 0.8328);
+UPDATE Customer SET x = 910.986 WHERE ('email' = (621931) OR 117.913 + 367.822 % 704.461 / email);
+INSERT INTO t (id, name, price) VALUES (429, 'v3', 0.1923);
+UPDATE t SET id = 813.758 - (333766 OR 406742) <= 'price' = 'qty' - email WHERE 'email' AND 814.102 - qty + 755.813 <= 621.616 * (986.033) > 'qty' = 327.430;
+-- passo 18
+/* bloco
+   price */ SELECT 'total';
+-- passo 21
+/* bloco
+   id */ SELECT 287.480 >= 218.205 != 'email' != 926317 < 972570 % 107016 + x <= 53.705;
+-- passo 89
+/* bloco
+   created_at */ SELECT (email <> 408636 <> 'total' = price / 916017 % 649219 OR (created_at));
+SELECT name, created_at, qty FROM orders WHERE 'total' < (535410) % 537754 >= 520.397 / created_at * 899450 != 'y_2' ORDER BY created_at LIMIT 74;
+INSERT INTO t (id, name, price) VALUES (930, 'v44', 0.2212);
+SELECT total, created_at, qty FROM _tmp1 WHERE x / (586.490 = 740.592) <> 116.023 != created_at % y_2 ORDER BY created_at LIMIT 50;
+UPDATE users SET email = ((x)) WHERE 817377 - email / 'qty' <= 211.237 >= 606.264 <> ((921342 != 111020));
@@ -0,0 +1,52 @@
+-- passo 44
+/* bloco
+   created_at */ SELECT (('price')) != ('x' <= 12.484) <= 'y_2';
+DELETE FROM _tmp1 WHERE 360.796 / 'total' != 626.056 <> 341581 <> 102908 != qty != 386356;
+UPDATE Customer SET created_at = (620.776 <= id OR 359690 - 'x') WHERE 'y_2';
+SELECT created_at, qty, price FROM _tmp1 WHERE 'x' ORDER BY created_at LIMIT 86;
+-- passo 84
+/* bloco
+   name */ SELECT (298957 - 290.531) = 114438 <> x OR 'created_at' + 'name' % id;
+DELETE FROM _tmp1 WHERE 'total';
+-- passo 11
+/* bloco
+   y_2 */ SELECT (price AND 348.636 OR ('y_2')) > 917.297 + qty - 159.829 * 258985;
+INSERT INTO line_items (id, name, price) VALUES (871, 'v79', 0.7175);
+INSERT INTO orders (id, name, price) VALUES (437, 'v22', 0.6828);
+UPDATE orders SET created_at = created_at > 613094 + (286763 % 980.265 != 846.685) WHERE ('name' != 'qty' > 792757 = 619.005) OR 181485;
+UPDATE line_items SET y_2 = ((525836 <= 'y_2' * 994492)) WHERE (718946 != x) + 578796 > 774468 % email < 798060 + id + name;
+INSERT INTO line_items (id, name, price) VALUES (237, 'v47', 0.7555);
+INSERT INTO users (id, name, price) VALUES (206, 'v82', 0.2078);
+DELETE FROM products WHERE 202453 <> 121362 <= qty <= 760900 OR 604794 OR 143.098;
+SELECT id, qty, total FROM _tmp1 WHERE 'price' AND (131429) AND (created_at) / 540175 + id OR 134.531 * 674833 OR 625667 % id ORDER BY email LIMIT 40;
+DELETE FROM users WHERE (((671982) = 'total' + 'price'));
+SELECT y_2, price, name FROM Customer WHERE (749.675) + 634185 / 905.888 <= 'qty' != (841667) ORDER BY name LIMIT 16;
+SELECT created_at, price, x FROM _tmp1 WHERE 111.106 ORDER BY total LIMIT 40;
+UPDATE Customer SET created_at = 207063 WHERE (23.524 AND 556453) % 949557 <= x >= (y_2 % 'y_2');
+-- passo 40
+/* bloco
+   y_2 */ SELECT 370367 / (476281) > 'id' OR 'created_at' + (email);
+SELECT price, name, email FROM Customer WHERE 254545 ORDER BY x LIMIT 8;
+INSERT INTO Customer (id, name, price) VALUES (900, 'v2', 0.2635);
+INSERT INTO line_items (id, name, price) VALUES (866, 'v89', 0.7305);
+UPDATE Customer SET qty = qty - 182.564 WHERE 270.603;
+-- passo 36
+/* bloco
+   created_at */ SELECT 'total' = 'name' <> 'total' AND 8.524 + ('total' >= y_2);
+UPDATE Customer SET created_at = ((433709 * 'y_2')) WHERE ('x') != 883592 != 263931 <= 'email' AND (x) * 'name';
+SELECT price, email, x FROM Customer WHERE (936270) * (261448) / 249658 / 249334 != 169.288 - (308.809) ORDER BY total LIMIT 70;
+DELETE FROM t WHERE ('qty');
+UPDATE line_items SET name = 481.039 != (362.227) WHERE 627655;
+SELECT x, qty, name FROM Customer WHERE 598.378 ORDER BY total LIMIT 12;
+DELETE FROM Customer WHERE 405250 AND 287116 >= ((941096)) <= (224.030 AND 'y_2');
+UPDATE products SET y_2 = ((created_at)) AND created_at <> ('total') >= 'id' <= created_at <> price <= 276.112 % 15770 WHERE 'price';
+-- passo 86
+/* bloco
+   created_at */ SELECT 958125;
+-- passo 32
+/* bloco
+   qty */ SELECT 341.508 + (email % 'x' <= (id));
+DELETE FROM orders WHERE 854129 >= ('price') - 179213 = 542.511 = (469950) AND 773187 + 547029;
+UPDATE t SET id = total <= (email) - 379545 AND 430788 + (462410 < 'x') WHERE 430.334;
+DELETE FROM products WHERE 'id';
+DELETE FROM Customer WHERE 499.866;
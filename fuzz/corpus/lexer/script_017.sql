@@ -0,0 +1,7 @@
+SELECT email, name, price FROM Customer WHERE price + (953.150 != 847549) != 'qty' ORDER BY total LIMIT 77;
+SELECT created_at, y_2, qty FROM t WHERE (total) ORDER BY price LIMIT 28;
+DELETE FROM users WHERE 'email' = ((created_at)) / 'name' > price % 'qty' >= 78.313;
+UPDATE orders SET email = 397690 WHERE 755.322 % 607840 OR 668.410;
+-- passo 52
+/* bloco
+   created_at */ SELECT 456.815 * 439223;
@@ -0,0 +1,56 @@
+SELECT total, price, id FROM line_items WHERE ('qty' < (726485)) ORDER BY x LIMIT 79;
+UPDATE t SET name = (('total')) < (2975 <= 'name') != (745048) WHERE y_2;
+UPDATE products SET y_2 = (681059) WHERE ('qty') = email % 130.578;
+SELECT x, name, total FROM _tmp1 WHERE 'id' - 'id' >= 'email' >= 632545 / (330029) ORDER BY name LIMIT 5;
+INSERT INTO orders (id, name, price) VALUES (953, 'v25', 0.2823);
+UPDATE users SET id = 'email' WHERE (y_2 OR 'qty' >= id) >= 731595;
+INSERT INTO Customer (id, name, price) VALUES (729, 'v48', 0.5603);
+-- passo 97
+/* bloco
+   created_at */ SELECT 'name' AND 'id' != 'id' % created_at / (534.305) - (x) <= 126824 < 'id';
+-- passo 48
+/* bloco
+   created_at */ SELECT 885.664;
+-- passo 81
+/* bloco
+   y_2 */ SELECT (659561);
+UPDATE users SET y_2 = 9.176 WHERE 432988 / (845.101) >= price < 'x' != 569144 = price;
+SELECT id, email, total FROM products WHERE 507.629 >= (327271) / email != 'price' > (203.820) ORDER BY email LIMIT 33;
+SELECT qty, total, price FROM users WHERE 213105 + (149773) ORDER BY created_at LIMIT 87;
+INSERT INTO products (id, name, price) VALUES (525, 'v95', 0.9786);
+-- passo 41
+/* bloco
+   name */ SELECT 244232 = 'y_2' != 'qty' > 'x' - 847.280 != (148.825 / 3087);
+-- passo 62
+/* bloco
+   id */ SELECT ('created_at');
+DELETE FROM users WHERE (((688647))) / 629.153;
+SELECT email, y_2, created_at FROM t WHERE 377.884 + (('y_2')) * 424917 >= 925212 ORDER BY name LIMIT 95;
+-- passo 19
+/* bloco
+   id */ SELECT (price);
+DELETE FROM users WHERE (569.764 + 217.367 = price - 'email' = 227.624);
+-- passo 18
+/* bloco
+   y_2 */ SELECT ((y_2) OR total) <> (823.176) * 'y_2' > 'qty' AND 398.267 < id;
+UPDATE users SET qty = 'email' = 84260 + 128.658 OR 'total' % 32.764 >= 259.646 WHERE 558.608;
+UPDATE line_items SET total = price OR 'created_at' WHERE (199.963 * (x >= 764.181));
+-- passo 8
+/* bloco
+   qty */ SELECT 189.313 >= (790582) / name * id != 866792;
+INSERT INTO Customer (id, name, price) VALUES (622, 'v13', 0.0407);
+UPDATE orders SET id = 'created_at' WHERE 'name';
+-- passo 51
+/* bloco
+   name */ SELECT y_2;
+DELETE FROM t WHERE (x) > name > 537618;
+-- passo 34
+/* bloco
+   qty */ SELECT 'total';
+-- passo 26
+/* bloco
+   id */ SELECT ((225996 / 159.017)) <= (email);
+DELETE FROM t WHERE 812703;
+-- passo 53
+/* bloco
+   id */ SELECT (x);
@@ -0,0 +1,52 @@
+INSERT INTO users (id, name, price) VALUES (751, 'v52', 0.3321);
+DELETE FROM t WHERE ((436413 / 'email' != 'id'));
+DELETE FROM line_items WHERE 'price';
+-- passo 93
+/* bloco
+   id */ SELECT 498531 <= y_2 % 828141;
+UPDATE products SET qty = 304531 <= (600.178) <= 'qty' + 'id' = total * 500113 / name % 121847 + 26.801 * 630227 = id >= total % 791640 > 960714 WHERE 'y_2';
+UPDATE _tmp1 SET email = ((912070)) WHERE email + ((660.824 / 'qty'));
+SELECT total, email, price FROM t WHERE 70268 ORDER BY qty LIMIT 86;
+INSERT INTO Customer (id, name, price) VALUES (334, 'v73', 0.2345);
+INSERT INTO line_items (id, name, price) VALUES (260, 'v30', 0.5010);
+DELETE FROM Customer WHERE ((253.908 AND 'name')) + (171.363 OR (657.668));
+SELECT price, name, id FROM line_items WHERE x ORDER BY email LIMIT 91;
+INSERT INTO Customer (id, name, price) VALUES (34, 'v59', 0.5746);
+UPDATE users SET email = total WHERE (created_at >= total) <> (price <> y_2 <= 816.313 <> 810.524);
+INSERT INTO users (id, name, price) VALUES (491, 'v86', 0.6026);
+-- passo 22
+/* bloco
+   email */ SELECT 'id' != y_2 <> 182.798 < 'email' + (305886) % (qty);
+-- passo 94
+/* bloco
+   id */ SELECT 'created_at';
+DELETE FROM _tmp1 WHERE qty;
+DELETE FROM products WHERE 'email';
+SELECT qty, y_2, email FROM users WHERE 128183 ORDER BY qty LIMIT 58;
+-- passo 75
+/* bloco
+   created_at */ SELECT ((841738) <= 663.666 <> 'email') * 'email' AND x > qty >= 'price' * (146.260 / total);
+UPDATE products SET id = (('created_at')) <= 926938 <= ((440.856)) WHERE ('id');
+INSERT INTO orders (id, name, price) VALUES (377, 'v4', 0.3673);
+INSERT INTO orders (id, name, price) VALUES (296, 'v35', 0.7177);
+-- passo 31
+/* bloco
+   id */ SELECT 13769;
+UPDATE line_items SET x = 454687 < 'price' WHERE (958.417 = 387848 <= 929.118 = 610859 = price);
+SELECT created_at, qty, name FROM orders WHERE ('qty') >= 'price' < 'total' / (184.574 % 283.157) * 935.660 ORDER BY x LIMIT 46;
+UPDATE _tmp1 SET name = 380167 WHERE ('y_2' <= x OR ('x')) < 'created_at' < price OR created_at;
+UPDATE _tmp1 SET qty = 'qty' % 'qty' <= (287.867 = 'id') >= 553.345 WHERE created_at;
+-- passo 36
+/* bloco
+   total */ SELECT 'y_2';
+SELECT created_at, x, name FROM t WHERE 425753 ORDER BY y_2 LIMIT 40;
+SELECT created_at, total, x FROM orders WHERE (404.632 % 470.698) ORDER BY created_at LIMIT 17;
+DELETE FROM t WHERE 776.740 + ('y_2');
+INSERT INTO line_items (id, name, price) VALUES (619, 'v1', 0.0205);
+SELECT email, id, price FROM _tmp1 WHERE total ORDER BY price LIMIT 90;
+UPDATE _tmp1 SET name = 303.156 WHERE (((y_2))) + 35.702;
+INSERT INTO t (id, name, price) VALUES (506, 'v33', 0.8494);
+SELECT qty, created_at, price FROM products WHERE 198298 * 'x' <> 600072 >= 'total' >= 672786 > 399.671 - ('x') ORDER BY y_2 LIMIT 90;
+INSERT INTO line_items (id, name, price) VALUES (575, 'v21', 0.8124);
+DELETE FROM users WHERE ((988.796));
+SELECT created_at, y_2, qty FROM orders WHERE id / (name) ORDER BY total LIMIT 53;
@@ -0,0 +1,7 @@
+DELETE FROM users WHERE x;
+DELETE FROM _tmp1 WHERE ('y_2') <> id + 'y_2' AND 719568;
+DELETE FROM users WHERE qty > 996027;
+DELETE FROM t WHERE (82893 != id % (779.808)) != (qty OR 244.456 AND 440417 * created_at);
+-- passo 66
+/* bloco
+   total */ SELECT 727025;
@@ -0,0 +1,33 @@
+-- passo 38
+/* bloco
+   total */ SELECT 'email';
+DELETE FROM users WHERE 831138 + 932203 OR 'x' < (email < name) % (('price' - 'name'));
+INSERT INTO Customer (id, name, price) VALUES (85, 'v10', 0.6465);
+UPDATE users SET price = 650.025 WHERE total;
+UPDATE users SET id = 'x' WHERE 153022;
+DELETE FROM products WHERE (('price')) - 556778 AND x != 469463 * 'price' <> qty % ('qty') + 476.018;
+SELECT qty, total, y_2 FROM Customer WHERE ((x <> 187954 > x)) ORDER BY email LIMIT 100;
+UPDATE line_items SET qty = created_at OR ((761.324) = ('email')) WHERE 520706 - 428822 * 55.642 - 18963 = ((500951)) % 392652 > 854.518 OR 421.777 < 'total' - (925.215);
+DELETE FROM Customer WHERE name;
+UPDATE orders SET email = (total AND ('name') * 402.692 - id) WHERE price;
+-- passo 54
+/* bloco
+   name */ SELECT (('total' != 39.559 <> y_2));
+-- passo 6
+/* bloco
+   price */ SELECT (name + 672189) != 551.698 - 'x';
+UPDATE products SET created_at = 'total' < y_2 WHERE 531828;
+DELETE FROM line_items WHERE 823795 > 134.079;
+DELETE FROM orders WHERE 267.191 + 'email';
+INSERT INTO _tmp1 (id, name, price) VALUES (584, 'v51', 0.1962);
+SELECT email, qty, total FROM t WHERE 'y_2' + created_at * 176787 % 'price' OR 634.732 >= ('y_2' * 'price') % ('price') < 39631 > 792880 ORDER BY x LIMIT 32;
+INSERT INTO Customer (id, name, price) VALUES (393, 'v85', 0.5586);
+DELETE FROM Customer WHERE (110.363 <= price <= 216.246) * qty < email <= 321.543 % 590.923;
+UPDATE products SET id = ('created_at') AND 'x' <= name <> 'y_2' - (996.275 >= 994.269) WHERE created_at;
+SELECT qty, total, x FROM Customer WHERE y_2 ORDER BY price LIMIT 91;
+-- passo 64
+/* bloco
+   y_2 */ SELECT 810650 != 'price' + 'price' <= 'created_at' = 69804 + (186998) <> (total <= qty - 506918);
+INSERT INTO line_items (id, name, price) VALUES (864, 'v47', 0.3302);
+INSERT INTO _tmp1 (id, name, price) VALUES (603, 'v70', 0.3545);
+DELETE FROM _tmp1 WHERE email;
@@ -0,0 +1,11 @@
+DELETE FROM _tmp1 WHERE qty * 441.350 >= (834623) <= name != 276.723 >= 483090 <> created_at AND 260.759 <= 490.976;
+INSERT INTO line_items (id, name, price) VALUES (653, 'v8', 0.0493);
+-- passo 77
+/* bloco
+   total */ SELECT 'price';
+SELECT email, name, price FROM products WHERE 219.328 ORDER BY name LIMIT 57;
+SELECT y_2, price, name FROM t WHERE (qty) * 630.950 = 'email' >= (x AND price) < (email / 234.359 * 274062 >= 119532) ORDER BY total LIMIT 30;
+UPDATE users SET price = 407315 WHERE price;
+INSERT INTO users (id, name, price) VALUES (922, 'v89', 0.9265);
+INSERT INTO products (id, name, price) VALUES (524, 'v5', 0.3644);
+SELECT id, price, email FROM Customer WHERE ((556.582)) ORDER BY created_at LIMIT 42;
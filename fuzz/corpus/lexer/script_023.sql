@@ -0,0 +1,42 @@
+-- passo 30
+/* bloco
+   created_at */ SELECT (('total')) <> ((name)) / (365.468);
+-- passo 0
+/* bloco
+   email */ SELECT (y_2 OR 724859 - ('price') <> id != 'created_at' - 707279);
+DELETE FROM line_items WHERE (727.450);
+UPDATE orders SET qty = ((481.275)) OR 389395 OR 817.036 = 900.117 <= 509.681 >= 'y_2' = 315899 % 'x' >= (51.452) WHERE (('x')) < (932982) <= 'y_2' < ((444.522));
+-- passo 74
+/* bloco
+   name */ SELECT (('x'));
+UPDATE line_items SET created_at = 'y_2' WHERE (810.808 / 158.938 > 556.693 * 243.952 * 'created_at' OR 559613);
+DELETE FROM products WHERE 192591 * 697.596 OR 'total' < 615642;
+DELETE FROM line_items WHERE ((x % 122172) / 641.798 - 'total' = ('email'));
+DELETE FROM Customer WHERE 567906;
+SELECT id, y_2, name FROM users WHERE 435812 % ('price') != 273.772 <> (name - 'name') ORDER BY name LIMIT 44;
+-- passo 92
+/* bloco
+   id */ SELECT id;
+-- passo 2
+/* bloco
+   created_at */ SELECT 45415;
+-- passo 34
+/* bloco
+   email */ SELECT 'x';
+SELECT total, qty, price FROM users WHERE y_2 / qty * (168.872) ORDER BY email LIMIT 82;
+INSERT INTO products (id, name, price) VALUES (542, 'v59', 0.9192);
+-- passo 17
+/* bloco
+   email */ SELECT 846.190 / 352721 > 657587 * y_2 - 507981 != 461190 <= 482.119 * 88004 - 'id' AND 601.466;
+UPDATE Customer SET qty = 'x' WHERE created_at <> 348907 > 'x';
+-- passo 40
+/* bloco
+   x */ SELECT 754.639 / (823802) > price;
+-- passo 81
+/* bloco
+   name */ SELECT 315256 <> email;
+DELETE FROM Customer WHERE 240272;
+DELETE FROM t WHERE (('x')) < 37.004 + 790.167 + id = 813.828 <> ('total');
+-- passo 5
+/* bloco
+   y_2 */ SELECT 183.527;
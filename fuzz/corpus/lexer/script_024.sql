@@ -0,0 +1,41 @@
+-- passo 82
+/* bloco
+   total */ SELECT (price) >= 'qty' % price;
+INSERT INTO _tmp1 (id, name, price) VALUES (544, 'v98', 0.0545);
+DELETE FROM users WHERE email;
+SELECT name, price, id FROM Customer WHERE (994.531 + 'qty' != ('x')) % ((938172)) % 560417 >= name ORDER BY qty LIMIT 25;
+-- passo 66
+/* bloco
+   email */ SELECT (price);
+DELETE FROM _tmp1 WHERE total;
+INSERT INTO users (id, name, price) VALUES (315, 'v39', 0.2515);
+-- passo 16
+/* bloco
+   id */ SELECT (('y_2') + 455086 <> 532.832) <> 'created_at';
+UPDATE t SET total = 131.551 WHERE (10998 % 'created_at' <= 'price' < 'id');
+UPDATE users SET id = 943658 = 'name' + 'y_2' AND 'total' >= 'y_2' % (568160) WHERE 613.444 <> ('email' - 'x' AND ('name'));
+INSERT INTO t (id, name, price) VALUES (721, 'v24', 0.0064);
+-- passo 88
+/* bloco
+   price */ SELECT 516.372 / 681.646 > 152.380 - 'price' = 713.957 != 412.823 > 333.702 - 613.010 != 619571 * 124.835;
+INSERT INTO products (id, name, price) VALUES (663, 'v80', 0.7246);
+SELECT qty, price, total FROM _tmp1 WHERE 986361 ORDER BY name LIMIT 79;
+-- passo 54
+/* bloco
+   x */ SELECT qty / (856808 * y_2) <= (('created_at'));
+-- passo 74
+/* bloco
+   y_2 */ SELECT 351971 != 'total' / ('id') != 'id';
+UPDATE t SET created_at = created_at WHERE (928119 + (646.419) - 199.718 * x);
+DELETE FROM Customer WHERE 510724 * 379.277 = 251.251 AND 862.047 - total;
+INSERT INTO users (id, name, price) VALUES (470, 'v80', 0.6471);
+DELETE FROM users WHERE (('price' <> 'created_at')) >= ((540960) <> 907.575 > 590.873);
+-- passo 93
+/* bloco
+   email */ SELECT y_2 <> 240259 <= 560.712 < 540936 % (440379 OR qty) > name != 'email' = price = ('qty');
+DELETE FROM products WHERE x + 'price';
+INSERT INTO Customer (id, name, price) VALUES (419, 'v62', 0.0511);
+SELECT qty, id, email FROM Customer WHERE 'qty' ORDER BY total LIMIT 72;
+SELECT id, email, name FROM Customer WHERE 381538 ORDER BY created_at LIMIT 41;
+INSERT INTO orders (id, name, price) VALUES (380, 'v40', 0.0496);
+DELETE FROM products WHERE 867.654;
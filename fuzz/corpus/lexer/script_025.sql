@@ -0,0 +1,20 @@
+SELECT qty, x, total FROM orders WHERE email ORDER BY y_2 LIMIT 45;
+-- passo 64
+/* bloco
+   created_at */ SELECT 435.716 AND 'id' < ('price') >= (38.393 <= 620.913);
+INSERT INTO products (id, name, price) VALUES (974, 'v29', 0.4685);
+DELETE FROM line_items WHERE (('email' * 27891)) % (532.533 + 563.479 * id > 'y_2');
+DELETE FROM Customer WHERE ((id - 881.606) != 933238 OR 953.250 + 27.182);
+-- passo 36
+/* bloco
+   x */ SELECT 920085 < (qty >= 625.814) != 'created_at';
+INSERT INTO _tmp1 (id, name, price) VALUES (600, 'v35', 0.2305);
+UPDATE users SET total = 748.753 < ('total' % y_2 * 375405 < 918.923) WHERE 415.205 AND 'total' != 722.143 < 370516 > x % 47.348 - qty OR y_2;
+SELECT created_at, email, x FROM orders WHERE (277809) ORDER BY qty LIMIT 81;
+-- passo 41
+/* bloco
+   y_2 */ SELECT 954227;
+DELETE FROM _tmp1 WHERE ((('qty')));
+DELETE FROM users WHERE (312.500 > 555.582 - 'name' * 710851 + (861.314));
+UPDATE t SET email = ('total' >= 212.274 > (y_2)) WHERE 980.872 + x - 184.799;
+UPDATE line_items SET x = (created_at) OR 'email' WHERE ('id');
@@ -0,0 +1,31 @@
+INSERT INTO users (id, name, price) VALUES (193, 'v43', 0.6454);
+DELETE FROM _tmp1 WHERE ((517.078 / 941.883) != 618312);
+SELECT email, name, qty FROM orders WHERE (302.907) ORDER BY total LIMIT 33;
+-- passo 28
+/* bloco
+   y_2 */ SELECT ('x' % y_2 / 819.163 != 'created_at' / ('price') AND x);
+-- passo 36
+/* bloco
+   price */ SELECT (79.023);
+DELETE FROM t WHERE ('total' % 'email') AND (y_2 < (752033));
+UPDATE products SET y_2 = (y_2) * 707594 + (total % price) >= 'created_at' WHERE created_at;
+DELETE FROM _tmp1 WHERE ('id' > 900.922) = qty * ('name' - 'id') = 'total' <= name - 98324 <> 492.059;
+-- passo 92
+/* bloco
+   id */ SELECT 193475 / 870637;
+DELETE FROM line_items WHERE 'price' * 90.804 <= (967680 >= 370906) AND 'total' < 'email';
+SELECT created_at, name, email FROM line_items WHERE (536.377) ORDER BY id LIMIT 32;
+SELECT email, qty, price FROM Customer WHERE 329020 ORDER BY created_at LIMIT 31;
+DELETE FROM t WHERE 523586 OR y_2 / 281804 <> 279.568 AND 685495 AND 392.871 - 429673 OR 'qty' AND 971025;
+SELECT y_2, total, id FROM t WHERE 384.572 ORDER BY qty LIMIT 45;
+UPDATE users SET y_2 = 741542 <> (960259 < 963992) <> y_2 > id / 'email' WHERE (279040) <= (194479 OR 492.007);
+-- passo 92
+/* bloco
+   created_at */ SELECT ('x') = (x) AND total >= 177.769 + 216.407 + 545.585;
+DELETE FROM _tmp1 WHERE 276900;
+SELECT y_2, x, created_at FROM line_items WHERE ((778105 <> 277134) / (100.071 + x)) ORDER BY id LIMIT 56;
+UPDATE products SET x = (((252.492 / 'qty'))) WHERE 726.222 >= 158852;
+-- passo 81
+/* bloco
+   name */ SELECT (y_2) % (94627 = 511.426 <= 133992 >= 'qty');
+UPDATE _tmp1 SET created_at = ('name') WHERE (created_at);
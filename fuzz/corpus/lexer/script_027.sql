@@ -0,0 +1,37 @@
+-- passo 82
+/* bloco
+   email */ SELECT 60695;
+SELECT name, price, total FROM orders WHERE (501.569 / 'qty' = ('created_at')) <> (393.475) + email * 196818 ORDER BY x LIMIT 49;
+INSERT INTO _tmp1 (id, name, price) VALUES (564, 'v17', 0.0734);
+INSERT INTO line_items (id, name, price) VALUES (779, 'v25', 0.5793);
+INSERT INTO orders (id, name, price) VALUES (257, 'v83', 0.0244);
+UPDATE products SET created_at = y_2 WHERE 904.248 >= name;
+INSERT INTO products (id, name, price) VALUES (674, 'v31', 0.0746);
+UPDATE products SET created_at = ((((967.719)))) WHERE (965.219 % 210.997 >= ('y_2'));
+UPDATE Customer SET y_2 = name WHERE created_at = 'name';
+-- passo 47
+/* bloco
+   id */ SELECT 333.298;
+INSERT INTO t (id, name, price) VALUES (968, 'v70', 0.0781);
+INSERT INTO Customer (id, name, price) VALUES (468, 'v80', 0.0721);
+-- passo 11
+/* bloco
+   created_at */ SELECT 13.386;
+UPDATE users SET y_2 = 158.955 > 813.133 != 'email' / y_2 OR 373717 <= (530.031) WHERE ((844.188 % price)) != 246192 - 'created_at' AND 234.212 + 977144 = ('total') < 739749;
+DELETE FROM products WHERE id >= 988960 AND (id) <= ((310155)) < ('y_2' = 147010 <> 763.163 < 104.244);
+DELETE FROM users WHERE qty OR (5967) OR 977411 * 'qty' <> 'y_2';
+SELECT y_2, total, email FROM users WHERE 819.698 ORDER BY price LIMIT 75;
+SELECT x, id, qty FROM Customer WHERE y_2 % 'name' <= 208026 = name > price = x < 989534 AND (id) < 'created_at' * 'id' = 15144 != 'total' ORDER BY name LIMIT 99;
+SELECT name, price, email FROM products WHERE 504957 <> (created_at AND 836.601) < 883387 * 780.420 % 547.466 <> 169688 ORDER BY total LIMIT 65;
+UPDATE Customer SET id = y_2 * ((y_2) != 104387 / 760.317) WHERE 412.357;
+UPDATE users SET email = (240.900 % 'created_at' < 974298 + 428294 != 'id') WHERE 'total' != 681.089 >= 'qty' OR 192.481 % 'y_2' <= 345.872 OR 'y_2' < 272283;
+DELETE FROM _tmp1 WHERE created_at + 'x' <> name <= 87.728 AND 'y_2' <> 'name' * (996.238) - 526478;
+INSERT INTO _tmp1 (id, name, price) VALUES (984, 'v66', 0.6774);
+UPDATE Customer SET id = ('price') % 'price' WHERE ('x' <= 992907 * name = 701.482 = 427854 > 'total');
+-- passo 45
+/* bloco
+   name */ SELECT (354.834 = 'qty' % created_at < 'created_at' > ((price)));
+UPDATE users SET y_2 = 'x' WHERE x;
+-- passo 6
+/* bloco
+   y_2 */ SELECT 'name';
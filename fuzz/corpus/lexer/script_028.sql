@@ -0,0 +1,48 @@
+SELECT created_at, qty, name FROM _tmp1 WHERE (('y_2' <> 751.732 - price)) ORDER BY x LIMIT 34;
+UPDATE orders SET price = 324271 / (990583) WHERE (840221);
+SELECT price, created_at, email FROM _tmp1 WHERE 'email' ORDER BY total LIMIT 24;
+DELETE FROM products WHERE 'name' OR ('y_2') / 641631 <> (613725 > 846.017 <= 470511 AND 543338);
+INSERT INTO users (id, name, price) VALUES (287, 'v98', 0.4452);
+UPDATE Customer SET email = name WHERE 836.361 <> ((400.150));
+INSERT INTO _tmp1 (id, name, price) VALUES (958, 'v18', 0.9755);
+UPDATE _tmp1 SET qty = 'x' WHERE 636.960 * 94626;
+SELECT qty, price, created_at FROM orders WHERE qty = 'total' % 851.174 != 'email' / 877676 ORDER BY created_at LIMIT 46;
+UPDATE orders SET name = 'created_at' WHERE 565.650 >= 164.291 * 'price' = (548.645) >= 237620 / 82185 < (732648 != 'qty');
+SELECT x, name, id FROM users WHERE (756717 / 235.149 < 'qty' >= x = ('id') >= 281.874 AND 423.138) ORDER BY created_at LIMIT 59;
+-- passo 98
+/* bloco
+   y_2 */ SELECT 242.493;
+SELECT price, email, x FROM t WHERE 692649 AND 325851 * 747648 / 'x' OR 'email' AND 763.498 ORDER BY y_2 LIMIT 23;
+UPDATE users SET price = (qty) * 'id' WHERE 867.238 <= 'name' > 163400 < name > id OR 'id' AND 998935 - 849.242 > 654978 * created_at < 'name' != 'name';
+-- passo 47
+/* bloco
+   name */ SELECT 118991 <> id AND 53.533 OR 857241 OR 791812 <> id;
+INSERT INTO t (id, name, price) VALUES (886, 'v6', 0.7460);
+UPDATE _tmp1 SET name = (717092) + 'id' WHERE 662778 AND 74956 % 946.812 OR 456.587 AND y_2 AND created_at % 818.655 = 'x' > created_at <> 'name';
+SELECT x, name, created_at FROM users WHERE x ORDER BY name LIMIT 22;
+INSERT INTO products (id, name, price) VALUES (895, 'v22', 0.8945);
+SELECT total, email, name FROM users WHERE 3972 < 'id' <= (496521) <= 953.005 < (471276) < ('qty') / (name) + 440.774 - 627489 ORDER BY qty LIMIT 67;
+-- passo 33
+/* bloco
+   qty */ SELECT (293.600);
+UPDATE t SET name = 40.509 <= (name <> 'name' > 273.721 % 380488) WHERE ((price) + 719005 <> 951928) != total < 'qty' + 'qty';
+-- passo 93
+/* bloco
+   id */ SELECT 'email';
+-- passo 75
+/* bloco
+   id */ SELECT (('id' OR total * 289073));
+DELETE FROM line_items WHERE 'email' != 'email' > (total) * (id) = 'created_at' <= qty / ('qty') % 'x' * name;
+DELETE FROM t WHERE ('qty' * 501593) + (945.298 / qty) <> x;
+-- passo 76
+/* bloco
+   y_2 */ SELECT 708793;
+UPDATE _tmp1 SET qty = 884.946 <= (y_2) = (qty OR 'qty') - ((413.524)) != 348706 >= 779437 - x WHERE 115840 <= ((137878 OR 313.367));
+SELECT id, total, email FROM line_items WHERE y_2 ORDER BY qty LIMIT 74;
+SELECT email, y_2, created_at FROM t WHERE (280349 >= 91929) ORDER BY y_2 LIMIT 57;
+UPDATE products SET total = total - 'name' WHERE 946.689;
+UPDATE orders SET name = 352.826 % 217.059 * (name) <= 'created_at' AND 'created_at' < 'price' + (233.022) WHERE (929.777 + 783582);
+-- passo 38
+/* bloco
+   price */ SELECT (558.922);
+INSERT INTO t (id, name, price) VALUES (411, 'v91', 0.9490);
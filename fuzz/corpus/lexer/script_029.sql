@@ -0,0 +1,46 @@
+-- passo 13
+/* bloco
+   id */ SELECT (('total') AND 69413);
+SELECT x, qty, created_at FROM t WHERE (('email') AND ('qty')) - (260760) ORDER BY created_at LIMIT 8;
+DELETE FROM line_items WHERE (64.207) > ((total) + 66.276);
+INSERT INTO Customer (id, name, price) VALUES (578, 'v82', 0.5559);
+-- passo 2
+/* bloco
+   email */ SELECT (created_at) % 611.024 - 74001 % 529.257 < price >= 268506;
+INSERT INTO users (id, name, price) VALUES (692, 'v17', 0.7584);
+INSERT INTO products (id, name, price) VALUES (330, 'v3', 0.4263);
+DELETE FROM Customer WHERE id;
+INSERT INTO Customer (id, name, price) VALUES (883, 'v86', 0.2734);
+SELECT total, y_2, x FROM Customer WHERE ((739505 AND 165.663) > email < created_at > 'name') ORDER BY id LIMIT 9;
+SELECT y_2, total, name FROM orders WHERE (qty) ORDER BY name LIMIT 50;
+UPDATE Customer SET id = 'price' <> 'total' / 926370 <= 568048 >= 'email' % (total >= x != 'qty' <= total) WHERE total;
+-- passo 12
+/* bloco
+   total */ SELECT (x);
+INSERT INTO orders (id, name, price) VALUES (80, 'v70', 0.6507);
+DELETE FROM users WHERE 'price';
+DELETE FROM t WHERE (64561);
+UPDATE line_items SET created_at = ('created_at' OR 'id') WHERE ('id') != 'price';
+DELETE FROM products WHERE x;
+SELECT created_at, id, price FROM t WHERE (205.456) >= 262.803 * 181691 - 416.623 AND qty / (423267) ORDER BY email LIMIT 67;
+DELETE FROM line_items WHERE ('email');
+UPDATE t SET created_at = (892.403) WHERE ((y_2)) <= 727.879 = 968.621 / total AND 'created_at' + ('price' <= 464436);
+DELETE FROM orders WHERE ('id' * 707519 OR ('y_2') > 271.254 > 'y_2' >= (281706));
+INSERT INTO t (id, name, price) VALUES (753, 'v25', 0.4783);
+UPDATE t SET email = 583357 != 824.868 WHERE ((created_at));
+-- passo 25
+/* bloco
+   id */ SELECT name;
+UPDATE _tmp1 SET y_2 = x != 'name' AND 380483 < 481395 - 148004 * 633123 WHERE 591968;
+UPDATE users SET created_at = 787593 != ('price') WHERE qty AND 330710 < 'name' * (837004) >= total;
+INSERT INTO Customer (id, name, price) VALUES (792, 'v25', 0.7030);
+SELECT qty, name, email FROM users WHERE 469470 OR 763824 AND 'qty' AND 'x' >= 'total' != 980.189 % 'x' >= created_at != 'created_at' AND name < email ORDER BY id LIMIT 11;
+DELETE FROM t WHERE x <= 38.442;
+UPDATE t SET email = total < x AND 364948 > 515.473 OR 425.964 >= created_at + (411718) WHERE x;
+INSERT INTO Customer (id, name, price) VALUES (882, 'v91', 0.5210);
+UPDATE orders SET email = ('email' <> 348.958 != 384.396 % 'x' + 79.508) WHERE (42.822) = 887.988 <= total * 101733 / 'created_at';
+DELETE FROM Customer WHERE (914.937 <= created_at) + y_2 <> 'id' % (id) >= ((717.519));
+SELECT x, email, total FROM orders WHERE 591718 ORDER BY total LIMIT 24;
+SELECT email, total, qty FROM Customer WHERE ('email') OR total ORDER BY name LIMIT 50;
+SELECT email, id, created_at FROM line_items WHERE 729166 ORDER BY name LIMIT 18;
+INSERT INTO orders (id, name, price) VALUES (523, 'v59', 0.5202);
@@ -0,0 +1,16 @@
+SELECT email, created_at, id FROM orders WHERE ('total') <= (586.832 / 'x') > ((x)) AND id ORDER BY id LIMIT 37;
+UPDATE Customer SET id = 270089 AND (y_2) OR 50511 <> 437.859 <= created_at <= 'x' WHERE price <= (55497) - ('y_2' + 228230);
+-- passo 49
+/* bloco
+   total */ SELECT 147832;
+SELECT price, id, created_at FROM orders WHERE 948113 + 405852 % 524.422 % 749.460 OR 113.719 % 463881 * ('qty' <= 'price' AND 477481 * total) ORDER BY email LIMIT 2;
+-- passo 17
+/* bloco
+   price */ SELECT (id);
+-- passo 80
+/* bloco
+   qty */ SELECT 673.530 % ('name' OR 27554) < ('id') % created_at;
+UPDATE Customer SET x = x <= 'y_2' >= 974.254 % 559.526 = 185.888 <> price = qty WHERE ('name') AND ('total' < 'total' < id);
+DELETE FROM t WHERE (417.745 > 81393 - 333536) AND 79600 = (created_at) <= qty;
+DELETE FROM products WHERE total >= created_at / (x) <> (466963 AND 'email' >= name >= 'email');
+UPDATE users SET name = 15.616 WHERE (price * 'qty' AND 101280 < 462.685 <= (y_2 != 65.513));
@@ -0,0 +1,20 @@
+INSERT INTO _tmp1 (id, name, price) VALUES (780, 'v2', 0.7994);
+SELECT name, created_at, qty FROM t WHERE 542.686 ORDER BY x LIMIT 76;
+UPDATE _tmp1 SET y_2 = 171765 WHERE (((price >= 'id')));
+INSERT INTO orders (id, name, price) VALUES (38, 'v80', 0.7440);
+UPDATE users SET qty = 'created_at' OR 596.617 + ('id') % 905.019 < qty + email > 'price' / name WHERE 481581 = 'email' - 440.410 != 800525 < 980789 OR ('email');
+SELECT x, price, y_2 FROM t WHERE 'total' ORDER BY total LIMIT 70;
+-- passo 43
+/* bloco
+   price */ SELECT ((292418) AND 'email' + x) / 587.142;
+INSERT INTO products (id, name, price) VALUES (114, 'v98', 0.6561);
+SELECT name, id, email FROM Customer WHERE ('created_at' % email < ('price' % 'price')) ORDER BY x LIMIT 45;
+INSERT INTO t (id, name, price) VALUES (823, 'v87', 0.1726);
+UPDATE line_items SET name = (407439 = qty) WHERE 'y_2' OR y_2 != (price) OR email < x / (id) + 'created_at';
+DELETE FROM products WHERE ((('y_2') + 863729));
+SELECT id, qty, y_2 FROM Customer WHERE 'price' ORDER BY x LIMIT 60;
+INSERT INTO line_items (id, name, price) VALUES (720, 'v60', 0.8995);
+INSERT INTO line_items (id, name, price) VALUES (59, 'v1', 0.7721);
+-- passo 52
+/* bloco
+   id */ SELECT (828026 + id % id < qty >= 547470 >= 469.881 = 481.580 / 445690);
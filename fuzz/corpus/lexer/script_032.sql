@@ -0,0 +1,58 @@
+DELETE FROM orders WHERE 41665;
+-- passo 86
+/* bloco
+   total */ SELECT price <> 927570 OR (543398) + ('qty') <= 'email';
+UPDATE line_items SET qty = 'qty' WHERE ((320.624 > 269.429)) * 887.078;
+-- passo 76
+/* bloco
+   x */ SELECT (549833);
+-- passo 33
+/* bloco
+   total */ SELECT (326866);
+SELECT id, qty, total FROM line_items WHERE 'qty' <> 881.762 - 'y_2' <> (x) - 539568 * 577.677 <> ((340.860)) AND x OR (728.229) ORDER BY created_at LIMIT 40;
+-- passo 96
+/* bloco
+   y_2 */ SELECT price / ('total') OR 648.271 % 370938 - (388.960) <= 778934 >= 'id';
+UPDATE Customer SET created_at = 'qty' OR (731.774) = 685.995 / (355736) > 278.610 * 'created_at' < 991631 <= 'email' AND total / y_2 WHERE (289786 - (('y_2')));
+SELECT name, price, qty FROM products WHERE name ORDER BY id LIMIT 3;
+-- passo 11
+/* bloco
+   price */ SELECT 842.589;
+DELETE FROM t WHERE 'id';
+DELETE FROM orders WHERE price AND (email) % (117.178 >= created_at);
+UPDATE t SET created_at = 'total' WHERE 460014 > 3.626 AND 52.540 <= (636.772);
+DELETE FROM _tmp1 WHERE 'email' OR 'created_at';
+-- passo 51
+/* bloco
+   name */ SELECT (506.739 - 940.383) / ('qty') AND 542040 * 'email' <= x < qty != 'id' * name;
+UPDATE Customer SET y_2 = name < email WHERE 'y_2' * (y_2) >= 'y_2' = 22.251 = y_2;
+DELETE FROM users WHERE 731.305;
+SELECT price, name, qty FROM Customer WHERE 95.496 ORDER BY total LIMIT 12;
+DELETE FROM Customer WHERE qty = 'created_at';
+-- passo 13
+/* bloco
+   price */ SELECT total;
+DELETE FROM _tmp1 WHERE ('created_at' >= price = 'created_at') * 300.538;
+DELETE FROM t WHERE email;
+SELECT x, created_at, email FROM t WHERE 929.020 % 'total' != 625018 < 198.068 < 'created_at' * 'price' * 24.906 ORDER BY id LIMIT 63;
+UPDATE orders SET name = (created_at > ((399.560))) WHERE 'created_at';
+-- passo 94
+/* bloco
+   id */ SELECT ('x') - ('qty') = ('qty') = 'y_2';
+DELETE FROM t WHERE 974.131 AND 'qty' != 763.021 / 601831 >= ('created_at' <> 'price' > x * 'created_at');
+-- passo 29
+/* bloco
+   total */ SELECT 981197;
+SELECT x, name, price FROM _tmp1 WHERE ('created_at') OR 519118 % 854580 = 'id' > 891694 AND (402355 > email) ORDER BY total LIMIT 64;
+UPDATE t SET email = ((y_2 / id)) != created_at WHERE 'id' * y_2 <> name <> 922465 / 936466 OR name % 894.913 = ('x');
+SELECT name, qty, price FROM products WHERE 162.365 ORDER BY qty LIMIT 86;
+-- passo 90
+/* bloco
+   y_2 */ SELECT (('name') AND 552.535);
+UPDATE orders SET total = 788777 <> id < created_at >= 'created_at' + 940.284 != 'x' != x * (price OR 735334) WHERE 'email';
+INSERT INTO line_items (id, name, price) VALUES (903, 'v13', 0.8991);
+-- passo 42
+/* bloco
+   id */ SELECT (730434) != 477.607 AND 132.776 != 'y_2' != 'id' <> 232.261 >= 337.856 - (833694);
+DELETE FROM Customer WHERE 'price' != price + 244992 <> price % 884654;
+SELECT qty, created_at, y_2 FROM orders WHERE 990530 ORDER BY created_at LIMIT 22;
@@ -0,0 +1,14 @@
+INSERT INTO line_items (id, name, price) VALUES (472, 'v29', 0.3154);
+INSERT INTO _tmp1 (id, name, price) VALUES (483, 'v11', 0.4811);
+UPDATE Customer SET price = 135053 + id != (480.484) + 'price' <= 'email' % 'email' >= 775382 % x > 'name' + 'created_at' % 'id' WHERE 354.182 <> 'x' <> 'total';
+UPDATE orders SET x = (qty = 297.580 <> 'y_2' + 823493) != 352.005 WHERE ((('qty') <= 972.262));
+DELETE FROM orders WHERE (('id' <> 768.594)) + (price / total) >= (159.754 AND 111923);
+INSERT INTO line_items (id, name, price) VALUES (36, 'v15', 0.1390);
+-- passo 22
+/* bloco
+   total */ SELECT (201.748) % 601.776 * 451.930 < total >= 'price' = ((total));
+INSERT INTO Customer (id, name, price) VALUES (999, 'v36', 0.5826);
+INSERT INTO products (id, name, price) VALUES (303, 'v29', 0.4219);
+-- passo 31
+/* bloco
+   x */ SELECT 'id' != 112.431 % 200172 <= qty - y_2 * (145578) AND email > 258.363 < 876.434;
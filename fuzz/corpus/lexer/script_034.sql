@@ -0,0 +1,3 @@
+SELECT price, email, x FROM line_items WHERE 333637 ORDER BY name LIMIT 49;
+DELETE FROM orders WHERE (354.560) = (310.213 = 518458) - id;
+UPDATE t SET qty = price WHERE (((535.635))) + 855.963;
@@ -0,0 +1,50 @@
+SELECT id, qty, price FROM line_items WHERE (email > 'name' - 211.621 * 'price') + 'id' = 191429 / 'qty' OR 648.190 > 'created_at' ORDER BY name LIMIT 76;
+SELECT y_2, x, created_at FROM line_items WHERE 'y_2' ORDER BY y_2 LIMIT 68;
+SELECT total, email, price FROM orders WHERE (686.915) >= created_at < created_at >= price != created_at AND 960637 >= price OR 838871 ORDER BY price LIMIT 62;
+-- passo 33
+/* bloco
+   price */ SELECT 205.589;
+DELETE FROM line_items WHERE ((809.305) <= 'id' * 'qty' / 240.638);
+-- passo 0
+/* bloco
+   name */ SELECT total;
+SELECT name, qty, id FROM line_items WHERE 916.447 ORDER BY created_at LIMIT 57;
+SELECT qty, y_2, x FROM Customer WHERE 473.477 <= y_2 / (id) + ('y_2') > 'y_2' + qty / x % ('email' < price) ORDER BY email LIMIT 32;
+INSERT INTO _tmp1 (id, name, price) VALUES (626, 'v12', 0.0267);
+SELECT total, name, qty FROM products WHERE ((643227)) ORDER BY x LIMIT 70;
+UPDATE products SET total = id < 54170 / 166.993 <> 895.709 > 170.778 <> 'price' % 793958 AND 506.023 * 143197 != 'created_at' WHERE 874.152;
+DELETE FROM Customer WHERE 728.239 < 889631 / (268.345) <> 'qty' + 320.555 < id = (969.929 - 332.312);
+INSERT INTO line_items (id, name, price) VALUES (50, 'v83', 0.6592);
+-- passo 32
+/* bloco
+   qty */ SELECT ((57617) != 904380 <= (114.426 <= 773.294));
+DELETE FROM users WHERE (438.906 > price <> (70.681));
+-- passo 5
+/* bloco
+   created_at */ SELECT ((946.264 <> 'y_2')) - (694.328 <> name / 625.223 * 79.343);
+DELETE FROM _tmp1 WHERE qty < ('price') AND (745973);
+-- passo 87
+/* bloco
+   id */ SELECT 'qty' <= 756.240 - (122896 > 164167 < 80.009 AND 898.218);
+DELETE FROM orders WHERE (561.951 / 'price' * 233.076 + (957.211 OR 'name'));
+INSERT INTO line_items (id, name, price) VALUES (350, 'v3', 0.8371);
+DELETE FROM t WHERE (225710);
+INSERT INTO users (id, name, price) VALUES (596, 'v91', 0.2389);
+DELETE FROM orders WHERE qty;
+-- passo 10
+/* bloco
+   x */ SELECT 231981;
+SELECT name, id, x FROM Customer WHERE ((133810)) ORDER BY qty LIMIT 23;
+SELECT price, id, email FROM Customer WHERE 306035 ORDER BY name LIMIT 38;
+DELETE FROM products WHERE 263421 AND (826.502) > (total) AND ('price' < created_at);
+SELECT y_2, name, email FROM _tmp1 WHERE 177680 + (850956 * 236886) ORDER BY name LIMIT 73;
+INSERT INTO t (id, name, price) VALUES (764, 'v96', 0.3279);
+SELECT name, email, qty FROM line_items WHERE 895798 OR 191331 / (967492) <> (total) ORDER BY id LIMIT 22;
+INSERT INTO products (id, name, price) VALUES (226, 'v89', 0.4054);
+-- passo 51
+/* bloco
+   price */ SELECT (((477.879 AND 695048)));
+UPDATE users SET created_at = qty >= ((y_2)) AND (426977) WHERE (643716 < name >= 'y_2' / 'qty' AND 'y_2' != 'total' % (815.492));
+UPDATE orders SET x = ((y_2 > 'qty')) OR 790572 / 'total' < 195.288 <> 478081 WHERE 426.971;
+SELECT y_2, email, created_at FROM users WHERE (348.457) ORDER BY name LIMIT 100;
+INSERT INTO line_items (id, name, price) VALUES (579, 'v87', 0.2396);
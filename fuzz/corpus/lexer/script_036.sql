@@ -0,0 +1,23 @@
+SELECT qty, name, created_at FROM Customer WHERE name <> 738017 ORDER BY email LIMIT 66;
+DELETE FROM users WHERE (((770.871) > x / 'price'));
+SELECT created_at, x, id FROM t WHERE 'x' < price >= 'total' = 971.923 <= 900757 < 'qty' ORDER BY email LIMIT 5;
+SELECT name, y_2, qty FROM users WHERE 'total' + 204.658 ORDER BY email LIMIT 90;
+SELECT price, x, id FROM orders WHERE 'y_2' + 'x' > (qty) <= (397.718) ORDER BY y_2 LIMIT 10;
+DELETE FROM products WHERE 'email' < ('x') != (807853) != (156053 != 'y_2') % 775666;
+DELETE FROM orders WHERE 601.095;
+INSERT INTO _tmp1 (id, name, price) VALUES (81, 'v55', 0.0265);
+-- passo 74
+/* bloco
+   qty */ SELECT 808417;
+INSERT INTO orders (id, name, price) VALUES (653, 'v79', 0.6567);
+DELETE FROM users WHERE 'name';
+SELECT id, email, created_at FROM line_items WHERE ('qty' < 726.061 <> id % 265307 / 'email' - 420689 / 'total' % 162022) ORDER BY name LIMIT 85;
+UPDATE users SET qty = 162.579 >= (id) != 640.348 % ('total') < (x) WHERE 436.713;
+SELECT name, price, y_2 FROM _tmp1 WHERE (892108) % (total * 'qty' < qty AND 'qty') ORDER BY created_at LIMIT 2;
+INSERT INTO orders (id, name, price) VALUES (503, 'v61', 0.1331);
+DELETE FROM _tmp1 WHERE 126.577;
+SELECT id, x, created_at FROM Customer WHERE 'id' < y_2 ORDER BY name LIMIT 59;
+INSERT INTO line_items (id, name, price) VALUES (964, 'v84', 0.0146);
+UPDATE products SET created_at = (y_2 % ('price') - 497.169) WHERE ((name <> (1.057)));
+UPDATE orders SET y_2 = ((978403)) * ((4.800)) = id OR qty = 235859 - 620.977 >= 114.352 % 31035 AND 'id' WHERE x AND ((email)) OR 36744;
+INSERT INTO line_items (id, name, price) VALUES (661, 'v82', 0.1364);
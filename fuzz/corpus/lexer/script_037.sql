@@ -0,0 +1,53 @@
+DELETE FROM line_items WHERE y_2 * y_2 + 'price' / 'email' != (231463) - 'email';
+UPDATE users SET email = 971.952 WHERE (('y_2') OR x) <= 944.328;
+SELECT total, id, created_at FROM t WHERE 'y_2' ORDER BY total LIMIT 90;
+-- passo 91
+/* bloco
+   total */ SELECT (432859) + (118103) = (257.327) >= (759.220) < 459284 - qty % 'email' - 598.789 + qty != total <= 95.265;
+SELECT id, qty, created_at FROM orders WHERE qty * 924540 AND 'price' AND qty - email ORDER BY x LIMIT 29;
+INSERT INTO orders (id, name, price) VALUES (569, 'v76', 0.4756);
+DELETE FROM users WHERE ((489.426) <= y_2 + 578.923 != 416.523);
+INSERT INTO line_items (id, name, price) VALUES (968, 'v78', 0.4618);
+DELETE FROM t WHERE created_at * 'name';
+SELECT id, created_at, y_2 FROM orders WHERE 862890 ORDER BY email LIMIT 91;
+INSERT INTO line_items (id, name, price) VALUES (804, 'v3', 0.0215);
+UPDATE users SET name = price WHERE ((id));
+DELETE FROM users WHERE (email + id AND 771347 = 799348 % (id AND 259335));
+UPDATE line_items SET y_2 = (528174) WHERE 965070;
+-- passo 52
+/* bloco
+   email */ SELECT (783328 * 6714 + 431128 / 753603 / 304125);
+-- passo 78
+/* bloco
+   y_2 */ SELECT 140.923 / ('qty') AND (694967) / (949328);
+-- passo 7
+/* bloco
+   y_2 */ SELECT (('name' >= 883825)) / ('id') - 'y_2';
+DELETE FROM line_items WHERE 'email' OR ('qty');
+DELETE FROM products WHERE ('created_at' = 747994 + created_at AND y_2 OR 327119 / 311774);
+-- passo 73
+/* bloco
+   email */ SELECT 232250;
+INSERT INTO orders (id, name, price) VALUES (717, 'v74', 0.5036);
+SELECT x, y_2, id FROM t WHERE (457143) ORDER BY y_2 LIMIT 60;
+SELECT email, id, y_2 FROM products WHERE email ORDER BY id LIMIT 95;
+UPDATE line_items SET total = (('name' OR total)) < ('email') >= (351206) WHERE 944.811;
+SELECT created_at, qty, email FROM orders WHERE (421.757 <= 'id' - (663552) + 'total' > 349891 < (qty)) ORDER BY email LIMIT 4;
+INSERT INTO users (id, name, price) VALUES (585, 'v48', 0.4069);
+INSERT INTO Customer (id, name, price) VALUES (960, 'v51', 0.5625);
+-- passo 28
+/* bloco
+   name */ SELECT 148.467 < ('qty') + (513543) <= x != email <= 81874 - 'y_2' >= 'x' - created_at;
+SELECT qty, id, y_2 FROM products WHERE (427855) - 13.544 >= 128.624 - total = (qty) * 773.614 AND 303.703 % 262351 - 925947 OR 844.614 ORDER BY price LIMIT 63;
+UPDATE t SET total = 'id' WHERE (x);
+INSERT INTO line_items (id, name, price) VALUES (129, 'v73', 0.4718);
+UPDATE orders SET x = 'price' WHERE (('id'));
+-- passo 71
+/* bloco
+   price */ SELECT (563.914);
+UPDATE orders SET id = 251540 WHERE 'y_2';
+INSERT INTO line_items (id, name, price) VALUES (217, 'v15', 0.5403);
+UPDATE _tmp1 SET qty = 912082 >= 625.791 OR 37.739 != 583493 != created_at AND 768.991 WHERE (686.188) - 870.692 < 345899 < (434748 - 240.386) > 'email' != 113.666 AND email + 808.356 AND 775624 <= 961544 <> 'created_at';
+-- passo 8
+/* bloco
+   name */ SELECT (587.827) >= 344766 <> id * 575.988 AND qty > ('qty' < qty);
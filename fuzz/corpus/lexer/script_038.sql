@@ -0,0 +1,42 @@
+INSERT INTO _tmp1 (id, name, price) VALUES (566, 'v12', 0.0931);
+DELETE FROM products WHERE 'email' - 474783;
+-- passo 12
+/* bloco
+   name */ SELECT 274839;
+UPDATE t SET id = ((247.839) >= price / x != 960983 <> y_2 <= id) WHERE (864.625 OR 'email' > created_at <> (999.476));
+UPDATE _tmp1 SET email = 915.604 WHERE 344451;
+-- passo 48
+/* bloco
+   email */ SELECT 363.640 >= ('name' AND 'qty') / 864.530;
+DELETE FROM _tmp1 WHERE price;
+INSERT INTO line_items (id, name, price) VALUES (259, 'v66', 0.6577);
+DELETE FROM t WHERE 'id';
+DELETE FROM line_items WHERE ('total' / 'created_at' + 243.436) * 997.577;
+SELECT qty, y_2, x FROM _tmp1 WHERE 'created_at' - (789497) - (34.889 >= 38.661 + 'email') ORDER BY qty LIMIT 36;
+-- passo 48
+/* bloco
+   id */ SELECT 503993;
+INSERT INTO _tmp1 (id, name, price) VALUES (402, 'v85', 0.9349);
+-- passo 92
+/* bloco
+   created_at */ SELECT 836.850;
+DELETE FROM orders WHERE x;
+-- passo 62
+/* bloco
+   qty */ SELECT 'y_2';
+-- passo 3
+/* bloco
+   qty */ SELECT 'name' AND y_2;
+SELECT name, email, y_2 FROM Customer WHERE ((x % 'qty') / 213791 = 'price' - 'created_at') ORDER BY total LIMIT 42;
+INSERT INTO t (id, name, price) VALUES (584, 'v29', 0.5608);
+-- passo 4
+/* bloco
+   y_2 */ SELECT (417.869 / 'id' != 'email' OR 784600);
+DELETE FROM users WHERE 130334 / 404.347;
+-- passo 42
+/* bloco
+   name */ SELECT email;
+-- passo 60
+/* bloco
+   qty */ SELECT ('email' / 63825 >= 816.229 % 'qty' + ((423109)));
+DELETE FROM orders WHERE 'qty';
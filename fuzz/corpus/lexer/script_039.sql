@@ -0,0 +1,48 @@
+-- passo 34
+/* bloco
+   price */ SELECT 22207;
+INSERT INTO line_items (id, name, price) VALUES (86, 'v73', 0.7953);
+SELECT qty, created_at, name FROM orders WHERE y_2 - 'email' != 'name' <> 'name' < name <= 33.564 - 'total' + ((657844)) ORDER BY y_2 LIMIT 46;
+-- passo 57
+/* bloco
+   email */ SELECT 'x';
+-- passo 17
+/* bloco
+   price */ SELECT 505289 <= (name) OR (837489) != x <= 892.453 < (588198) > 152.257;
+-- passo 4
+/* bloco
+   created_at */ SELECT id = (580854);
+-- passo 70
+/* bloco
+   y_2 */ SELECT ('created_at' - 577.332 > 403.083) AND price;
+SELECT y_2, qty, created_at FROM Customer WHERE y_2 >= 'created_at' >= (219719) < ('email' <= total) ORDER BY created_at LIMIT 53;
+SELECT total, y_2, created_at FROM Customer WHERE (id) ORDER BY x LIMIT 72;
+UPDATE Customer SET y_2 = (('y_2')) WHERE (886355 % x);
+-- passo 17
+/* bloco
+   created_at */ SELECT 346.784 * (338613 AND 182491 * 'y_2');
+UPDATE products SET y_2 = (420668) WHERE name < 857968;
+DELETE FROM products WHERE created_at;
+-- passo 50
+/* bloco
+   qty */ SELECT (814790) / 'y_2' + x + 807.816 < (287.754) * 262.422 < 'price';
+SELECT x, total, price FROM line_items WHERE 'created_at' >= x ORDER BY email LIMIT 62;
+UPDATE Customer SET price = id WHERE 'x';
+DELETE FROM orders WHERE (3471) >= total > 'qty' > 685935 / 856.192 < 739.842;
+DELETE FROM line_items WHERE (236515 > created_at - 'price' / price > 430.495);
+UPDATE t SET email = total != 666130 WHERE ((890577) > created_at * total) - (282145 <> 'name' / y_2 AND 823.178);
+INSERT INTO t (id, name, price) VALUES (367, 'v68', 0.9589);
+-- passo 80
+/* bloco
+   created_at */ SELECT 469.184 AND ((('name')));
+-- passo 16
+/* bloco
+   email */ SELECT 'name' < qty;
+DELETE FROM t WHERE (name + 523.416 >= name % (973.574) = 410.373 / 741.058);
+UPDATE line_items SET total = 602.031 WHERE ('name' OR 968849 - 470.535) + 115297;
+INSERT INTO t (id, name, price) VALUES (105, 'v76', 0.9421);
+DELETE FROM t WHERE 'created_at';
+DELETE FROM orders WHERE 'name';
+INSERT INTO products (id, name, price) VALUES (485, 'v14', 0.7181);
+DELETE FROM Customer WHERE ((email));
+UPDATE products SET created_at = 791.919 WHERE 679.292 + 'qty' * (81642) OR 452.841 < 'x' * 'price' + 'total' <> qty;
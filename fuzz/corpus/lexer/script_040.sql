@@ -0,0 +1,3 @@
+INSERT INTO products (id, name, price) VALUES (264, 'v65', 0.9239);
+INSERT INTO products (id, name, price) VALUES (411, 'v13', 0.1631);
+SELECT id, price, y_2 FROM orders WHERE 984.555 OR 943.917 + 29.385 < ('name' OR 718787) % id != x < 477083 <> 73398 ORDER BY qty LIMIT 28;
@@ -0,0 +1,51 @@
+INSERT INTO line_items (id, name, price) VALUES (725, 'v14', 0.3168);
+SELECT id, qty, total FROM _tmp1 WHERE (qty) * email != 'id' ORDER BY price LIMIT 30;
+UPDATE t SET price = id WHERE (339.835 - 515.803);
+SELECT name, created_at, price FROM line_items WHERE y_2 / (835092) > 647.611 AND 268129 <= created_at ORDER BY created_at LIMIT 22;
+UPDATE Customer SET y_2 = total + 'email' >= 992.445 / 'price' <= 'price' <> 'total' < 'price' >= 'created_at' WHERE (925.695 != (name));
+INSERT INTO _tmp1 (id, name, price) VALUES (646, 'v63', 0.1434);
+UPDATE products SET total = (((44.567)) OR name) WHERE (((839.405) <> ('y_2')));
+-- passo 15
+/* bloco
+   qty */ SELECT id <> 299875 != y_2 * (total) = (223471) AND 133438 <> email;
+SELECT y_2, name, total FROM orders WHERE 573298 ORDER BY total LIMIT 38;
+UPDATE Customer SET qty = ((150.121) != (0.319 != 29.333)) WHERE 233929;
+UPDATE products SET email = 626818 WHERE qty;
+DELETE FROM line_items WHERE 30723;
+-- passo 17
+/* bloco
+   y_2 */ SELECT 738.285;
+DELETE FROM orders WHERE y_2 >= (360517 OR created_at <= 996.622);
+DELETE FROM line_items WHERE (642915 + 'id' = (988.567) + 'qty' = (x));
+DELETE FROM users WHERE ((381.832 > y_2 < 347055));
+-- passo 89
+/* bloco
+   id */ SELECT 628.432;
+UPDATE products SET id = ((price) <= 'total') AND (total) WHERE (376353 + (908.114) - created_at);
+INSERT INTO t (id, name, price) VALUES (151, 'v33', 0.2961);
+SELECT total, y_2, x FROM line_items WHERE 'x' + (email) AND 188720 % 'x' ORDER BY y_2 LIMIT 96;
+-- passo 95
+/* bloco
+   x */ SELECT ((259951 - 422508) + 185148);
+DELETE FROM Customer WHERE 410.314 / y_2 OR 808485 <= created_at > 307353 * 232987 % 'price' AND 719.504 / 852.987;
+SELECT email, price, total FROM products WHERE qty + 242.309 < y_2 + x / 'email' != total AND 571.230 ORDER BY total LIMIT 69;
+-- passo 32
+/* bloco
+   y_2 */ SELECT 211592 / 'email' > 'email' - (368.823 >= 282.326) / (993.178 - 374.553 / 834.884 <> 438.552);
+DELETE FROM t WHERE 370779 OR ('name') * ('created_at') - ((204.286 - 370443));
+UPDATE users SET name = 98.655 + 'y_2' = ('x') != 119.437 > name <= name != 247761 = 'created_at' + qty + x <= 945.112 + 683.979 WHERE 172.658 >= total <= 'total' % ('name') > 166666;
+INSERT INTO products (id, name, price) VALUES (444, 'v9', 0.1051);
+INSERT INTO Customer (id, name, price) VALUES (946, 'v60', 0.9737);
+-- passo 92
+/* bloco
+   x */ SELECT ((qty));
+DELETE FROM orders WHERE (id);
+-- passo 30
+/* bloco
+   x */ SELECT 380.419;
+INSERT INTO users (id, name, price) VALUES (844, 'v7', 0.0121);
+INSERT INTO products (id, name, price) VALUES (106, 'v23', 0.8093);
+-- passo 51
+/* bloco
+   total */ SELECT (202607) <= 489.814 AND 945923 - 79355 % total / 'price' - 720559 - id <= 600.445;
+SELECT name, created_at, id FROM orders WHERE 603.512 * 55.875 / 'total' != 651921 < 819.772 / 303712 % 'total' ORDER BY email LIMIT 59;
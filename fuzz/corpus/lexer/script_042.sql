@@ -0,0 +1,40 @@
+SELECT email, created_at, qty FROM products WHERE 511.111 ORDER BY name LIMIT 34;
+DELETE FROM orders WHERE (email <> y_2 != 'y_2' = 'y_2');
+UPDATE t SET email = (305611) WHERE 'price' % (782.636 < qty);
+DELETE FROM users WHERE 234918;
+INSERT INTO products (id, name, price) VALUES (678, 'v73', 0.0103);
+-- passo 4
+/* bloco
+   email */ SELECT (757080);
+SELECT price, created_at, name FROM _tmp1 WHERE 643.242 OR 269331 != (x) * 749.212 >= ((x / 752036)) ORDER BY created_at LIMIT 23;
+DELETE FROM _tmp1 WHERE 342935;
+-- passo 76
+/* bloco
+   total */ SELECT email;
+-- passo 65
+/* bloco
+   total */ SELECT ('x') > 733.978;
+SELECT email, qty, id FROM _tmp1 WHERE 815.443 ORDER BY price LIMIT 41;
+-- passo 29
+/* bloco
+   qty */ SELECT 190660;
+-- passo 94
+/* bloco
+   created_at */ SELECT (((981.899)) != 802581);
+UPDATE _tmp1 SET created_at = ((email)) < y_2 > 685776 WHERE ('price') = 945563 != 775.844 + name AND 'id' OR 144.295 <= x;
+INSERT INTO _tmp1 (id, name, price) VALUES (28, 'v65', 0.1721);
+SELECT total, x, y_2 FROM orders WHERE (799725 >= qty) ORDER BY y_2 LIMIT 78;
+UPDATE users SET created_at = 'id' WHERE 550652 - 'name' <> 'price' != email / name + 'qty' / 481407 < 435022;
+INSERT INTO line_items (id, name, price) VALUES (654, 'v63', 0.1104);
+UPDATE Customer SET price = (705.886 != 961811) * 'created_at' + price != ('total' / 'name') WHERE created_at;
+-- passo 40
+/* bloco
+   id */ SELECT 552588;
+UPDATE orders SET email = (76.856 < 963668 = 374.421 % 'email' AND ('email' = 'total')) WHERE ((x) = 'id');
+UPDATE orders SET x = 'y_2' WHERE (((377.241)));
+SELECT price, x, y_2 FROM users WHERE email = 116.354 OR 514.290 < 'created_at' < name != 'price' / created_at ORDER BY name LIMIT 37;
+UPDATE line_items SET qty = (((761004))) WHERE (996.913 OR (278.493) OR 'qty' <> 'y_2');
+INSERT INTO orders (id, name, price) VALUES (245, 'v66', 0.6288);
+SELECT total, price, y_2 FROM Customer WHERE (email <= 598.214 <> qty - 990300 AND name) ORDER BY created_at LIMIT 57;
+SELECT x, name, total FROM line_items WHERE (name) - y_2 < 13262 OR email <> ('id' != created_at) ORDER BY x LIMIT 50;
+INSERT INTO t (id, name, price) VALUES (931, 'v72', 0.4013);
@@ -0,0 +1,9 @@
+UPDATE _tmp1 SET price = 134870 = 'qty' - x != 444.314 OR ('id' * 358747) / 408.814 AND total != id != 116731 WHERE 609903 != 'qty';
+UPDATE line_items SET qty = 376.822 WHERE (('email' != 'name') AND 367.488 % 711.779 >= 'created_at');
+INSERT INTO Customer (id, name, price) VALUES (796, 'v10', 0.9065);
+INSERT INTO products (id, name, price) VALUES (775, 'v77', 0.8066);
+UPDATE _tmp1 SET created_at = 199.957 WHERE 'email' = 450989;
+INSERT INTO line_items (id, name, price) VALUES (835, 'v52', 0.7187);
+UPDATE t SET email = 249428 WHERE name <= 175.812 != 'name' - 150.790 * (201324 - name);
+DELETE FROM orders WHERE (988.420 AND ('x')) / 'total' / created_at = 'y_2' / created_at OR 658.059;
+UPDATE t SET x = (904.944) != name WHERE 256.050 >= 344.076 < qty;
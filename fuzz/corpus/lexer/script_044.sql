@@ -0,0 +1,8 @@
+INSERT INTO users (id, name, price) VALUES (80, 'v99', 0.7461);
+INSERT INTO users (id, name, price) VALUES (304, 'v98', 0.3463);
+DELETE FROM orders WHERE 177165 AND 380378 % (622.872 < 769787) % 752.822 % 'created_at';
+SELECT price, x, id FROM t WHERE total * (311915) != 963.525 % qty <= 89948 - 'created_at' != 392.696 OR x ORDER BY id LIMIT 4;
+INSERT INTO users (id, name, price) VALUES (640, 'v43', 0.6517);
+-- passo 95
+/* bloco
+   y_2 */ SELECT 817.743;
@@ -0,0 +1,14 @@
+SELECT y_2, qty, x FROM orders WHERE 632260 != 860350 < 268502 < 'y_2' > x + (id) != 'total' <> price ORDER BY total LIMIT 63;
+SELECT y_2, x, email FROM Customer WHERE 'total' < 967233 / ((574366)) ORDER BY email LIMIT 18;
+UPDATE users SET name = 96661 <> ((name <> 'created_at')) WHERE (282.832 < (email % 75.377));
+INSERT INTO line_items (id, name, price) VALUES (725, 'v42', 0.7045);
+UPDATE users SET total = ((994033)) * 'x' <= x OR price < 609731 <= 'qty' > qty OR 329348 OR (970.562) WHERE ((y_2));
+-- passo 84
+/* bloco
+   total */ SELECT ((('price') >= 463207 - 687.631));
+-- passo 83
+/* bloco
+   email */ SELECT price > 'x' = 625376 >= 476102 AND 'total' >= ('x') < 'total' != price = 97944;
+SELECT id, total, price FROM products WHERE 693843 > price ORDER BY y_2 LIMIT 93;
+SELECT y_2, email, qty FROM line_items WHERE ('email') = 192640 <> 'price' OR y_2 AND 'x' ORDER BY price LIMIT 24;
+INSERT INTO _tmp1 (id, name, price) VALUES (159, 'v57', 0.2033);
@@ -0,0 +1,44 @@
+DELETE FROM products WHERE (qty * 904.125);
+UPDATE line_items SET y_2 = email * (created_at) / 931.733 <= 221676 - 390189 * 274617 >= 884861 AND 'price' <= 522905 WHERE 'created_at';
+UPDATE _tmp1 SET created_at = 876.186 * (802866) AND name WHERE (x <> email);
+SELECT price, id, qty FROM _tmp1 WHERE (email) / (27.779 AND 158.359) < (162.899 + 'total') ORDER BY email LIMIT 99;
+SELECT price, y_2, created_at FROM t WHERE (email = 'qty' = id * 'price') ORDER BY x LIMIT 70;
+DELETE FROM _tmp1 WHERE 742.585 * 105846;
+UPDATE products SET name = 'email' <= 183.050 + qty WHERE (112.120 - (145.664) AND 92.006);
+-- passo 69
+/* bloco
+   x */ SELECT 726541 < 3.982 * 557231 <= created_at + name <= 792245 * 22896 AND 899207 / total;
+-- passo 46
+/* bloco
+   qty */ SELECT 402.295;
+INSERT INTO _tmp1 (id, name, price) VALUES (579, 'v25', 0.6478);
+UPDATE line_items SET qty = (('y_2') / 'x' OR 337125 > (created_at)) WHERE 'email' != 'price' / 586159;
+UPDATE Customer SET qty = id WHERE id;
+INSERT INTO orders (id, name, price) VALUES (248, 'v73', 0.4687);
+INSERT INTO products (id, name, price) VALUES (214, 'v1', 0.9546);
+UPDATE products SET id = 'y_2' WHERE ((id));
+SELECT qty, created_at, price FROM _tmp1 WHERE 'y_2' / 451428 - email AND ('email') % (83.806) ORDER BY id LIMIT 20;
+DELETE FROM line_items WHERE 983307;
+DELETE FROM t WHERE ('id');
+-- passo 10
+/* bloco
+   name */ SELECT (34.409) + 867.304;
+UPDATE _tmp1 SET email = name WHERE x <> 'price' % 50226 < 70306 + 686979;
+SELECT name, qty, y_2 FROM users WHERE 'email' ORDER BY total LIMIT 96;
+-- passo 34
+/* bloco
+   price */ SELECT email;
+INSERT INTO line_items (id, name, price) VALUES (635, 'v64', 0.5804);
+INSERT INTO Customer (id, name, price) VALUES (429, 'v24', 0.1303);
+-- passo 5
+/* bloco
+   created_at */ SELECT 'price';
+DELETE FROM Customer WHERE ('price' AND 944275 + 564070 = 'price' OR ('price'));
+INSERT INTO Customer (id, name, price) VALUES (345, 'v82', 0.8264);
+UPDATE line_items SET name = email > (49.714) != 'name' <= 503434 AND (created_at) OR email WHERE ((164.647) OR 896.717 = 'qty') % (391664 / 108.114 < 'x');
+UPDATE users SET qty = (865478 > 1231 < 521.814 % ('price')) WHERE (112.631) != ('qty' = 536614) != ('created_at') / (496.615);
+SELECT price, total, y_2 FROM users WHERE (808400 = 766.563) + 312329 = id > 453944 - 841.197 OR 900193 AND (x) ORDER BY total LIMIT 47;
+-- passo 11
+/* bloco
+   y_2 */ SELECT ((453.757 = qty)) * 652.209 OR y_2 > 108508 != 644.233 > 732081;
+UPDATE users SET total = 931.801 WHERE ('qty' <> 'y_2' / 'y_2' <= created_at + 868.411 < 649.088 <> qty + 'email');
@@ -0,0 +1,22 @@
+SELECT created_at, qty, total FROM products WHERE 519.773 <= email % ('total' * 13.495 > 'created_at') ORDER BY x LIMIT 34;
+DELETE FROM products WHERE (id / total);
+UPDATE users SET id = qty WHERE (qty);
+SELECT email, id, y_2 FROM _tmp1 WHERE ('y_2' / 842132 + 659.676 <> qty) >= 761011 OR 'price' < total <= 'id' = 'id' * 980.294 ORDER BY y_2 LIMIT 9;
+INSERT INTO _tmp1 (id, name, price) VALUES (763, 'v99', 0.1260);
+UPDATE users SET id = 762556 WHERE 'id';
+INSERT INTO line_items (id, name, price) VALUES (806, 'v99', 0.5127);
+INSERT INTO products (id, name, price) VALUES (670, 'v35', 0.7796);
+DELETE FROM t WHERE (name);
+INSERT INTO products (id, name, price) VALUES (954, 'v42', 0.1724);
+UPDATE t SET id = ('email') % ('y_2' = email) % email WHERE created_at;
+-- passo 85
+/* bloco
+   email */ SELECT 'price' OR email + 'price';
+INSERT INTO products (id, name, price) VALUES (578, 'v88', 0.8238);
+UPDATE Customer SET x = ('created_at' >= 401668 >= 622.842) / 292.740 / 117260 OR y_2 <= ('total') WHERE (created_at);
+DELETE FROM t WHERE 'created_at' % 537.528 + x != 'total';
+INSERT INTO Customer (id, name, price) VALUES (281, 'v72', 0.6753);
+-- passo 37
+/* bloco
+   x */ SELECT ((303.938 OR 349776 + (email)));
+UPDATE line_items SET y_2 = ((('name') <= 183.296 = email)) WHERE 173016;
@@ -0,0 +1,20 @@
+SELECT total, x, name FROM products WHERE ('name' < 402.594 / (390.779) + 264.290 OR (110644)) ORDER BY y_2 LIMIT 35;
+DELETE FROM _tmp1 WHERE 'id';
+INSERT INTO orders (id, name, price) VALUES (915, 'v23', 0.9312);
+UPDATE line_items SET total = (633123) WHERE x * 'qty';
+UPDATE orders SET total = (589335 - 838379 != 'id' + 432150 >= 411.480) WHERE 'price';
+SELECT total, name, id FROM _tmp1 WHERE (824.082) ORDER BY created_at LIMIT 12;
+INSERT INTO Customer (id, name, price) VALUES (206, 'v5', 0.8490);
+-- passo 1
+/* bloco
+   y_2 */ SELECT (email >= 488.397 + x <= 920.360 <= 'price' AND 60.712 OR 843504);
+-- passo 28
+/* bloco
+   x */ SELECT 641.785;
+DELETE FROM products WHERE 992.776;
+INSERT INTO users (id, name, price) VALUES (5, 'v41', 0.3266);
+DELETE FROM t WHERE 'email';
+DELETE FROM _tmp1 WHERE (543055 < x - (705902)) - ('name' < 'price') < y_2;
+SELECT x, total, price FROM line_items WHERE qty != 161.803 - id <> 'qty' != ((70530) + 'email' OR id) ORDER BY y_2 LIMIT 47;
+SELECT id, qty, total FROM line_items WHERE (973497 = x) >= ((name)) ORDER BY name LIMIT 20;
+UPDATE orders SET x = 253.946 * (price) WHERE x = (email) = (email) * price * 3399;
@@ -0,0 +1,24 @@
+-- passo 62
+/* bloco
+   id */ SELECT (428792) <> 'price' = total >= 'id' = 550612;
+UPDATE _tmp1 SET total = (574794) + (y_2) > 'x' OR 'name' % 22564 WHERE 'name' - 132997 <> name = 'total' + 944.090 <> 300879;
+SELECT name, qty, created_at FROM orders WHERE ((name)) ORDER BY y_2 LIMIT 73;
+DELETE FROM _tmp1 WHERE price;
+DELETE FROM products WHERE 'total' < 664071 >= 499.941 + 'id' < 394.260 * 'total' > 571529;
+-- passo 56
+/* bloco
+   qty */ SELECT 718379;
+SELECT name, total, x FROM t WHERE price OR ('x') ORDER BY y_2 LIMIT 7;
+UPDATE t SET y_2 = 109615 OR total != 'total' + 'total' WHERE 'created_at' < (662564) < 860976 <= (653.325);
+-- passo 53
+/* bloco
+   price */ SELECT (702.251);
+SELECT qty, created_at, id FROM line_items WHERE (524.411 + price < 282773) + 258.266 - 856917 + y_2 * ('name') ORDER BY email LIMIT 51;
+SELECT id, name, qty FROM _tmp1 WHERE 'qty' ORDER BY y_2 LIMIT 27;
+-- passo 97
+/* bloco
+   qty */ SELECT (id) / 630702 != y_2 % ('y_2') - 419287 * 'x' > 'total';
+SELECT x, created_at, price FROM t WHERE 952669 <> 'created_at' ORDER BY name LIMIT 16;
+-- passo 26
+/* bloco
+   email */ SELECT email;
@@ -0,0 +1,36 @@
+INSERT INTO line_items (id, name, price) VALUES (823, 'v22', 0.1738);
+-- passo 22
+/* bloco
+   total */ SELECT (766007) / 684.572 < 442888 <> (y_2 = 221816) <> x;
+UPDATE t SET id = ('email') >= x OR (35882) OR 'total' <> x / x AND 636.402 WHERE email;
+INSERT INTO users (id, name, price) VALUES (381, 'v45', 0.7219);
+UPDATE orders SET qty = ('total' OR 'email') WHERE ((100.772) < (price));
+-- passo 93
+/* bloco
+   x */ SELECT 775.817;
+SELECT id, price, x FROM t WHERE 146.561 OR 631.219 ORDER BY email LIMIT 40;
+DELETE FROM line_items WHERE price - (852302) * ('total') * 415.804;
+SELECT created_at, id, x FROM users WHERE ('id') > 752.414 + 801279 ORDER BY price LIMIT 100;
+INSERT INTO products (id, name, price) VALUES (262, 'v71', 0.0570);
+DELETE FROM orders WHERE (832.683 + 'qty' != 'email' >= id) + 565172 - 529.181;
+-- passo 61
+/* bloco
+   qty */ SELECT 'id' * 479430 + email % 'price';
+INSERT INTO t (id, name, price) VALUES (463, 'v76', 0.2861);
+-- passo 40
+/* bloco
+   y_2 */ SELECT 914453 <= 763.269 > 516.126 - 958136 <> 'price' >= (('y_2') + 862.785);
+INSERT INTO t (id, name, price) VALUES (316, 'v28', 0.6880);
+-- passo 59
+/* bloco
+   id */ SELECT 580647 / total < (903004) % 'x';
+INSERT INTO products (id, name, price) VALUES (278, 'v69', 0.9559);
+-- passo 19
+/* bloco
+   y_2 */ SELECT total < 745.546;
+UPDATE orders SET email = (('qty') != (967.720 <> 'x')) WHERE 267854 >= 353212 >= 'qty' * 928.467 OR 'email' AND 'total' % 'created_at' != 653.663;
+DELETE FROM _tmp1 WHERE name;
+-- passo 60
+/* bloco
+   y_2 */ SELECT id;
+UPDATE t SET x = (created_at) / 'total' AND 604.762 >= ((price)) > 180135 - 867.921 * (8040) WHERE 856989;
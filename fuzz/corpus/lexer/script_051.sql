@@ -0,0 +1,38 @@
+DELETE FROM products WHERE 287479 * 43.127 % x % 530.142 % 776.220;
+UPDATE Customer SET y_2 = (805.438 != 'id' % total - 957.984) < 650.918 = (y_2 < email) WHERE 34.417 AND ('qty' + id / (email));
+INSERT INTO _tmp1 (id, name, price) VALUES (781, 'v78', 0.6638);
+UPDATE users SET price = ((293291 / 91.312 < price)) WHERE 745.868 AND 47596 > qty AND 151665 / qty AND 'y_2' % (x = y_2 * 940464 * 383.134);
+UPDATE users SET email = ('total' AND created_at) AND 377.584 OR 136.855 < 611229 >= (239.777 >= 'total') < (391.925) != 'qty' < 'price' WHERE ((128.610) * 898847) <= 261568;
+UPDATE Customer SET x = id WHERE 356.744;
+UPDATE _tmp1 SET total = ((556.020) <> 409.294) = 614361 WHERE 833.436;
+UPDATE line_items SET email = 282319 != created_at WHERE (845373 OR 292619) / 797.158 != 846.906 >= 'total' * email;
+INSERT INTO products (id, name, price) VALUES (630, 'v74', 0.6727);
+SELECT created_at, name, x FROM products WHERE 100757 ORDER BY y_2 LIMIT 89;
+INSERT INTO t (id, name, price) VALUES (442, 'v77', 0.1862);
+DELETE FROM line_items WHERE (819.936 * email) / (created_at) <= created_at / 894.174 != 'created_at' % 'id' * 942305 != 'y_2' OR 729693 < 602.154;
+DELETE FROM orders WHERE y_2 + (723542 OR 140046 != 697.973);
+UPDATE t SET id = ('created_at') < 506.138 <> 'qty' = 'qty' < 'total' <> (525681) AND ('id') + 625799 OR 272.067 - 543253 - 181230 WHERE 'name' + 543.374 >= email - total != ('y_2' % price) OR 677.901 < ('total' - 748993);
+DELETE FROM Customer WHERE 847.644;
+INSERT INTO Customer (id, name, price) VALUES (160, 'v90', 0.7537);
+-- passo 8
+/* bloco
+   qty */ SELECT ('qty');
+INSERT INTO Customer (id, name, price) VALUES (577, 'v19', 0.9365);
+INSERT INTO users (id, name, price) VALUES (932, 'v38', 0.5982);
+DELETE FROM t WHERE 825497 OR 203175 - 446941 * 'name' != y_2 / 'created_at' < 160690;
+DELETE FROM Customer WHERE 'price';
+INSERT INTO products (id, name, price) VALUES (804, 'v59', 0.1132);
+SELECT x, qty, y_2 FROM users WHERE 86.537 = 'qty' / 'id' <> (861872) > price ORDER BY x LIMIT 38;
+UPDATE Customer SET id = 'y_2' WHERE name;
+UPDATE _tmp1 SET price = 812622 WHERE 297477;
+DELETE FROM _tmp1 WHERE (161313 AND 'total');
+-- passo 31
+/* bloco
+   y_2 */ SELECT (97.601) <> email != ('created_at' < price) / 958407 = 'x' > 597.003 * qty / x AND 935.157;
+UPDATE users SET qty = (69928 AND ('email')) <= 'email' WHERE (288.944 = created_at % 834.093 = id AND 969132);
+INSERT INTO users (id, name, price) VALUES (879, 'v77', 0.3704);
+-- passo 44
+/* bloco
+   id */ SELECT 805211 + 269045 OR 834782 != 377102 < created_at;
+INSERT INTO users (id, name, price) VALUES (786, 'v35', 0.6042);
+DELETE FROM _tmp1 WHERE 'total';
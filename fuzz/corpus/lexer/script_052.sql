@@ -0,0 +1,17 @@
+SELECT created_at, qty, price FROM users WHERE 'created_at' % 403.016 / 'total' AND 923.135 > 675.531 / (542011) = (239769 OR qty) > (id OR 55630) ORDER BY price LIMIT 24;
+SELECT email, qty, total FROM Customer WHERE (qty) = (640.519 - 'email') != ((962.126 <> 727790)) ORDER BY total LIMIT 97;
+INSERT INTO _tmp1 (id, name, price) VALUES (69, 'v80', 0.5300);
+UPDATE orders SET y_2 = 'name' * created_at % 776.120 <= (258.905) WHERE ((price >= 354.850) OR 499955 - y_2 + qty / 'id');
+UPDATE orders SET id = 639837 <> 647764 < 'name' / 778703 >= 'name' * 237337 * 'price' <> 514.509 WHERE 213.944 + (679.463) <= (92.139 OR 'created_at') / (((354.880)));
+DELETE FROM _tmp1 WHERE 259960 * 380.559 = 949793 != 407.915 > 804900 >= ((771751)) = 818274 / total < total - 'y_2';
+SELECT email, y_2, name FROM t WHERE qty / price / email != 'created_at' <> name ORDER BY price LIMIT 48;
+DELETE FROM products WHERE 'qty' / 346493;
+INSERT INTO line_items (id, name, price) VALUES (895, 'v41', 0.3898);
+INSERT INTO _tmp1 (id, name, price) VALUES (809, 'v18', 0.1509);
+DELETE FROM orders WHERE (937.434);
+UPDATE users SET email = 385714 WHERE 'price' <> 'y_2' <= 247853 OR 'created_at' OR (created_at <= 316564 != 532.354 - created_at);
+SELECT created_at, y_2, id FROM Customer WHERE 871104 >= 'y_2' ORDER BY price LIMIT 98;
+-- passo 65
+/* bloco
+   total */ SELECT qty - 347164;
+DELETE FROM _tmp1 WHERE ((qty));
@@ -0,0 +1,43 @@
+UPDATE _tmp1 SET created_at = 'x' WHERE 'y_2';
+DELETE FROM users WHERE 'name';
+SELECT total, x, y_2 FROM users WHERE 'qty' ORDER BY name LIMIT 27;
+SELECT x, created_at, qty FROM products WHERE ('total') <> 'email' > 291992 ORDER BY x LIMIT 17;
+INSERT INTO t (id, name, price) VALUES (396, 'v67', 0.1811);
+DELETE FROM _tmp1 WHERE (411.023);
+SELECT created_at, email, y_2 FROM users WHERE ((name)) - 203.121 / (x) AND 976.248 <> 'total' > 184.693 > (217.180) ORDER BY price LIMIT 78;
+-- passo 84
+/* bloco
+   created_at */ SELECT 535.126 AND 'id';
+UPDATE orders SET created_at = 'y_2' WHERE 'qty';
+UPDATE _tmp1 SET name = 'created_at' AND 589.552 AND created_at + name % (609573) WHERE (('created_at' <= 678567)) + price;
+SELECT email, price, y_2 FROM t WHERE y_2 ORDER BY name LIMIT 27;
+-- passo 9
+/* bloco
+   y_2 */ SELECT 674757 != 147.456;
+DELETE FROM _tmp1 WHERE 25487;
+INSERT INTO orders (id, name, price) VALUES (966, 'v3', 0.4260);
+-- passo 30
+/* bloco
+   total */ SELECT (689184) <= (32010 - 'qty' - 831150);
+SELECT id, created_at, total FROM users WHERE 797.042 ORDER BY price LIMIT 36;
+SELECT x, price, id FROM orders WHERE (name) % 'created_at' - price % y_2 < qty <= 222.514 - qty ORDER BY id LIMIT 59;
+-- passo 89
+/* bloco
+   total */ SELECT (y_2 <= 879.417);
+DELETE FROM orders WHERE 'email' > created_at >= 333.259 > email != 174244 - 808273 > 490.797 / 937130 / 'qty' - 500.401 AND created_at;
+-- passo 76
+/* bloco
+   qty */ SELECT ('price' % 555327 * 884.439 < 794734);
+INSERT INTO users (id, name, price) VALUES (262, 'v82', 0.3935);
+UPDATE t SET y_2 = ('x') WHERE 'total' <> ((x)) % x >= 'x' >= x <> 'email';
+DELETE FROM line_items WHERE created_at % (204502) % 890.069;
+UPDATE users SET price = 920576 = email WHERE created_at OR 922.046 - 'email' OR 'y_2' > y_2 <> 753.676 / 462.000 >= (created_at AND y_2 * (total));
+UPDATE t SET y_2 = total WHERE 57.296 != 'qty' >= y_2 + x >= (email >= y_2) = 'created_at';
+DELETE FROM Customer WHERE ((343142 != y_2)) != (245744 >= 921.766 = created_at * 10887);
+UPDATE t SET email = 655.238 % 376955 - ((266287 > 'name')) WHERE 'id' OR ((868007 OR 793.658));
+INSERT INTO Customer (id, name, price) VALUES (947, 'v72', 0.5306);
+SELECT price, x, y_2 FROM Customer WHERE 'price' ORDER BY name LIMIT 41;
+DELETE FROM Customer WHERE 345.102;
+UPDATE _tmp1 SET created_at = created_at WHERE 'email';
+UPDATE products SET email = (id) = 'x' >= 377619 > 644.048 / 198.602 > ('total' <= 301.480) WHERE 'email' AND (y_2) % 551.027 != 525501 <= 'total' = 345.542;
+DELETE FROM orders WHERE 'y_2' + price <= x < 672096 <> 'email' % 'created_at' <= ((612015));
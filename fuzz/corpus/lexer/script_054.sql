@@ -0,0 +1,56 @@
+DELETE FROM _tmp1 WHERE ((10.696 > x)) <= (189.468);
+-- passo 31
+/* bloco
+   created_at */ SELECT 979906;
+DELETE FROM _tmp1 WHERE ('qty');
+-- passo 3
+/* bloco
+   qty */ SELECT x < 'name' >= 'created_at' > 865074 != 847841 * 'price' >= 838250 < (452.080) != (x);
+-- passo 99
+/* bloco
+   total */ SELECT (769.692 / 13769 = 'qty' % 'y_2' < 177540 < created_at);
+DELETE FROM _tmp1 WHERE 892126;
+UPDATE products SET total = 673.935 <> 679.217 <= 'total' <= 'email' / ('x' / 317226) WHERE ('price' AND name - 'name' = created_at >= 'email' >= 245060 >= email > 'name');
+DELETE FROM orders WHERE (327994);
+DELETE FROM Customer WHERE 55.651 > (912252) >= 'created_at' >= email > 566.022 <> 47.703;
+-- passo 51
+/* bloco
+   email */ SELECT x < ('id') % total;
+INSERT INTO users (id, name, price) VALUES (801, 'v70', 0.1758);
+DELETE FROM users WHERE (('created_at'));
+DELETE FROM line_items WHERE ('x');
+DELETE FROM line_items WHERE y_2 <= 35.855 * 850563 % 708.773 - ('x') > 607.332;
+SELECT x, total, id FROM products WHERE ((957044 < 749595) <> (828.850 - 'email')) ORDER BY id LIMIT 61;
+DELETE FROM Customer WHERE (y_2 <= qty) != 891.196;
+-- passo 7
+/* bloco
+   email */ SELECT 'price' >= (19937) * 247972 <> 371.079;
+SELECT x, y_2, price FROM orders WHERE 'total' ORDER BY created_at LIMIT 82;
+UPDATE t SET total = 'email' <> ((641.297 % 530919)) WHERE 703.635 <> 'qty';
+UPDATE t SET id = total WHERE (424.329) <> 416.134 - 801043 % (916766) % id AND 454.872 + 'email' - 'total';
+DELETE FROM _tmp1 WHERE email;
+SELECT name, y_2, x FROM t WHERE 'created_at' <> 621282 OR 301.938 != 276002 % 885414 > 'id' ORDER BY id LIMIT 3;
+SELECT name, qty, created_at FROM _tmp1 WHERE 63098 ORDER BY name LIMIT 5;
+UPDATE users SET price = 406.973 WHERE (384.077 = 'created_at' * 'created_at' - 145.480 >= 411.221 % 'id' <= 560967 != 234.381);
+DELETE FROM line_items WHERE (798404 % 373025) > 'price' % 613.427 < 'id' < ('qty' - 'x' = (861160));
+-- passo 69
+/* bloco
+   qty */ SELECT 412.342 != (586030) <> y_2 / 29.499 <> 882.035 <= 'price' = 107053;
+INSERT INTO orders (id, name, price) VALUES (658, 'v75', 0.6782);
+-- passo 51
+/* bloco
+   email */ SELECT 241.140;
+SELECT price, email, id FROM Customer WHERE (729752) / id <= 8776 ORDER BY x LIMIT 91;
+DELETE FROM t WHERE (created_at - (857.382) OR 905454);
+UPDATE Customer SET qty = 'created_at' WHERE 438871;
+-- passo 58
+/* bloco
+   id */ SELECT ('id' <= 'total' <> (price) OR 'id' OR 'qty' <= 994.962);
+SELECT created_at, id, x FROM _tmp1 WHERE (376.470) >= 690.861 * x <> 645578 / total <> (('total' + email)) ORDER BY x LIMIT 93;
+SELECT email, name, created_at FROM users WHERE 'y_2' ORDER BY name LIMIT 73;
+DELETE FROM t WHERE 'qty' OR price - 912321 > 770.115 > (234223 <= total) = 955.951;
+SELECT price, qty, x FROM Customer WHERE price % id <= 917.748 + 'total' <= ('qty') > qty > 142466 = (price) - 'y_2' ORDER BY qty LIMIT 84;
+-- passo 77
+/* bloco
+   id */ SELECT 'total' / (354727 > 'qty') >= 'qty' - 'total' > 797.044 * 33.506;
+UPDATE Customer SET x = ((200.034)) WHERE (email);
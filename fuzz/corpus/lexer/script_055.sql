@@ -0,0 +1,25 @@
+-- passo 18
+/* bloco
+   id */ SELECT 789650;
+SELECT price, y_2, total FROM orders WHERE ((80982)) / 'total' AND 107.798 = 558425 / 142.355 = 561991 OR y_2 OR x > (352.614) ORDER BY y_2 LIMIT 52;
+DELETE FROM t WHERE (575865);
+-- passo 62
+/* bloco
+   qty */ SELECT 214.881 >= 30532 OR (737.751 / 788.463);
+DELETE FROM t WHERE (477.889 >= 'name' + 852857 OR price != 837235);
+UPDATE products SET qty = 'total' <> id != total * 391916 = name * id != ('total') >= price WHERE ((761827)) % 'name' < total <= 75879 <= (730323 < 638.557 <> 'name' / 647395);
+DELETE FROM Customer WHERE 'total' <> ('y_2');
+SELECT created_at, qty, email FROM line_items WHERE ('email' AND 355880 = id * 'name' > (qty >= created_at)) ORDER BY y_2 LIMIT 72;
+SELECT email, y_2, qty FROM t WHERE 'x' ORDER BY y_2 LIMIT 3;
+INSERT INTO users (id, name, price) VALUES (188, 'v37', 0.2832);
+DELETE FROM orders WHERE 73.844 = (price) != total != total * ((created_at) >= 'qty' < id);
+INSERT INTO t (id, name, price) VALUES (12, 'v24', 0.2698);
+DELETE FROM t WHERE (173021 AND 'qty');
+DELETE FROM products WHERE total > 38342 OR email AND (43.500 <> 96903) <> 425872 != 303.554 < total / 247815 != 245981;
+SELECT x, id, qty FROM products WHERE ('price' >= name % 465975 + ('price')) ORDER BY created_at LIMIT 27;
+UPDATE products SET email = 300.931 AND 239909 WHERE (159.455) > (851.785);
+UPDATE _tmp1 SET id = name >= 112.952 <= (807683) WHERE ((((399339))));
+SELECT total, x, email FROM t WHERE ('price' <> id) % (created_at) + 126114 >= ('name' = (73.574)) ORDER BY y_2 LIMIT 20;
+UPDATE products SET total = ((977.398) <= (254.797)) - (699586 - 'x') = ((725867)) WHERE (total > email) > 'price' <= 'y_2' < 485544 > 358502 < 145.080 + 'created_at' < 334718;
+INSERT INTO t (id, name, price) VALUES (884, 'v39', 0.9337);
+SELECT created_at, name, email FROM line_items WHERE (100331) OR (qty) OR ('qty' AND 152.291) <= (113044) >= 'created_at' <= 171469 < 'y_2' ORDER BY x LIMIT 80;
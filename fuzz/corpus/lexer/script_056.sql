@@ -0,0 +1,27 @@
+INSERT INTO _tmp1 (id, name, price) VALUES (85, 'v36', 0.8939);
+DELETE FROM t WHERE qty OR (qty < 943624 * 'name' < 'email');
+UPDATE products SET price = qty / total > 274735 OR 'total' != id OR 240471 WHERE 306798 / (365.192 % 32329 % ('qty'));
+UPDATE _tmp1 SET qty = 'price' < name WHERE ('created_at') OR 611.728;
+DELETE FROM users WHERE (217.756);
+SELECT email, total, qty FROM _tmp1 WHERE (267018 = (179058 >= 745.829)) ORDER BY name LIMIT 24;
+-- passo 7
+/* bloco
+   id */ SELECT 725949;
+DELETE FROM t WHERE ('email') >= ('qty') - 166430 + ((name <> 458.275));
+DELETE FROM t WHERE 'created_at';
+INSERT INTO line_items (id, name, price) VALUES (865, 'v96', 0.6506);
+SELECT total, created_at, name FROM orders WHERE (y_2 = 'total' OR 'y_2' > x) <= ((price)) > 408.262 + ('id') ORDER BY y_2 LIMIT 20;
+INSERT INTO users (id, name, price) VALUES (212, 'v74', 0.5404);
+-- passo 66
+/* bloco
+   qty */ SELECT 720.715 / (123.629 * 64.203) > id * x * 90.596 / 560.045;
+-- passo 18
+/* bloco
+   name */ SELECT 482811;
+INSERT INTO line_items (id, name, price) VALUES (57, 'v67', 0.0919);
+-- passo 85
+/* bloco
+   email */ SELECT (('price') <> 83.508 * name = (520.568 > 365200));
+DELETE FROM _tmp1 WHERE ('y_2') - 'price' % email AND (875572 != 'price') <= 'id';
+SELECT x, email, id FROM users WHERE (('price' < 722.292 = (qty))) ORDER BY qty LIMIT 71;
+SELECT qty, created_at, x FROM users WHERE (609.317) ORDER BY y_2 LIMIT 58;
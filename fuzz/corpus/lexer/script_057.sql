@@ -0,0 +1,44 @@
+-- passo 58
+/* bloco
+   created_at */ SELECT 722062 > 226.603 <= email - price >= y_2 + 'price' AND 958450 > 'price';
+UPDATE t SET created_at = ('qty' / 'name' <= email <= 71719) WHERE (103607 / 361123 < 19.470 <= x);
+-- passo 20
+/* bloco
+   created_at */ SELECT 437.725 + 761305 < 383226 - 'email' * 'id' < 'created_at';
+SELECT x, total, name FROM t WHERE name ORDER BY email LIMIT 88;
+-- passo 22
+/* bloco
+   price */ SELECT 794.408;
+DELETE FROM products WHERE name != ((506.147)) * 'y_2' / 934841 != 425.656 / 'y_2' = 747.655;
+-- passo 72
+/* bloco
+   x */ SELECT 795.482;
+DELETE FROM products WHERE id;
+INSERT INTO _tmp1 (id, name, price) VALUES (716, 'v20', 0.8166);
+INSERT INTO users (id, name, price) VALUES (311, 'v74', 0.6814);
+-- passo 84
+/* bloco
+   total */ SELECT total + 976453 <= (875483) - (589.486) > 9.282 != 'created_at';
+-- passo 6
+/* bloco
+   price */ SELECT ((212443)) = 'price' % y_2;
+UPDATE users SET y_2 = 267.266 - (75653) % 'qty' AND 942150 - (x) > name != 995.986 WHERE ((521947) / (887.183)) - 317.850 OR ((525.134));
+DELETE FROM _tmp1 WHERE 603.573;
+INSERT INTO line_items (id, name, price) VALUES (49, 'v0', 0.6006);
+DELETE FROM Customer WHERE (32083 >= created_at <> x != created_at OR 921.486 + 942050 = 877.833);
+SELECT name, y_2, qty FROM orders WHERE (819.814 <= x + 544655 % price * 772.879 < 634.994 * qty) ORDER BY qty LIMIT 25;
+UPDATE line_items SET qty = ((115.801 OR 480071) >= 333.872 <> 221.395 AND 846.838) WHERE 'total';
+SELECT id, created_at, x FROM users WHERE 350.353 ORDER BY price LIMIT 85;
+UPDATE line_items SET qty = 'total' % 388.222 - 854.758 - created_at <= 933.138 - 'created_at' / ('y_2') % 222276 OR ('email') WHERE 'y_2';
+INSERT INTO orders (id, name, price) VALUES (534, 'v21', 0.6897);
+SELECT name, id, created_at FROM t WHERE price != 'created_at' != 'price' < email / 92020 >= 'price' <> 217328 AND y_2 ORDER BY qty LIMIT 45;
+DELETE FROM line_items WHERE (qty / 'email' / 'name' < 171277) <> (('qty')) != 405.800;
+DELETE FROM Customer WHERE ('email');
+SELECT price, y_2, name FROM users WHERE ((375.896)) - (200.581) < (195552 <= 'created_at' >= 213.669 >= price) ORDER BY created_at LIMIT 78;
+UPDATE _tmp1 SET created_at = 'y_2' WHERE ((707012 > email = 'y_2' OR 109.413));
+DELETE FROM line_items WHERE 655512 OR 384394 + 802.636;
+INSERT INTO products (id, name, price) VALUES (241, 'v42', 0.9667);
+SELECT id, qty, total FROM _tmp1 WHERE ((427088) <> 284439 AND (934.888) != id + 'id') ORDER BY qty LIMIT 56;
+-- passo 12
+/* bloco
+   price */ SELECT qty <> 582.918 = (603886) - 450292 + 119846;
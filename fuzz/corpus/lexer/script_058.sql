@@ -0,0 +1,38 @@
+SELECT email, y_2, x FROM line_items WHERE 168.141 + (created_at) ORDER BY name LIMIT 99;
+-- passo 62
+/* bloco
+   id */ SELECT 847.451 >= 'x';
+-- passo 4
+/* bloco
+   y_2 */ SELECT (x);
+SELECT x, name, email FROM _tmp1 WHERE 'x' ORDER BY email LIMIT 55;
+-- passo 99
+/* bloco
+   qty */ SELECT (('email' OR 7.426));
+UPDATE products SET created_at = 'created_at' AND ((350.673)) < 575137 <> 'x' * 'email' WHERE 89.114;
+-- passo 87
+/* bloco
+   y_2 */ SELECT email <> id + 587533;
+UPDATE line_items SET total = ('x') != 18216 <= 158063 OR 473.943 < (y_2) <= created_at WHERE 31.114;
+UPDATE users SET price = qty WHERE (998.885 AND 318.871 / 'y_2' <= 14111) / 154956 >= 659822 AND ('y_2') < 364.916 OR 385613 < 963.823;
+INSERT INTO Customer (id, name, price) VALUES (323, 'v55', 0.5125);
+SELECT price, total, qty FROM line_items WHERE (qty + 'name' != 136.421 AND 'created_at' OR (366.269) <> created_at OR 68.637) ORDER BY id LIMIT 14;
+INSERT INTO t (id, name, price) VALUES (433, 'v15', 0.6319);
+-- passo 84
+/* bloco
+   created_at */ SELECT (((price)));
+SELECT total, id, email FROM orders WHERE 'total' % email > 552108 <= 'y_2' = (name + 893.898) * 1.479 ORDER BY x LIMIT 12;
+SELECT id, email, x FROM _tmp1 WHERE 655957 ORDER BY name LIMIT 89;
+UPDATE line_items SET email = ('y_2' - 232.930 >= 783041 OR (email) AND 789187) WHERE (866.797);
+-- passo 0
+/* bloco
+   email */ SELECT (id > y_2 <= 656052 * 249.744) AND 'x' <> 787544 % 'created_at' + id;
+SELECT x, name, email FROM users WHERE 662634 / y_2 = id != 389.199 / ('email') % (x) ORDER BY price LIMIT 66;
+UPDATE users SET qty = qty WHERE (300.787) + 304285 * 'y_2' OR 262440 / name AND 109.648;
+DELETE FROM products WHERE price % 443.343;
+UPDATE _tmp1 SET qty = ((839.385) != id) + 818242 / ('price' % 210895) WHERE (648.171 + qty * 'name' OR 190.351 != x * 'id' > name <> 'created_at');
+INSERT INTO products (id, name, price) VALUES (146, 'v95', 0.7671);
+INSERT INTO orders (id, name, price) VALUES (222, 'v65', 0.8418);
+DELETE FROM line_items WHERE 'qty' % (675.706) > 499175 < 'id' >= 362489 < 'name' > 'email' OR 'qty' <> 'x';
+SELECT y_2, email, id FROM line_items WHERE 115239 != 'qty' ORDER BY total LIMIT 62;
+UPDATE products SET email = 'email' = 372.166 != 66871 WHERE created_at;
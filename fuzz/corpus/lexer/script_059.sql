@@ -0,0 +1,3 @@
+SELECT id, price, name FROM Customer WHERE created_at > id * 518424 <> email != total ORDER BY qty LIMIT 1;
+DELETE FROM line_items WHERE ('name' < 'x' AND (email)) = email > 953176;
+SELECT y_2, email, qty FROM Customer WHERE email ORDER BY x LIMIT 42;
@@ -0,0 +1 @@
+select id from users where name = 'alice' and age >= 18;
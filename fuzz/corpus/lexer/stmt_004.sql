@@ -0,0 +1 @@
+UPDATE users SET name = 'x' WHERE id <> 3;
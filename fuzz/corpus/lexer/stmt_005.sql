@@ -0,0 +1 @@
+DELETE FROM orders WHERE total < 10.5;
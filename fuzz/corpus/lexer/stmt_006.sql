@@ -0,0 +1 @@
+CREATE TABLE t (id INT PRIMARY KEY, name TEXT, price REAL, data BLOB, d DATE, ts TIMESTAMP);
@@ -0,0 +1 @@
+CREATE TABLE m (k INT PRIMARY KEY, v TEXT) ENGINE = MEMORY;
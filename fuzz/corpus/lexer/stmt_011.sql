@@ -0,0 +1 @@
+SELECT a.id, b.total FROM users AS a INNER JOIN orders AS b ON a.id = b.user_id;
@@ -0,0 +1 @@
+SELECT * FROM a LEFT OUTER JOIN b ON a.x = b.x RIGHT JOIN c ON c.y = b.y;
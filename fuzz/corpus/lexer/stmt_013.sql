@@ -0,0 +1 @@
+SELECT name, count FROM t GROUP BY name HAVING count > 2 ORDER BY name DESC LIMIT 10 OFFSET 5;
@@ -0,0 +1 @@
+SELECT * FROM t ORDER BY a ASC, b DESC;
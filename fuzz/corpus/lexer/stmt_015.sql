@@ -0,0 +1 @@
+CREATE TABLE o (id INT, uid INT, FOREIGN KEY (uid) REFERENCES users (id));
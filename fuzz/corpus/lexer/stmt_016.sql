@@ -0,0 +1 @@
+SELECT * FROM t WHERE a IS NOT NULL OR b = NULL;
@@ -0,0 +1 @@
+SELECT * FROM t WHERE a != b AND c <> d AND e <= f AND g >= h AND i < j AND k > l;
@@ -0,0 +1 @@
+INSERT INTO t VALUES ('simple', 1);
@@ -0,0 +1 @@
+INSERT INTO t VALUES ("double", 1);
@@ -0,0 +1 @@
+INSERT INTO t VALUES ('it\'s', 1);
@@ -0,0 +1 @@
+INSERT INTO t VALUES ("say \"hi\"", 1);
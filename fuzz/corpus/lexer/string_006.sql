@@ -0,0 +1,3 @@
+INSERT INTO t VALUES ('multi
+line
+string', 1);
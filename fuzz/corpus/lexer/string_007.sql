@@ -0,0 +1 @@
+INSERT INTO t VALUES ('tab	here', 1);
@@ -0,0 +1 @@
+INSERT INTO t VALUES ('back\\slash', 1);
@@ -0,0 +1 @@
+INSERT INTO t VALUES ("mixed ' quote", 1);
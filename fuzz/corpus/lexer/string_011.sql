@@ -0,0 +1 @@
+INSERT INTO t VALUES ('unicode é ü 日本', 1);
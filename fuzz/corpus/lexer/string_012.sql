@@ -0,0 +1 @@
+INSERT INTO t VALUES ('ends with backslash\', 1);
@@ -0,0 +1 @@
+INSERT INTO t VALUES ('-- not a comment', 1);
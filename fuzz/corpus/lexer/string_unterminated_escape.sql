@@ -0,0 +1 @@
+SELECT 'abc\'
\ No newline at end of file
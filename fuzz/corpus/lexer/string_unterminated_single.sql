@@ -0,0 +1 @@
+SELECT 'never closed FROM t;
@@ -0,0 +1,6 @@
+
+
+
+SELECT 1;
+
+
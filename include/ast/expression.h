@@ -0,0 +1,105 @@
+#ifndef MINIQL_AST_EXPRESSION_H
+#define MINIQL_AST_EXPRESSION_H
+
+#include "common/value.h"
+#include "lexer/scanner.h"
+#include <memory>
+#include <string>
+
+namespace miniql {
+namespace ast {
+
+// EXPRESSÕES (cláusula WHERE)
+// Árvore produzida pelo parser para condições e aritmética:
+//   WHERE price * 2 > 100 AND NOT name = 'x'
+// vira BinaryExpr(AND, BinaryExpr(GT, BinaryExpr(MUL, ...), ...), UnaryExpr(NOT, ...))
+
+enum class ExprType { COLUMN, LITERAL, BINARY, UNARY };
+
+enum class BinaryOp {
+    // Aritméticos
+    ADD, SUB, MUL, DIV, MOD,
+    // Relacionais
+    EQ, NE, LT, LE, GT, GE,
+    // Lógicos
+    AND, OR
+};
+
+enum class UnaryOp { NOT, NEGATE };
+
+class Expression {
+public:
+    virtual ~Expression() = default;
+    virtual ExprType getType() const = 0;
+};
+
+using ExprPtr = std::unique_ptr<Expression>;
+
+// Referência a coluna; column_index é resolvido contra o schema
+// (-1 enquanto não resolvido)
+class ColumnExpr : public Expression {
+public:
+    explicit ColumnExpr(const std::string& name, int index = -1)
+        : column_name(name), column_index(index) {}
+    ExprType getType() const override { return ExprType::COLUMN; }
+
+    std::string table_name;     // qualificador opcional (t.col)
+    std::string column_name;
+    int column_index;
+};
+
+class LiteralExpr : public Expression {
+public:
+    explicit LiteralExpr(Value v) : value(std::move(v)) {}
+    ExprType getType() const override { return ExprType::LITERAL; }
+
+    Value value;
+};
+
+class BinaryExpr : public Expression {
+public:
+    BinaryExpr(BinaryOp o, ExprPtr l, ExprPtr r)
+        : op(o), left(std::move(l)), right(std::move(r)) {}
+    ExprType getType() const override { return ExprType::BINARY; }
+
+    BinaryOp op;
+    ExprPtr left;
+    ExprPtr right;
+};
+
+class UnaryExpr : public Expression {
+public:
+    UnaryExpr(UnaryOp o, ExprPtr e) : op(o), operand(std::move(e)) {}
+    ExprType getType() const override { return ExprType::UNARY; }
+
+    UnaryOp op;
+    ExprPtr operand;
+};
+
+// Construtores abreviados
+ExprPtr makeColumn(const std::string& name, int index = -1);
+ExprPtr makeLiteral(Value value);
+ExprPtr makeBinary(BinaryOp op, ExprPtr left, ExprPtr right);
+ExprPtr makeUnary(UnaryOp op, ExprPtr operand);
+
+// Classificação de operadores
+bool isComparison(BinaryOp op);
+bool isArithmetic(BinaryOp op);
+bool isLogical(BinaryOp op);
+
+// Inverte o lado de uma comparação: (5 < col) == (col > 5)
+BinaryOp flipComparison(BinaryOp op);
+
+// Operador correspondente a um token (PLUS -> ADD, LESS_EQUAL -> LE, ...);
+// retorna false se o token não for operador binário
+bool binaryOpFromToken(lexer::TokenType type, BinaryOp& op);
+
+std::string binaryOpToString(BinaryOp op);
+
+// Representação em SQL (para EXPLAIN e mensagens)
+std::string expressionToString(const Expression& expr);
+
+} // namespace ast
+} // namespace miniql
+
+#endif // MINIQL_AST_EXPRESSION_H
@@ -0,0 +1,49 @@
+#ifndef MINIQL_CATALOG_SCHEMA_H
+#define MINIQL_CATALOG_SCHEMA_H
+
+#include "common/value.h"
+#include <string>
+#include <vector>
+
+namespace miniql {
+namespace catalog {
+
+// Definição de uma coluna
+struct Column {
+    std::string name;
+    DataType type = DataType::INT;
+    bool primary_key = false;
+    bool unique = false;
+    bool not_null = false;
+
+    Column() = default;
+    Column(const std::string& n, DataType t) : name(n), type(t) {}
+};
+
+// Engine de armazenamento: CREATE TABLE ... ENGINE = DISK | MEMORY
+//   DISK   - páginas no buffer pool (padrão)
+//   MEMORY - linhas só em memória, índices hash nas colunas UNIQUE/PRIMARY
+//            KEY; durabilidade vem apenas do WAL
+enum class TableEngine {
+    DISK, MEMORY
+};
+
+std::string tableEngineToString(TableEngine engine);
+
+// Case-insensitive; false se o nome não for de uma engine
+bool parseTableEngine(const std::string& name, TableEngine& engine);
+
+// Schema de uma tabela
+struct TableSchema {
+    std::string name;
+    std::vector<Column> columns;
+    TableEngine engine = TableEngine::DISK;
+
+    // Posição da coluna (case-insensitive) ou -1 se não existir
+    int columnIndex(const std::string& column_name) const;
+};
+
+} // namespace catalog
+} // namespace miniql
+
+#endif // MINIQL_CATALOG_SCHEMA_H
@@ -0,0 +1,15 @@
+#ifndef MINIQL_COMMON_CRC32_H
+#define MINIQL_COMMON_CRC32_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace miniql {
+
+// CRC-32 (polinômio IEEE 802.3) para detectar registros corrompidos
+// ou escritos pela metade no disco
+uint32_t crc32(const void* data, size_t length, uint32_t seed = 0);
+
+} // namespace miniql
+
+#endif // MINIQL_COMMON_CRC32_H
@@ -0,0 +1,86 @@
+#ifndef MINIQL_COMMON_VALUE_H
+#define MINIQL_COMMON_VALUE_H
+
+#include <cstdint>
+#include <string>
+#include <variant>
+#include <vector>
+
+namespace miniql {
+
+// TIPOS DE DADOS DAS COLUNAS
+// DATE e TIMESTAMP são armazenados como inteiros (dias e microssegundos
+// desde a epoch), então comparam e ordenam como INT.
+enum class DataType {
+    INT, REAL, TEXT, BLOB, DATE, TIMESTAMP
+};
+
+std::string dataTypeToString(DataType type);
+
+// Tipos com ordem numérica (têm min/max, interpolação em histogramas, etc.)
+bool isNumericType(DataType type);
+
+// VALUE:
+// Valor de uma célula. NULL, inteiro de 64 bits, real ou texto.
+// Inteiros e reais são comparáveis entre si; NULL é menor que tudo e
+// números vêm antes de textos na ordenação.
+
+class Value {
+public:
+    enum class Kind { NULL_VALUE, INTEGER, REAL, TEXT };
+
+    Value() = default;
+
+    static Value null() { return Value(); }
+    static Value integer(int64_t v) { Value value; value.data_ = v; return value; }
+    static Value real(double v) { Value value; value.data_ = v; return value; }
+    static Value text(std::string v) { Value value; value.data_ = std::move(v); return value; }
+
+    Kind kind() const { return static_cast<Kind>(data_.index()); }
+    bool isNull() const { return kind() == Kind::NULL_VALUE; }
+    bool isNumeric() const { return kind() == Kind::INTEGER || kind() == Kind::REAL; }
+
+    int64_t asInt() const;                  // REAL é truncado
+    double asReal() const;                  // INTEGER é convertido
+    const std::string& asText() const { return std::get<std::string>(data_); }
+
+    // Acesso direto, sem conversão nem checagem (o chamador já conferiu kind())
+    int64_t intValue() const { return *std::get_if<int64_t>(&data_); }
+    double realValue() const { return *std::get_if<double>(&data_); }
+
+    // <0, 0, >0 como strcmp; NaN vem depois de todos os outros números
+    int compare(const Value& other) const;
+
+    bool operator==(const Value& other) const { return compare(other) == 0; }
+    bool operator!=(const Value& other) const { return compare(other) != 0; }
+    bool operator<(const Value& other) const { return compare(other) < 0; }
+    bool operator<=(const Value& other) const { return compare(other) <= 0; }
+    bool operator>(const Value& other) const { return compare(other) > 0; }
+    bool operator>=(const Value& other) const { return compare(other) >= 0; }
+
+    // Hash de 64 bits bem distribuído (consistente com operator==)
+    uint64_t hash() const;
+
+    std::string toString() const;
+
+private:
+    std::variant<std::monostate, int64_t, double, std::string> data_;
+};
+
+using Row = std::vector<Value>;
+
+// Mistura de bits (splitmix64) usada pelos hashes do projeto
+inline uint64_t mixHash(uint64_t x) {
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+struct ValueHash {
+    size_t operator()(const Value& value) const { return static_cast<size_t>(value.hash()); }
+};
+
+} // namespace miniql
+
+#endif // MINIQL_COMMON_VALUE_H
@@ -0,0 +1,147 @@
+#ifndef MINIQL_EXECUTOR_MATERIALIZED_VIEW_H
+#define MINIQL_EXECUTOR_MATERIALIZED_VIEW_H
+
+#include "common/value.h"
+#include "executor/result_set.h"
+#include "lexer/scanner.h"
+#include "storage/memory_table.h"
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace miniql {
+namespace executor {
+
+// VIEWS MATERIALIZADAS INCREMENTAIS
+//
+//   CREATE MATERIALIZED VIEW vendas_por_regiao AS
+//     SELECT region, COUNT(*), SUM(amount), MIN(price), MAX(price)
+//     FROM sales GROUP BY region;
+//
+// A view guarda um estado por grupo e é mantida pelo delta de cada INSERT
+// e DELETE da tabela (observador da MemoryTable), sem recalcular nada:
+//   COUNT      contador (+1 / -1)
+//   SUM        soma e nº de não-NULL (SUM só de NULLs é NULL)
+//   MIN / MAX  multiconjunto ordenado dos valores, para suportar retração:
+//              remover o mínimo atual expõe o próximo
+// Um grupo some quando sua última linha é removida; sem GROUP BY existe
+// sempre exatamente uma linha (COUNT 0 e SUM NULL na tabela vazia).
+//
+// Ler a view custa O(grupos) em vez de O(tabela). A ordem das linhas não é
+// definida, como num SELECT sem ORDER BY.
+
+enum class AggregateFunction { COUNT, SUM, MIN, MAX };
+
+std::string aggregateFunctionToString(AggregateFunction function);
+
+// Case-insensitive; false se o nome não for de um agregado suportado
+bool parseAggregateFunction(const std::string& name, AggregateFunction& function);
+
+// Item do SELECT da view: coluna do GROUP BY ou agregado
+struct ViewColumn {
+    bool aggregate = false;
+    AggregateFunction function = AggregateFunction::COUNT;
+    std::string column;         // vazio em COUNT(*)
+    std::string alias;          // vazio: nome gerado (region, SUM(amount))
+
+    std::string outputName() const;
+};
+
+struct ViewDefinition {
+    std::string name;
+    std::string table;
+    std::vector<ViewColumn> columns;
+    std::vector<std::string> group_by;
+
+    // SQL equivalente (para mensagens e .schema)
+    std::string toSql() const;
+};
+
+// CREATE MATERIALIZED VIEW nome AS SELECT itens FROM tabela [GROUP BY cols] [;]
+// item: coluna [AS alias] | COUNT(*) | FUNÇÃO(coluna) [AS alias]
+// Lança std::runtime_error ("[Line L, Col C] ...") em erro de sintaxe.
+ViewDefinition parseMaterializedView(const std::vector<lexer::Token>& tokens);
+
+class MaterializedView : public storage::RowObserver {
+public:
+    // Resolve a definição contra o schema da tabela, calcula o estado
+    // inicial e passa a receber os deltas. Lança std::runtime_error se a
+    // definição não for válida para a tabela. A tabela precisa viver mais
+    // que a view.
+    MaterializedView(ViewDefinition definition, storage::MemoryTable& table);
+    ~MaterializedView() override;
+
+    MaterializedView(const MaterializedView&) = delete;
+    MaterializedView& operator=(const MaterializedView&) = delete;
+
+    const ViewDefinition& definition() const { return definition_; }
+    const std::vector<std::string>& columnNames() const { return column_names_; }
+
+    // Resultado atual, O(grupos)
+    std::vector<Row> rows() const;
+    std::unique_ptr<ResultCursor> read() const;
+
+    size_t groupCount() const;
+    size_t memoryBytes() const;
+
+    void rowInserted(const Row& row) override;
+    void rowErased(const Row& row) override;
+
+private:
+    struct Aggregate {
+        AggregateFunction function;
+        int column;                 // -1 em COUNT(*)
+        bool real;                  // SUM sobre coluna REAL
+        int ordered;                // multiconjunto usado por MIN/MAX (-1: nenhum)
+    };
+
+    struct Accumulator {
+        uint64_t count = 0;         // valores não-NULL
+        int64_t int_sum = 0;
+        double real_sum = 0.0;
+    };
+
+    struct Group {
+        uint64_t rows = 0;
+        std::vector<Accumulator> accumulators;              // por agregado
+        std::vector<std::map<Value, uint64_t>> ordered;     // por coluna de MIN/MAX
+    };
+
+    struct RowHash {
+        size_t operator()(const Row& key) const;
+    };
+
+    ViewDefinition definition_;
+    storage::MemoryTable& table_;
+    std::vector<std::string> column_names_;
+
+    std::vector<size_t> group_columns_;     // colunas da tabela no GROUP BY
+    std::vector<Aggregate> aggregates_;
+    std::vector<size_t> ordered_columns_;   // colunas com MIN/MAX (sem repetição)
+    std::vector<int> outputs_;              // por coluna de saída: >= 0 agregado, < 0 -(posição no GROUP BY)-1
+
+    mutable std::shared_mutex mutex_;
+    std::unordered_map<Row, Group, RowHash> groups_;
+
+    Row groupKey(const Row& row) const;
+    Group newGroup() const;
+    Row output(const Row& key, const Group& group) const;
+};
+
+// Recalcula a consulta da view do zero com um scan completo. Implementação
+// independente da manutenção incremental, usada para conferi-la.
+std::vector<Row> recomputeView(const MaterializedView& view, const storage::MemoryTable& table);
+
+// Compara dois resultados ignorando a ordem das linhas (reais com
+// tolerância relativa, por causa das somas com retração). Se diferirem,
+// preenche difference com a primeira diferença.
+bool sameViewRows(std::vector<Row> a, std::vector<Row> b, std::string& difference);
+
+} // namespace executor
+} // namespace miniql
+
+#endif // MINIQL_EXECUTOR_MATERIALIZED_VIEW_H
@@ -0,0 +1,103 @@
+#ifndef MINIQL_EXECUTOR_PREDICATE_H
+#define MINIQL_EXECUTOR_PREDICATE_H
+
+#include "ast/expression.h"
+#include "catalog/schema.h"
+#include "common/value.h"
+#include <string>
+#include <vector>
+
+namespace miniql {
+namespace executor {
+
+// AVALIAÇÃO DE PREDICADOS (WHERE)
+//
+// Dois caminhos:
+// 1. Interpretador genérico: percorre a AST a cada linha (qualquer expressão)
+// 2. Kernels pré-compilados: formatos comuns viram chamadas diretas a
+//    funções template especializadas por tipo de coluna e operador:
+//      col op const
+//      col op const AND/OR col op const ...
+//      col arith const op const        (ex: price * 2 > 100)
+//
+// compilePredicate() escolhe kernels quando possível e usa o interpretador
+// para o que sobrar.
+
+// Resolve ColumnExpr::column_index pelo nome; retorna false (e preenche
+// error) se alguma coluna não existir no schema
+bool resolveColumns(ast::Expression& expr, const catalog::TableSchema& schema, std::string& error);
+
+// Interpretador: lógica de três valores do SQL (NULL propaga; comparações
+// retornam 1/0 ou NULL)
+Value evaluate(const ast::Expression& expr, const Row& row);
+
+// Valor "verdadeiro" para o WHERE (NULL e 0 são falsos)
+bool isTrue(const Value& value);
+
+// Estado de um kernel folha
+struct KernelState {
+    int column = -1;
+    int64_t int_operand = 0;        // constante da aritmética (INT)
+    int64_t int_constant = 0;       // constante da comparação (INT)
+    double real_operand = 0.0;
+    double real_constant = 0.0;
+    std::string text_constant;
+};
+
+using KernelFn = bool (*)(const KernelState& state, const Row& row);
+
+struct Kernel {
+    KernelFn fn;
+    KernelState state;
+    std::string name;               // para EXPLAIN / debug
+};
+
+class CompiledPredicate {
+public:
+    // Sem predicado: aceita todas as linhas
+    CompiledPredicate() = default;
+
+    bool matches(const Row& row) const {
+        if (mode_ == Mode::ANY_OF) {
+            for (const Kernel& kernel : kernels_) {
+                if (kernel.fn(kernel.state, row)) return true;
+            }
+            return false;
+        }
+        for (const Kernel& kernel : kernels_) {
+            if (!kernel.fn(kernel.state, row)) return false;
+        }
+        for (const ast::Expression* term : interpreted_) {
+            if (!isTrue(evaluate(*term, row))) return false;
+        }
+        return true;
+    }
+
+    // true se nenhum termo precisa do interpretador
+    bool fullyCompiled() const { return interpreted_.empty(); }
+    size_t kernelCount() const { return kernels_.size(); }
+
+    std::string describe() const;
+
+private:
+    friend CompiledPredicate compilePredicate(const ast::Expression* predicate,
+                                              const catalog::TableSchema& schema);
+
+    enum class Mode { ALL_OF, ANY_OF };
+
+    Mode mode_ = Mode::ALL_OF;
+    std::vector<Kernel> kernels_;
+    std::vector<const ast::Expression*> interpreted_;   // não pertencem ao predicado
+};
+
+// Compila o predicado (colunas já resolvidas). A expressão precisa viver
+// mais que o CompiledPredicate, que guarda ponteiros para os termos
+// interpretados. predicate == nullptr aceita todas as linhas.
+// Os kernels assumem linhas com todas as colunas do schema.
+CompiledPredicate compilePredicate(const ast::Expression* predicate,
+                                   const catalog::TableSchema& schema);
+
+} // namespace executor
+} // namespace miniql
+
+#endif // MINIQL_EXECUTOR_PREDICATE_H
@@ -0,0 +1,166 @@
+#ifndef MINIQL_EXECUTOR_RESULT_CACHE_H
+#define MINIQL_EXECUTOR_RESULT_CACHE_H
+
+#include "common/value.h"
+#include "lexer/scanner.h"
+#include "storage/memory_table.h"
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace miniql {
+namespace executor {
+
+// CACHE DE RESULTADOS DA SESSÃO
+// SELECTs idênticos repetidos em sequência (dashboards, clientes fazendo
+// polling) devolvem o resultado guardado sem executar de novo.
+//
+// Chave: a sequência de tokens do Scanner normalizada. Espaços e
+// comentários já somem no lexer; keywords viram o tipo do token e
+// identificadores vão para minúsculas (nomes são case-insensitive), então
+//   select  *  from Users -- x        e        SELECT * FROM users;
+// caem na mesma entrada. Literais ficam como estão ('Bob' != 'bob').
+//
+// Validade: cada tabela tem um contador de modificações. A entrada guarda
+// o contador das tabelas que lê (FROM/JOIN) no momento em que a execução
+// começou; uma escrita na tabela incrementa o contador e descarta na hora
+// as entradas que a referenciam. Uma entrada só é servida se todos os
+// contadores ainda baterem.
+//
+// Views materializadas: a chave registra o nome da view, mas quem recebe
+// as escritas é a tabela base. addView() liga os dois nomes e toda escrita
+// na tabela (noteWrite, pelo shell ou pelo CacheInvalidator) conta também
+// como escrita em cada view dela.
+//
+// Limite: memória estimada das entradas (LRU). Resultados maiores que 1/4
+// do limite não são guardados.
+
+constexpr size_t DEFAULT_RESULT_CACHE_BYTES = 16u << 20;
+
+struct CacheKey {
+    std::string text;                   // tokens normalizados
+    std::vector<std::string> tables;    // tabelas lidas (minúsculas, sem repetição)
+    bool cacheable = false;             // SELECT
+};
+
+// Chave de um statement já tokenizado (sem erros léxicos)
+CacheKey makeCacheKey(const std::vector<lexer::Token>& tokens);
+
+// Tabela escrita pelo statement (INSERT INTO t, UPDATE t, DELETE FROM t,
+// CREATE/DROP TABLE t, CREATE/DROP [MATERIALIZED] VIEW v), em minúsculas;
+// "" se não for escrita. As views de t são invalidadas pelo noteWrite(t).
+std::string writtenTable(const std::vector<lexer::Token>& tokens);
+
+struct CachedResult {
+    std::vector<std::string> columns;
+    std::vector<Row> rows;
+};
+
+// Contadores das tabelas no momento do miss; store() só guarda se nenhuma
+// tabela mudou durante a execução
+struct CacheTicket {
+    std::vector<uint64_t> versions;
+};
+
+struct ResultCacheStats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t stores = 0;
+    uint64_t invalidations = 0;         // entradas descartadas por escrita
+    uint64_t evictions = 0;             // entradas descartadas pelo limite
+    uint64_t rejected = 0;              // resultados grandes demais ou obsoletos
+    size_t entries = 0;
+    size_t bytes = 0;
+    size_t capacity = 0;
+
+    double hitRate() const { return hits + misses ? double(hits) / double(hits + misses) : 0.0; }
+};
+
+class ResultCache {
+public:
+    // capacity_bytes == 0: cache desligado
+    explicit ResultCache(size_t capacity_bytes = DEFAULT_RESULT_CACHE_BYTES);
+
+    ResultCache(const ResultCache&) = delete;
+    ResultCache& operator=(const ResultCache&) = delete;
+
+    // Resultado válido para a chave ou nullptr. No miss preenche o ticket
+    // (se dado) para o store() do resultado executado. O resultado continua
+    // válido mesmo se a entrada for descartada depois.
+    std::shared_ptr<const CachedResult> lookup(const CacheKey& key, CacheTicket* ticket = nullptr);
+
+    void store(const CacheKey& key, const CacheTicket& ticket, CachedResult result);
+
+    // Uma escrita na tabela: incrementa o contador e descarta as entradas
+    // que a leem ou que leem uma view dela
+    void noteWrite(const std::string& table);
+
+    // View materializada sobre a tabela base (uma view por nome; registrar
+    // de novo troca a tabela)
+    void addView(const std::string& view, const std::string& table);
+    void removeView(const std::string& view);
+    uint64_t tableVersion(const std::string& table) const;
+
+    // Reduzir o limite descarta as entradas menos usadas
+    void setCapacity(size_t bytes);
+    bool enabled() const;
+
+    void clear();
+    void resetStats();
+    ResultCacheStats stats() const;
+
+private:
+    struct Entry {
+        std::shared_ptr<const CachedResult> result;
+        std::vector<std::string> tables;
+        std::vector<uint64_t> versions;
+        size_t bytes = 0;
+        std::list<std::string>::iterator lru;
+    };
+
+    mutable std::mutex mutex_;
+    size_t capacity_;
+    size_t bytes_ = 0;
+    std::unordered_map<std::string, Entry> entries_;
+    std::list<std::string> lru_;        // mais recente na frente
+    std::unordered_map<std::string, uint64_t> versions_;
+    std::unordered_map<std::string, std::unordered_set<std::string>> by_table_;
+    std::unordered_map<std::string, std::string> view_table_;                     // view → tabela base
+    std::unordered_map<std::string, std::unordered_set<std::string>> table_views_; // tabela → views
+    ResultCacheStats stats_;
+
+    uint64_t versionLocked(const std::string& table) const;
+    void noteWriteLocked(const std::string& table);
+    void eraseLocked(std::unordered_map<std::string, Entry>::iterator it);
+    void evictLocked();
+};
+
+// Invalida o cache a cada linha inserida ou removida numa MemoryTable
+// (escritas que não passam pelo shell), inclusive as entradas que leem as
+// views registradas da tabela. Desliga-se no destrutor.
+class CacheInvalidator : public storage::RowObserver {
+public:
+    CacheInvalidator(ResultCache& cache, storage::MemoryTable& table);
+    ~CacheInvalidator() override;
+
+    CacheInvalidator(const CacheInvalidator&) = delete;
+    CacheInvalidator& operator=(const CacheInvalidator&) = delete;
+
+    void rowInserted(const Row&) override { cache_.noteWrite(table_name_); }
+    void rowErased(const Row&) override { cache_.noteWrite(table_name_); }
+
+private:
+    ResultCache& cache_;
+    storage::MemoryTable& table_;
+    std::string table_name_;
+};
+
+} // namespace executor
+} // namespace miniql
+
+#endif // MINIQL_EXECUTOR_RESULT_CACHE_H
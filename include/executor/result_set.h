@@ -0,0 +1,48 @@
+#ifndef MINIQL_EXECUTOR_RESULT_SET_H
+#define MINIQL_EXECUTOR_RESULT_SET_H
+
+#include "common/value.h"
+#include <string>
+#include <vector>
+
+namespace miniql {
+namespace executor {
+
+// CURSOR DE RESULTADO
+// O executor devolve um cursor em vez de um ResultSet materializado: quem
+// consome (shell, export) puxa lotes de linhas sob demanda, então exportar
+// uma tabela enorme usa memória proporcional ao tamanho do lote.
+
+constexpr size_t DEFAULT_BATCH_SIZE = 1024;
+
+class ResultCursor {
+public:
+    virtual ~ResultCursor() = default;
+
+    virtual const std::vector<std::string>& columnNames() const = 0;
+
+    // Substitui o conteúdo de batch por até max_rows linhas.
+    // Retorna false quando não há mais linhas (batch fica vazio).
+    virtual bool nextBatch(std::vector<Row>& batch, size_t max_rows) = 0;
+};
+
+// Cursor sobre linhas já materializadas (resultados pequenos, comandos
+// que retornam poucas linhas)
+class VectorCursor : public ResultCursor {
+public:
+    VectorCursor(std::vector<std::string> columns, std::vector<Row> rows)
+        : columns_(std::move(columns)), rows_(std::move(rows)), position_(0) {}
+
+    const std::vector<std::string>& columnNames() const override { return columns_; }
+    bool nextBatch(std::vector<Row>& batch, size_t max_rows) override;
+
+private:
+    std::vector<std::string> columns_;
+    std::vector<Row> rows_;
+    size_t position_;
+};
+
+} // namespace executor
+} // namespace miniql
+
+#endif // MINIQL_EXECUTOR_RESULT_SET_H
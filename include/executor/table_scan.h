@@ -0,0 +1,64 @@
+#ifndef MINIQL_EXECUTOR_TABLE_SCAN_H
+#define MINIQL_EXECUTOR_TABLE_SCAN_H
+
+#include "ast/expression.h"
+#include "executor/predicate.h"
+#include "metrics/metrics.h"
+#include "storage/memory_table.h"
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace miniql {
+namespace executor {
+
+// SEQ SCAN COM ZONE MAPS
+// Os termos "coluna op literal" do AND de nível superior do WHERE viram
+// limites por coluna; blocos cujo zone map exclui algum limite não são
+// lidos, e as linhas dos blocos restantes passam pelo predicado compilado.
+// OR, NOT, <> e aritmética não geram limites (o bloco é lido).
+
+// Limites dos termos comparáveis com literal numérico (colunas resolvidas)
+std::vector<storage::ColumnRange> extractColumnRanges(const ast::Expression* predicate);
+
+struct ScanStats {
+    storage::ZoneScanStats zone;
+    size_t rows_matched = 0;
+    double seconds = 0.0;
+};
+
+// Chama emit(row_id, row) para cada linha que satisfaz o predicado
+// (colunas já resolvidas; nullptr aceita tudo). use_zone_maps = false lê
+// todos os blocos, para comparação.
+template <typename Fn>
+ScanStats scanTable(const storage::MemoryTable& table, const ast::Expression* predicate, Fn&& emit,
+                    bool use_zone_maps = true) {
+    auto start = std::chrono::steady_clock::now();
+    CompiledPredicate filter = compilePredicate(predicate, table.schema());
+    std::vector<storage::ColumnRange> ranges;
+    if (use_zone_maps) ranges = extractColumnRanges(predicate);
+
+    ScanStats stats;
+    stats.zone = table.scan(ranges, [&](storage::RowId id, const Row& row) {
+        if (!filter.matches(row)) return;
+        stats.rows_matched++;
+        emit(id, row);
+    });
+    stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    metrics::increment(metrics::Counter::ZONE_BLOCKS_SKIPPED, stats.zone.blocks_skipped);
+    return stats;
+}
+
+// Plano executado, no formato de EXPLAIN ANALYZE:
+//   Seq Scan on events  (actual rows=1000 time=0.412 ms)
+//     Filter: [ts >= 5000 (INT)]
+//     Zone map: ts >= 5000
+//     Blocks: 98 total, 97 skipped by zone map, 1 read
+//     Rows examined: 1024
+std::string explainAnalyze(const storage::MemoryTable& table, const ast::Expression* predicate,
+                           const ScanStats& stats);
+
+} // namespace executor
+} // namespace miniql
+
+#endif // MINIQL_EXECUTOR_TABLE_SCAN_H
@@ -0,0 +1,37 @@
+#ifndef MINIQL_LEXER_REFERENCE_SCANNER_H
+#define MINIQL_LEXER_REFERENCE_SCANNER_H
+
+#include "lexer/scanner.h"
+#include <string>
+#include <vector>
+
+namespace miniql {
+namespace lexer {
+
+// LEXER DE REFERÊNCIA
+// Implementação propositalmente ingênua da mesma especificação do Scanner:
+// um laço só, um caractere por vez, sem tabela hash nem atalhos. Existe
+// para testes diferenciais: qualquer otimização do Scanner (zero-copy,
+// SIMD, lexing paralelo) tem que produzir exatamente os mesmos tokens e os
+// mesmos erros que esta versão.
+//
+// Especificação (a mesma do Scanner):
+// - linha começa em 1, coluna em 0; cada caractere consumido soma 1 na
+//   coluna; depois de um '\n' (em qualquer lugar, inclusive dentro de
+//   strings e comentários) a linha soma 1 e a coluna volta a 0
+// - token e erro levam a linha/coluna do ponto em que terminaram
+// - STRING: lexeme sem as aspas; \<aspa> vira a aspa; sem fechamento é
+//   erro e não gera token
+// - NUMBER: dígitos [ '.' dígitos ]; valor via std::stod, erro se estourar
+// - comentários -- e /* */ não geram token; /* sem fechamento é erro
+
+std::vector<Token> referenceScan(const std::string& source, std::vector<std::string>& errors);
+
+// Compara Scanner e referência; string vazia se forem idênticos, senão a
+// primeira diferença descrita
+std::string diffAgainstReference(const std::string& source);
+
+} // namespace lexer
+} // namespace miniql
+
+#endif // MINIQL_LEXER_REFERENCE_SCANNER_H
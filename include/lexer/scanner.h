@@ -47,7 +47,11 @@ enum class TokenType {
     WHITESPACE,      // espaços, tabs (geralmente ignorados)
     COMMENT,         // -- comentário ou /* comentário */
     END_OF_FILE,     // fim do input
-    UNKNOWN          // token não reconhecido (erro léxico)
+    UNKNOWN,         // token não reconhecido (erro léxico)
+
+    // Palavras-chave não reservadas (ver isNameToken). Ficam no fim para
+    // não renumerar os tipos acima
+    ANALYZE, ENGINE, MATERIALIZED, VIEW
 };
 
 
@@ -71,6 +75,17 @@ struct Token {
     std::string typeToString() const;
 };
 
+// ANALYZE, ENGINE, MATERIALIZED e VIEW têm token próprio, mas não são
+// reservadas: onde a sintaxe espera um nome (tabela, coluna, alias) elas
+// valem como identificador, então uma coluna chamada view ou engine
+// continua funcionando
+bool isNonReservedKeyword(TokenType type);
+
+// IDENTIFIER ou palavra-chave não reservada
+inline bool isNameToken(const Token& token) {
+    return token.type == TokenType::IDENTIFIER || isNonReservedKeyword(token.type);
+}
+
 // SCANNER / LEXER:
 // Responsável pela análise léxica do código SQL
 // Transforma o texto de entrada em uma sequência de tokens
@@ -120,7 +135,7 @@ private:
     void scanNumber();           // números: 123, 45.67
     void scanString(char quote); // strings: 'texto' ou "texto"
     void scanIdentifier();       // identificadores e keywords
-    void scanComment();          // comentários: -- ou /* */
+    void scanComment(char opener); // comentários: -- ou /* */ (abertura já consumida)
     
     // Gerenciamento de erros
     void addError(const std::string& message);
@@ -0,0 +1,184 @@
+#ifndef MINIQL_METRICS_METRICS_H
+#define MINIQL_METRICS_METRICS_H
+
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace miniql {
+namespace metrics {
+
+// MÉTRICAS DE RUNTIME:
+// Contadores e histogramas de latência por thread. Cada thread escreve
+// apenas no seu próprio shard (sem lock, sem instrução atômica com lock
+// prefix); a agregação só acontece quando alguém pede um snapshot
+// (.stats ou dump Prometheus), então o custo no caminho quente é de
+// poucas instruções por evento.
+
+enum class Counter {
+    // Statements por tipo (classificados pelo primeiro token)
+    STMT_SELECT,
+    STMT_INSERT,
+    STMT_UPDATE,
+    STMT_DELETE,
+    STMT_CREATE,
+    STMT_DROP,
+    STMT_OTHER,
+
+    // Lexer
+    TOKENS_SCANNED,
+    LEX_ERRORS,
+
+    // Buffer pool (storage engine)
+    BUFFER_POOL_HITS,
+    BUFFER_POOL_MISSES,
+    PAGES_PREFETCHED,   // read-ahead de scans sequenciais
+    PAGES_WRITTEN,      // páginas gravadas no arquivo de dados
+
+    // Scans
+    ZONE_BLOCKS_SKIPPED,    // blocos descartados pelos zone maps
+
+    // Cache de resultados da sessão
+    RESULT_CACHE_HITS,
+    RESULT_CACHE_MISSES,
+
+    // Alocações de memória (apenas com MINIQL_TRACK_ALLOCATIONS)
+    ALLOCATIONS,
+
+    COUNT_
+};
+
+enum class Histogram {
+    LEX_LATENCY,        // Scanner::scanTokens() por statement (amostrado, SampledTimer)
+    WAL_FSYNC_LATENCY,  // fsync do WAL (FASE 10)
+
+    COUNT_
+};
+
+constexpr size_t COUNTER_COUNT = static_cast<size_t>(Counter::COUNT_);
+constexpr size_t HISTOGRAM_COUNT = static_cast<size_t>(Histogram::COUNT_);
+
+// Histograma log-linear no estilo HDR: 16 sub-buckets por potência de 2,
+// o que dá ~6% de erro relativo máximo em qualquer faixa de valores
+// (de 1ns até ~584 anos) com tamanho fixo.
+constexpr unsigned HISTOGRAM_SUB_BITS = 4;
+constexpr size_t HISTOGRAM_SUB_COUNT = size_t(1) << HISTOGRAM_SUB_BITS;
+constexpr size_t HISTOGRAM_BUCKETS = (64 - HISTOGRAM_SUB_BITS + 1) * HISTOGRAM_SUB_COUNT;
+
+// Índice do bucket para um valor e limite inferior de um bucket
+size_t bucketIndex(uint64_t value);
+uint64_t bucketLowerBound(size_t index);
+
+struct HistogramSnapshot {
+    uint64_t count = 0;
+    uint64_t sum = 0;
+    uint64_t min = 0;
+    uint64_t max = 0;
+    std::vector<uint64_t> buckets = std::vector<uint64_t>(HISTOGRAM_BUCKETS, 0);
+
+    // Valor aproximado no percentil p (0.0 a 1.0)
+    uint64_t percentile(double p) const;
+    double mean() const { return count ? double(sum) / double(count) : 0.0; }
+};
+
+struct Snapshot {
+    std::vector<uint64_t> counters = std::vector<uint64_t>(COUNTER_COUNT, 0);
+    std::vector<HistogramSnapshot> histograms = std::vector<HistogramSnapshot>(HISTOGRAM_COUNT);
+    double uptime_seconds = 0.0;
+
+    uint64_t counter(Counter c) const { return counters[static_cast<size_t>(c)]; }
+    const HistogramSnapshot& histogram(Histogram h) const {
+        return histograms[static_cast<size_t>(h)];
+    }
+};
+
+// Registro de eventos (caminho quente). weight > 1: a amostra representa
+// weight eventos (SampledTimer)
+void increment(Counter counter, uint64_t n = 1);
+void record(Histogram histogram, uint64_t nanos, uint64_t weight = 1);
+
+// Liga/desliga o registro (ligado por padrão). Desligado, increment/record
+// e ScopedTimer não fazem nada; serve para medir o custo das métricas
+// (make run-memtable-bench)
+void setEnabled(bool enabled);
+bool enabled();
+
+// Agrega os shards de todas as threads (vivas e já encerradas)
+Snapshot snapshot();
+
+// Zera todos os contadores e histogramas
+void reset();
+
+// Saída legível (.stats)
+void printStats(std::ostream& out, const Snapshot& snap);
+
+// Saída no formato texto do Prometheus (exposition format 0.0.4)
+void writePrometheus(std::ostream& out, const Snapshot& snap);
+
+// Grava o dump Prometheus em arquivo; retorna false se não conseguir abrir
+bool dumpPrometheus(const std::string& path);
+
+// Nomes para exibição
+const char* counterName(Counter counter);
+const char* histogramName(Histogram histogram);
+
+// Mede o tempo de vida do escopo e registra no histograma
+class ScopedTimer {
+public:
+    explicit ScopedTimer(Histogram histogram) : histogram_(histogram), active_(enabled()) {
+        if (active_) start_ = std::chrono::steady_clock::now();
+    }
+
+    ~ScopedTimer() {
+        if (!active_) return;
+        auto elapsed = std::chrono::steady_clock::now() - start_;
+        record(histogram_, static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+    }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+    Histogram histogram_;
+    bool active_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+// Como o ScopedTimer, mas mede só 1 a cada SAMPLE_EVERY escopos da thread
+// (o primeiro, o 65º, ...) e registra a amostra com peso SAMPLE_EVERY:
+// contagem, média e percentis viram estimativas sem viés. Para caminhos de poucos microssegundos,
+// onde duas leituras do relógio por evento passariam de 1% (LEX_LATENCY).
+class SampledTimer {
+public:
+    static constexpr uint32_t SAMPLE_EVERY = 64;
+
+    explicit SampledTimer(Histogram histogram)
+        : histogram_(histogram), active_((tick_++ & (SAMPLE_EVERY - 1)) == 0 && enabled()) {
+        if (active_) start_ = std::chrono::steady_clock::now();
+    }
+
+    ~SampledTimer() {
+        if (!active_) return;
+        auto elapsed = std::chrono::steady_clock::now() - start_;
+        record(histogram_, static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()), SAMPLE_EVERY);
+    }
+
+    SampledTimer(const SampledTimer&) = delete;
+    SampledTimer& operator=(const SampledTimer&) = delete;
+
+private:
+    static inline thread_local uint32_t tick_ = 0;
+
+    Histogram histogram_;
+    bool active_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+} // namespace metrics
+} // namespace miniql
+
+#endif // MINIQL_METRICS_METRICS_H
@@ -0,0 +1,111 @@
+#ifndef MINIQL_OPTIMIZER_COST_MODEL_H
+#define MINIQL_OPTIMIZER_COST_MODEL_H
+
+#include "ast/expression.h"
+#include "optimizer/statistics.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace miniql {
+namespace optimizer {
+
+// MODELO DE CUSTO
+// Usa as estatísticas do ANALYZE para:
+// - estimar seletividade de predicados do WHERE
+// - ordenar predicados (mais seletivo e barato primeiro)
+// - escolher entre full scan e índice
+// - ordenar joins por programação dinâmica
+//
+// Unidade de custo: leitura sequencial de uma página = 1.0
+
+constexpr double SEQ_PAGE_COST = 1.0;
+constexpr double RANDOM_PAGE_COST = 4.0;
+constexpr double CPU_TUPLE_COST = 0.01;
+constexpr double CPU_OPERATOR_COST = 0.0025;
+constexpr double ROWS_PER_PAGE = 100.0;
+constexpr double INDEX_FANOUT = 256.0;
+
+// Seletividades padrão quando não há estatísticas (mesmas do System R)
+constexpr double DEFAULT_EQ_SELECTIVITY = 0.1;
+constexpr double DEFAULT_RANGE_SELECTIVITY = 1.0 / 3.0;
+
+// Limite de relações para a DP exata (acima disso usa heurística gulosa)
+constexpr size_t MAX_DP_RELATIONS = 12;
+
+// ============================================================================
+// PREDICADOS
+// ============================================================================
+
+// Fração das linhas que satisfazem o predicado (stats pode ser nullptr)
+double estimateSelectivity(const ast::Expression& predicate, const TableStats* stats);
+
+// Custo de CPU para avaliar o predicado em uma linha
+double estimateEvaluationCost(const ast::Expression& predicate);
+
+// Reordena a árvore de AND/OR para avaliação com curto-circuito:
+// em AND o termo com menor rank (sel - 1) / custo vem primeiro;
+// em OR o termo mais provável de ser verdadeiro vem primeiro
+ast::ExprPtr orderPredicates(ast::ExprPtr predicate, const TableStats* stats);
+
+// ============================================================================
+// CAMINHO DE ACESSO
+// ============================================================================
+
+struct IndexInfo {
+    std::string name;
+    int column_index;
+    bool unique;
+};
+
+enum class AccessMethod { SEQ_SCAN, INDEX_SCAN };
+
+struct AccessPath {
+    AccessMethod method = AccessMethod::SEQ_SCAN;
+    int index = -1;             // posição em indexes (INDEX_SCAN)
+    double cost = 0.0;
+    double rows = 0.0;          // linhas estimadas na saída
+};
+
+// Compara o full scan com cada índice utilizável por um termo
+// "coluna op literal" do AND de nível superior
+AccessPath chooseAccessPath(const TableStats* stats,
+                            const ast::Expression* predicate,
+                            const std::vector<IndexInfo>& indexes);
+
+// ============================================================================
+// ORDEM DE JOINS
+// ============================================================================
+
+struct JoinRelation {
+    std::string name;
+    double rows;                // cardinalidade após os filtros locais
+};
+
+struct JoinEdge {
+    size_t left;
+    size_t right;
+    double selectivity;         // ver equiJoinSelectivity
+};
+
+struct JoinPlan {
+    int relation = -1;          // folha: índice em relations; -1 em joins
+    double rows = 0.0;
+    double cost = 0.0;          // soma das cardinalidades intermediárias
+    std::unique_ptr<JoinPlan> left;
+    std::unique_ptr<JoinPlan> right;
+
+    std::string toString(const std::vector<JoinRelation>& relations) const;
+};
+
+// Seletividade de a.x = b.y: 1 / max(distintos(a.x), distintos(b.y))
+double equiJoinSelectivity(const ColumnStats* left, const ColumnStats* right);
+
+// Melhor árvore de joins (bushy, sem produtos cartesianos quando possível)
+JoinPlan optimizeJoinOrder(const std::vector<JoinRelation>& relations,
+                           const std::vector<JoinEdge>& edges);
+
+} // namespace optimizer
+} // namespace miniql
+
+#endif // MINIQL_OPTIMIZER_COST_MODEL_H
@@ -0,0 +1,108 @@
+#ifndef MINIQL_OPTIMIZER_STATISTICS_H
+#define MINIQL_OPTIMIZER_STATISTICS_H
+
+#include "catalog/schema.h"
+#include "common/value.h"
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace miniql {
+namespace optimizer {
+
+// ESTATÍSTICAS DE TABELA (ANALYZE)
+// Coletadas por ANALYZE e consultadas pelo modelo de custo:
+// - número de linhas
+// - valores distintos por coluna (sketch HyperLogLog)
+// - histograma equi-depth por coluna
+// - contagem de NULLs, min e max
+
+// Sketch HyperLogLog: estima valores distintos com memória fixa
+// (2^precision registradores de 1 byte, erro padrão ~1.04/sqrt(2^p))
+class HyperLogLog {
+public:
+    explicit HyperLogLog(unsigned precision = 12);
+
+    void add(uint64_t hash);
+    void add(const Value& value) { add(value.hash()); }
+
+    // Une outro sketch de mesma precisão neste
+    void merge(const HyperLogLog& other);
+
+    uint64_t estimate() const;
+
+private:
+    unsigned precision_;
+    std::vector<uint8_t> registers_;
+};
+
+// Histograma equi-depth: cada bucket contém ~o mesmo número de linhas;
+// um valor com pelo menos essa quantidade de linhas fica num bucket só dele
+struct HistogramBucket {
+    Value upper;            // maior valor do bucket (inclusivo)
+    uint64_t count;         // linhas no bucket
+    uint64_t distinct;      // valores distintos no bucket
+};
+
+class EquiDepthHistogram {
+public:
+    EquiDepthHistogram() = default;
+
+    // Constrói a partir dos valores não-nulos já ordenados
+    static EquiDepthHistogram build(const std::vector<Value>& sorted, size_t max_buckets);
+
+    bool empty() const { return buckets_.empty(); }
+    uint64_t totalCount() const { return total_; }
+    const std::vector<HistogramBucket>& buckets() const { return buckets_; }
+
+    // Fração (0..1) dos valores não-nulos que satisfazem cada predicado
+    double selectivityEqual(const Value& value) const;
+    double selectivityLess(const Value& value, bool inclusive) const;
+
+private:
+    Value min_;
+    std::vector<HistogramBucket> buckets_;
+    uint64_t total_ = 0;
+
+    // Fração do bucket i abaixo de value (interpolação linear em números)
+    double fractionBelow(size_t bucket, const Value& value) const;
+};
+
+struct ColumnStats {
+    uint64_t null_count = 0;
+    uint64_t distinct = 0;      // estimativa do HyperLogLog
+    Value min;
+    Value max;
+    EquiDepthHistogram histogram;
+};
+
+struct TableStats {
+    std::string table_name;
+    uint64_t row_count = 0;
+    std::vector<ColumnStats> columns;   // mesma ordem do schema
+};
+
+// Número de buckets usado por ANALYZE
+constexpr size_t DEFAULT_HISTOGRAM_BUCKETS = 64;
+
+// Varre as linhas e calcula as estatísticas de todas as colunas
+TableStats analyzeTable(const catalog::TableSchema& schema,
+                        const std::vector<Row>& rows,
+                        size_t histogram_buckets = DEFAULT_HISTOGRAM_BUCKETS);
+
+// Estatísticas conhecidas de todas as tabelas (substituídas a cada ANALYZE)
+class StatisticsCatalog {
+public:
+    void update(TableStats stats);
+    const TableStats* find(const std::string& table_name) const;
+    void remove(const std::string& table_name);
+
+private:
+    std::map<std::string, TableStats> tables_;
+};
+
+} // namespace optimizer
+} // namespace miniql
+
+#endif // MINIQL_OPTIMIZER_STATISTICS_H
@@ -1,6 +1,8 @@
 #ifndef MINIQL_REPL_H
 #define MINIQL_REPL_H
 
+#include "executor/result_cache.h"
+#include "shell/result_writer.h"
 #include <string>
 
 namespace miniql {
@@ -17,8 +19,21 @@ private:
     // Processa comandos meta (começam com .)
     bool processMetaCommand(const std::string& command);
     
+    // Processa .stats [reset | prometheus <file>]
+    void processStatsCommand(const std::string& command);
+    
+    // Processa .mode [table|csv|tsv|binary] e .output [file|stdout]
+    void processModeCommand(const std::string& command);
+    void processOutputCommand(const std::string& command);
+    
+    // Processa .cache [on|off|size <bytes>|clear|reset]
+    void processCacheCommand(const std::string& command);
+    
     // Processa comandos SQL
     void processSQLCommand(const std::string& sql);
+
+    // Mantém o mapa view → tabela base do cache (CREATE/DROP VIEW)
+    void trackView(const std::vector<lexer::Token>& tokens);
     
     // Exibe prompt e lê linha
     std::string readLine(const std::string& prompt);
@@ -28,6 +43,8 @@ private:
     void printHelp();
     
     bool running_;
+    ResultWriter writer_;     // formato e destino dos resultados
+    executor::ResultCache cache_;   // resultados de SELECTs repetidos
 };
 
 } // namespace miniql
@@ -0,0 +1,80 @@
+#ifndef MINIQL_RESULT_WRITER_H
+#define MINIQL_RESULT_WRITER_H
+
+#include "executor/result_set.h"
+#include <cstdio>
+#include <string>
+
+namespace miniql {
+
+// Formatos de saída do shell (.mode)
+enum class OutputMode { TABLE, CSV, TSV, BINARY };
+
+bool parseOutputMode(const std::string& name, OutputMode& mode);
+std::string outputModeToString(OutputMode mode);
+
+// RESULT WRITER:
+// Consome um ResultCursor em lotes e escreve no destino atual (.output)
+// no formato atual (.mode). A saída é montada num buffer próprio e
+// despejada com fwrite em blocos grandes; números são formatados com
+// std::to_chars (sem locale, sem iostream), na forma mais curta que relê
+// o mesmo valor.
+//
+// CSV: RFC 4180 com \n no fim da linha; NULL é um campo vazio e texto
+// vazio é "". TSV: \t, \n, \r e \\ escapados; NULL é \N.
+//
+// Formato BINARY (little-endian):
+//   "MQLR" | versão u8 | nº colunas u32 | por coluna: tamanho u32 + nome
+//   por linha: marcador 0x01, depois cada valor como
+//     tag u8 (0 NULL, 1 INTEGER, 2 REAL, 3 TEXT) + payload
+//     (INTEGER: i64, REAL: f64, TEXT: tamanho u32 + bytes)
+//   fim: marcador 0x00
+
+class ResultWriter {
+public:
+    ResultWriter();
+    ~ResultWriter();
+
+    ResultWriter(const ResultWriter&) = delete;
+    ResultWriter& operator=(const ResultWriter&) = delete;
+
+    OutputMode mode() const { return mode_; }
+    void setMode(OutputMode mode) { mode_ = mode; }
+
+    // Redireciona para um arquivo (truncado); "" ou "stdout" volta ao stdout.
+    // Retorna false se o arquivo não puder ser aberto. Se o destino
+    // anterior falhar ao ser esvaziado, troca mesmo assim e lança
+    // std::runtime_error.
+    bool setOutput(const std::string& path);
+    const std::string& outputPath() const { return path_; }
+
+    // Escreve o resultado inteiro e retorna o número de linhas. Lança
+    // std::runtime_error (com strerror) se fwrite/fflush falharem, por
+    // exemplo com o disco cheio; o que estava no buffer é descartado.
+    size_t write(executor::ResultCursor& cursor, size_t batch_size = executor::DEFAULT_BATCH_SIZE);
+
+private:
+    OutputMode mode_;
+    std::FILE* out_;
+    std::string path_;
+    std::string buffer_;
+
+    void flushIfFull();
+    void flush();
+    std::string writeError(int error) const;
+
+    void writeHeader(const std::vector<std::string>& columns, std::vector<size_t>& widths,
+                     const std::vector<Row>& first_batch);
+    void writeRow(const Row& row, const std::vector<size_t>& widths);
+    void writeFooter(size_t rows);
+
+    // Formatação de campos
+    void appendCsvField(const std::string& text);
+    void appendTsvField(const std::string& text);
+    void appendBinaryValue(const Value& value);
+    void appendPadded(const std::string& text, size_t width);
+};
+
+} // namespace miniql
+
+#endif // MINIQL_RESULT_WRITER_H
@@ -0,0 +1,141 @@
+#ifndef MINIQL_STORAGE_BUFFER_POOL_H
+#define MINIQL_STORAGE_BUFFER_POOL_H
+
+#include "storage/page.h"
+#include "storage/page_file.h"
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace miniql {
+namespace storage {
+
+class Wal;
+
+// BUFFER POOL
+// Cache de páginas com substituição clock. Páginas fixadas (pin) não são
+// despejadas; o conteúdo de cada frame é protegido por um latch próprio
+// (shared para ler, exclusivo para modificar), independente do mutex do
+// pool, e todo I/O acontece fora do mutex do pool.
+//
+// Protocolo de escrita (WAL rule):
+//   1. fetch + latch exclusivo
+//   2. markDirty        (registra recLSN = fim atual do WAL)
+//   3. wal.append...    → lsn
+//   4. aplica a mudança e page.setLsn(lsn), ainda com o latch
+// Antes de uma página suja ir para o disco, o WAL é descarregado até o
+// LSN da página.
+//
+// Read-ahead: depois de READAHEAD_TRIGGER fetches em páginas consecutivas,
+// as próximas readahead páginas são lidas em lote e de forma assíncrona
+// (só em frames limpos, no máximo 1/4 do pool em voo). Um fetch de página
+// ainda em leitura espera por ela como espera qualquer outro I/O.
+class BufferPool {
+    struct Frame;
+
+public:
+    // Página fixada; solta o pin ao sair de escopo
+    class PageHandle {
+    public:
+        PageHandle() : pool_(nullptr), frame_(nullptr) {}
+        PageHandle(PageHandle&& other) noexcept;
+        PageHandle& operator=(PageHandle&& other) noexcept;
+        ~PageHandle();
+
+        PageHandle(const PageHandle&) = delete;
+        PageHandle& operator=(const PageHandle&) = delete;
+
+        Page& page();
+        PageId id() const;
+        std::shared_mutex& latch();
+
+        explicit operator bool() const { return frame_ != nullptr; }
+
+    private:
+        friend class BufferPool;
+        PageHandle(BufferPool* pool, Frame* frame) : pool_(pool), frame_(frame) {}
+
+        BufferPool* pool_;
+        Frame* frame_;
+    };
+
+    BufferPool(PageFile& file, size_t capacity);
+    ~BufferPool();
+
+    BufferPool(const BufferPool&) = delete;
+    BufferPool& operator=(const BufferPool&) = delete;
+
+    void setWal(Wal* wal) { wal_ = wal; }
+
+    // Janela do read-ahead em páginas; 0 desliga
+    void setReadAhead(size_t pages);
+
+    // Lança std::runtime_error se todas as páginas estiverem fixadas
+    PageHandle fetch(PageId id);
+
+    // Chamado com o latch exclusivo, antes do append no WAL
+    void markDirty(PageHandle& handle);
+
+    // Tabela de páginas sujas (page, recLSN) e o fim do WAL, lidos no mesmo
+    // instante: qualquer página suja depois disso terá recLSN >= wal_end
+    std::vector<std::pair<PageId, Lsn>> dirtyPages(Lsn& wal_end);
+
+    // Grava a página se estiver suja e residente. Não bloqueia escritores:
+    // grava uma cópia tirada sob latch compartilhado.
+    void flushPage(PageId id);
+    void flushAll();
+
+    // Writeback em lote: um flush do WAL e um lote de gravações a cada
+    // WRITEBACK_BATCH páginas
+    void flushPages(const std::vector<PageId>& ids);
+
+    size_t capacity() const { return frames_.size(); }
+
+private:
+    struct Frame {
+        std::unique_ptr<Page> page;
+        std::shared_mutex latch;
+        PageId id = 0;
+        bool valid = false;
+        bool io = false;            // leitura ou despejo em andamento
+        bool referenced = false;
+        bool dirty = false;
+        int pins = 0;
+        Lsn rec_lsn = INVALID_LSN;  // fim do WAL quando a página ficou suja
+    };
+
+    PageFile& file_;
+    Wal* wal_;
+    std::vector<std::unique_ptr<Frame>> frames_;
+    std::unordered_map<PageId, Frame*> table_;
+    size_t clock_hand_;
+
+    std::mutex mutex_;
+    std::condition_variable io_done_;
+
+    // Detecção de acesso sequencial (sob mutex_)
+    size_t readahead_;
+    PageId last_fetch_;
+    size_t sequential_run_;
+    PageId readahead_next_;         // primeira página ainda não pedida
+    size_t prefetch_in_flight_;
+
+    PageHandle fetchPage(PageId id, PageId& readahead_from, PageId& readahead_to);
+    void noteAccess(PageId id, PageId& readahead_from, PageId& readahead_to);
+    void readAhead(PageId from, PageId to);
+    void finishPrefetch(Frame* frame, bool ok);
+    Frame* findVictim(bool clean_only = false);
+    void unpin(Frame* frame);
+    void writeBack(PageId id, const Page& page);
+};
+
+using PageHandle = BufferPool::PageHandle;
+
+} // namespace storage
+} // namespace miniql
+
+#endif // MINIQL_STORAGE_BUFFER_POOL_H
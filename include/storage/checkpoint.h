@@ -0,0 +1,48 @@
+#ifndef MINIQL_STORAGE_CHECKPOINT_H
+#define MINIQL_STORAGE_CHECKPOINT_H
+
+#include "storage/buffer_pool.h"
+#include "storage/page_file.h"
+#include "storage/wal.h"
+#include <functional>
+#include <string>
+
+namespace miniql {
+namespace storage {
+
+// CHECKPOINT FUZZY
+// Não para os escritores: tira um retrato da tabela de páginas sujas,
+// grava cada página a partir de uma cópia e registra no arquivo mestre o
+// ponto de onde o redo precisa começar:
+//
+//   redo_lsn = min(recLSN das páginas sujas no retrato, fim do WAL no retrato)
+//
+// Tudo antes de redo_lsn já está no arquivo de dados (e sincronizado), então
+// o recovery ignora essa parte do log. Páginas que ficam sujas durante o
+// checkpoint têm recLSN >= fim do WAL no retrato e continuam cobertas.
+//
+// Tabelas em memória não têm páginas: log_tables é chamado logo depois do
+// retrato e grava o conteúdo delas no WAL, com LSN >= redo_lsn, para que o
+// recovery consiga reconstruí-las sem o log anterior.
+//
+// Depois do arquivo mestre gravado, o WAL antes de redo_lsn é descartado
+// (Wal::truncateBefore), então o log não cresce além do que o redo lê.
+
+struct CheckpointInfo {
+    Lsn redo_lsn = WAL_START_LSN;
+    Lsn checkpoint_lsn = INVALID_LSN;   // registro CHECKPOINT no WAL
+};
+
+// Arquivo mestre "<dir>/checkpoint". false se não existir ou for inválido.
+bool readCheckpoint(const std::string& dir, CheckpointInfo& info);
+
+// Escrita atômica: arquivo temporário + fsync + rename + fsync do diretório
+void writeCheckpoint(const std::string& dir, const CheckpointInfo& info);
+
+CheckpointInfo runCheckpoint(BufferPool& pool, Wal& wal, PageFile& file, const std::string& dir,
+                             const std::function<void()>& log_tables = std::function<void()>());
+
+} // namespace storage
+} // namespace miniql
+
+#endif // MINIQL_STORAGE_CHECKPOINT_H
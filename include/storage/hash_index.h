@@ -0,0 +1,107 @@
+#ifndef MINIQL_STORAGE_HASH_INDEX_H
+#define MINIQL_STORAGE_HASH_INDEX_H
+
+#include "common/value.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace miniql {
+namespace storage {
+
+using RowId = uint32_t;
+constexpr RowId INVALID_ROW = UINT32_MAX;
+
+// HASH INDEX (endereçamento aberto)
+// Índice de chave única para uma coluna de uma tabela em memória. Slots de
+// 24 bytes (hash completo, RowId, estado e posição da chave TEXT na arena)
+// num único vetor, sondagem linear. Uma linha de cache de 64 bytes cobre
+// 2⅔ slots, então uma sequência de sondagem curta lê uma ou duas linhas
+// contíguas (o prefetcher sequencial cobre a segunda); a chave só é
+// comparada quando o hash bate. Remoções deixam tombstones, limpos no
+// próximo rehash.
+//
+// Chaves INTEGER nem tocam na linha: mixHash é uma bijeção em 64 bits, então
+// hash igual entre dois inteiros é chave igual. O slot guarda o tipo da
+// chave para não confundir um inteiro com um real de mesmo hash. Chaves
+// TEXT são copiadas para uma arena do índice (compactada no rehash): a
+// comparação lê bytes contíguos em vez de linha → Value → string.
+//
+// NULL não é indexado (UNIQUE permite vários NULLs e "= NULL" nunca casa).
+class HashIndex {
+public:
+    HashIndex(const std::vector<Row>& rows, size_t column);
+
+    // RowId com essa chave ou INVALID_ROW
+    RowId find(const Value& key) const {
+        if (key.isNull() || used_ == 0) return INVALID_ROW;
+
+        uint64_t hash = key.hash();
+        uint32_t probe = fullState(key);
+        for (size_t i = hash & mask_;; i = (i + 1) & mask_) {
+            const Slot& slot = slots_[i];
+            if (slot.state == EMPTY) return INVALID_ROW;
+            if (slot.hash != hash || slot.state == TOMBSTONE) continue;
+            if (slot.state == FULL_INTEGER && probe == FULL_INTEGER) return slot.row;
+            if (slot.state == FULL_TEXT) {
+                if (probe == FULL_TEXT && textEquals(slot, key.asText())) return slot.row;
+                continue;
+            }
+            if (rows_[slot.row][column_] == key) return slot.row;
+        }
+    }
+
+    // A linha já deve estar em rows; false se a chave já existir
+    bool insert(RowId row);
+    void erase(RowId row);
+    void clear();
+
+    // Dimensiona a tabela para keys chaves de uma vez (carga em lote)
+    void reserve(size_t keys);
+
+    size_t column() const { return column_; }
+    size_t size() const { return used_; }
+    size_t memoryBytes() const { return slots_.capacity() * sizeof(Slot) + text_.capacity(); }
+
+private:
+    enum : uint32_t { EMPTY = 0, TOMBSTONE = 1, FULL = 2, FULL_INTEGER = 3, FULL_TEXT = 4 };
+
+    static uint32_t fullState(const Value& key) {
+        switch (key.kind()) {
+            case Value::Kind::INTEGER: return FULL_INTEGER;
+            case Value::Kind::TEXT: return FULL_TEXT;
+            default: return FULL;
+        }
+    }
+
+    struct Slot {
+        uint64_t hash;
+        RowId row;
+        uint32_t state;
+        uint32_t text_offset;           // FULL_TEXT: chave em text_
+        uint32_t text_length;
+    };
+    static_assert(sizeof(Slot) == 24, "Slot layout changed: update the comment above HashIndex");
+
+    bool textEquals(const Slot& slot, const std::string& text) const {
+        return slot.text_length == text.size() &&
+               std::memcmp(text_.data() + slot.text_offset, text.data(), text.size()) == 0;
+    }
+
+    const std::vector<Row>& rows_;
+    size_t column_;
+    std::vector<Slot> slots_;
+    size_t mask_;
+    size_t used_;
+    size_t tombstones_;
+    std::vector<char> text_;
+    size_t dead_text_;                  // bytes de chaves removidas
+
+    void rehash(size_t capacity);
+};
+
+} // namespace storage
+} // namespace miniql
+
+#endif // MINIQL_STORAGE_HASH_INDEX_H
@@ -0,0 +1,84 @@
+#ifndef MINIQL_STORAGE_IO_ENGINE_H
+#define MINIQL_STORAGE_IO_ENGINE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace miniql {
+namespace storage {
+
+// CAMADA DE I/O ASSÍNCRONO
+// Tudo que o storage lê e grava passa por aqui. Requisições são submetidas
+// em lote e completam fora de ordem, o que permite manter várias em voo
+// (read-ahead, writeback em lote) em vez de uma syscall bloqueante por vez.
+//
+//   io_uring     - um anel por engine, lote inteiro numa única
+//                  io_uring_enter(), completions colhidas por uma thread
+//   thread pool  - fallback quando o kernel não tem io_uring (ou ele está
+//                  bloqueado): N threads fazendo pread/pwrite/fdatasync
+//
+// Os callbacks rodam na thread da engine e não devem lançar exceções nem
+// submeter I/O e esperar por ele.
+
+enum class IoOp : uint8_t {
+    READ,
+    WRITE,
+    DATASYNC,
+};
+
+// Resultado: bytes transferidos (leitura curta = fim do arquivo) ou -errno
+using IoCallback = std::function<void(int64_t result)>;
+
+struct IoRequest {
+    IoOp op = IoOp::READ;
+    int fd = -1;
+    void* buffer = nullptr;
+    size_t length = 0;
+    uint64_t offset = 0;
+    IoCallback done;
+};
+
+enum class IoEngineKind {
+    AUTO,           // io_uring se disponível, senão thread pool
+    URING,
+    THREAD_POOL,
+};
+
+std::string ioEngineKindToString(IoEngineKind kind);
+
+// "auto", "uring" ou "threads"; false se não reconhecer
+bool parseIoEngineKind(const std::string& name, IoEngineKind& kind);
+
+class IoEngine {
+public:
+    virtual ~IoEngine() = default;
+
+    // Enfileira o lote (os callbacks são movidos para a engine). Lança
+    // std::runtime_error se a engine falhou de vez (io_uring_enter do
+    // reaper); o que estava em voo nessa hora completou com -errno.
+    virtual void submit(std::vector<IoRequest>& batch) = 0;
+
+    virtual const char* name() const = 0;
+    virtual unsigned queueDepth() const = 0;
+
+    // Submete e espera; devolve o resultado do callback
+    int64_t execute(IoRequest request);
+
+    // Submete o lote inteiro de uma vez e espera todos
+    std::vector<int64_t> executeBatch(std::vector<IoRequest>& batch);
+
+    // URING lança std::runtime_error se io_uring não estiver disponível
+    static std::unique_ptr<IoEngine> create(IoEngineKind kind = IoEngineKind::AUTO, unsigned queue_depth = 64);
+};
+
+// Mensagem de erro para um resultado negativo
+std::string ioErrorMessage(int64_t result);
+
+} // namespace storage
+} // namespace miniql
+
+#endif // MINIQL_STORAGE_IO_ENGINE_H
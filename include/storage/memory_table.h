@@ -0,0 +1,183 @@
+#ifndef MINIQL_STORAGE_MEMORY_TABLE_H
+#define MINIQL_STORAGE_MEMORY_TABLE_H
+
+#include "catalog/schema.h"
+#include "common/value.h"
+#include "storage/hash_index.h"
+#include "storage/row_codec.h"
+#include "storage/wal.h"
+#include "storage/zone_map.h"
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+namespace miniql {
+namespace storage {
+
+// TABELA EM MEMÓRIA (ENGINE = MEMORY)
+// Para tabelas pequenas e muito consultadas: linhas num vetor indexado por
+// RowId, um HashIndex por coluna UNIQUE/PRIMARY KEY, sem páginas nem buffer
+// pool. Busca pontual = hash + sondagem + comparação, sob um shared lock.
+//
+// Durabilidade só pelo WAL, com registros lógicos:
+//   TABLE_CREATE: nome | engine u8 | nº colunas u16 | (nome | tipo u8 | flags u8)*
+//                 (também recria a tabela vazia: início de um snapshot)
+//   ROW_INSERT:   nome | row_id u32 | linha (storage/row_codec.h)
+//   ROW_DELETE:   nome | row_id u32
+// Strings são u32 de tamanho + bytes. A linha usa o formato compacto do
+// schema da tabela (o recovery já recriou a tabela quando chega nela), então
+// os valores são conferidos e ajustados aos tipos das colunas no insert.
+//
+// Cada checkpoint grava um snapshot (TABLE_CREATE + um ROW_INSERT por linha)
+// depois do redo_lsn, então o recovery reconstrói a tabela a partir do
+// último checkpoint sem precisar do log inteiro.
+//
+// Colunas numéricas têm zone maps por bloco de ZONE_BLOCK_ROWS RowIds, e o
+// scan com limites pula blocos que não podem conter linhas do filtro.
+//
+// Observadores (views materializadas) recebem o delta de cada alteração.
+
+// Recebe cada linha inserida ou removida, sob o lock exclusivo da tabela e
+// na ordem das alterações. Não deve lançar exceções nem acessar a tabela.
+class RowObserver {
+public:
+    virtual ~RowObserver() = default;
+    virtual void rowInserted(const Row& row) = 0;
+    virtual void rowErased(const Row& row) = 0;
+};
+
+class MemoryTable {
+public:
+    // wal == nullptr: tabela volátil (nada é registrado)
+    MemoryTable(catalog::TableSchema schema, Wal* wal);
+
+    MemoryTable(const MemoryTable&) = delete;
+    MemoryTable& operator=(const MemoryTable&) = delete;
+
+    const catalog::TableSchema& schema() const { return schema_; }
+    const RowCodec& codec() const { return codec_; }
+
+    // Tabelas reconstruídas pelo recovery são criadas antes do WAL abrir
+    void setWal(Wal* wal) { wal_ = wal; }
+
+    // Confere NOT NULL/UNIQUE, registra no WAL e insere. Violações lançam
+    // std::runtime_error sem alterar a tabela.
+    RowId insert(Row row);
+    bool erase(RowId id);
+
+    // Busca pela coluna indexada; INVALID_ROW se não achar ou se a coluna
+    // não tiver índice
+    RowId find(size_t column, const Value& key) const {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        const HashIndex* index = column < indexes_.size() ? indexes_[column].get() : nullptr;
+        return index ? index->find(key) : INVALID_ROW;
+    }
+
+    // Copia a linha; false se o RowId não estiver em uso
+    bool read(RowId id, Row& out) const;
+
+    // Busca + leitura sob o mesmo lock
+    bool lookup(size_t column, const Value& key, Row& out) const;
+
+    bool hasIndex(size_t column) const { return column < indexes_.size() && indexes_[column]; }
+    size_t size() const;
+    size_t memoryBytes() const;
+
+    // Percorre as linhas vivas em ordem de RowId sob shared lock
+    template <typename Fn>
+    void scan(Fn&& fn) const {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        for (size_t id = 0; id < rows_.size(); id++) {
+            if (live_[id]) fn(static_cast<RowId>(id), rows_[id]);
+        }
+    }
+
+    // Scan pulando blocos cujo zone map exclui algum dos limites. Linhas de
+    // blocos lidos são entregues todas: o filtro exato é do chamador.
+    template <typename Fn>
+    ZoneScanStats scan(const std::vector<ColumnRange>& ranges, Fn&& fn) const {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        ZoneScanStats stats;
+        stats.blocks = zones_.blockCount();
+        for (size_t block = 0; block < stats.blocks; block++) {
+            if (!zones_.mayMatch(block, ranges)) {
+                stats.blocks_skipped++;
+                continue;
+            }
+            size_t end = std::min(rows_.size(), (block + 1) * ZONE_BLOCK_ROWS);
+            for (size_t id = block * ZONE_BLOCK_ROWS; id < end; id++) {
+                if (!live_[id]) continue;
+                stats.rows++;
+                fn(static_cast<RowId>(id), rows_[id]);
+            }
+        }
+        return stats;
+    }
+
+    // Resumo de um bloco (cópia, sob o lock); false se não houver zone map
+    // para a coluna ou o bloco não existir
+    bool zoneSummary(size_t block, size_t column, ZoneSummary& out) const;
+    size_t zoneBlocks() const;
+
+    // Entrega as linhas atuais como inserções (replay) e passa a notificar
+    // o observador, sob o mesmo lock: nenhuma alteração fica de fora nem é
+    // contada duas vezes
+    void addObserver(RowObserver* observer, bool replay = true);
+    void removeObserver(RowObserver* observer);
+
+    // Registra TABLE_CREATE + todas as linhas. Segura o lock durante o
+    // append, então nenhuma escrita se intercala com o snapshot.
+    void logSnapshot() const;
+
+    // Redo (sem checagens nem WAL)
+    void redoInsert(RowId id, Row row);
+    void redoErase(RowId id);
+    void clear();
+
+    // Recovery: os índices hash ficam parados durante o redo (um snapshot
+    // reinsere toda linha) e são montados de uma vez, já no tamanho final,
+    // por buildIndexes(). Buscas e inserts só depois dele.
+    void deferIndexes();
+    void buildIndexes();
+
+private:
+    catalog::TableSchema schema_;
+    RowCodec codec_;
+    Wal* wal_;
+
+    mutable std::shared_mutex mutex_;
+    std::vector<Row> rows_;
+    std::vector<uint8_t> live_;
+    std::vector<RowId> free_;
+    bool free_stale_ = false;           // redo não mantém free_
+    size_t count_ = 0;
+    std::vector<std::unique_ptr<HashIndex>> indexes_;   // por coluna
+    bool indexes_deferred_ = false;
+    ZoneMap zones_;
+    std::vector<RowObserver*> observers_;
+
+    RowId allocate();
+    void place(RowId id, Row row);
+    void remove(RowId id);
+};
+
+using MemoryTableSet = std::map<std::string, std::unique_ptr<MemoryTable>>;
+
+// Chave de uma tabela em MemoryTableSet (nomes são case-insensitive)
+std::string memoryTableKey(const std::string& name);
+
+// Registro TABLE_CREATE do schema (criação da tabela)
+std::string encodeTableCreate(const catalog::TableSchema& schema);
+
+// Aplica um registro lógico do WAL. Linhas de tabelas desconhecidas são
+// ignoradas: o snapshot do checkpoint seguinte as recria. Tabelas criadas
+// aqui ficam com os índices adiados até buildIndexes().
+void redoTableRecord(const WalRecord& record, MemoryTableSet& tables);
+
+} // namespace storage
+} // namespace miniql
+
+#endif // MINIQL_STORAGE_MEMORY_TABLE_H
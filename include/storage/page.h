@@ -0,0 +1,48 @@
+#ifndef MINIQL_STORAGE_PAGE_H
+#define MINIQL_STORAGE_PAGE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace miniql {
+namespace storage {
+
+// PÁGINA
+// Unidade de I/O e de cache do storage. Os primeiros 8 bytes guardam o
+// LSN do último registro do WAL aplicado à página; o recovery compara esse
+// LSN com o do registro para saber se precisa refazê-lo.
+//
+// ┌──────────────┬──────────────────────────────────────┐
+// │ PageLSN (8B) │ Payload (PAGE_SIZE - 8 bytes)         │
+// └──────────────┴──────────────────────────────────────┘
+
+constexpr size_t PAGE_SIZE = 4096;
+constexpr size_t PAGE_HEADER_SIZE = 8;
+constexpr size_t PAGE_PAYLOAD_SIZE = PAGE_SIZE - PAGE_HEADER_SIZE;
+
+using PageId = uint32_t;
+using Lsn = uint64_t;                   // Log Sequence Number = offset no WAL
+
+constexpr Lsn INVALID_LSN = 0;
+
+// Alinhada ao tamanho da página para permitir I/O direto (O_DIRECT)
+struct alignas(PAGE_SIZE) Page {
+    char data[PAGE_SIZE];
+
+    Lsn lsn() const {
+        Lsn value;
+        std::memcpy(&value, data, sizeof(value));
+        return value;
+    }
+
+    void setLsn(Lsn value) { std::memcpy(data, &value, sizeof(value)); }
+
+    char* payload() { return data + PAGE_HEADER_SIZE; }
+    const char* payload() const { return data + PAGE_HEADER_SIZE; }
+};
+
+} // namespace storage
+} // namespace miniql
+
+#endif // MINIQL_STORAGE_PAGE_H
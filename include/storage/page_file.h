@@ -0,0 +1,58 @@
+#ifndef MINIQL_STORAGE_PAGE_FILE_H
+#define MINIQL_STORAGE_PAGE_FILE_H
+
+#include "storage/io_engine.h"
+#include "storage/page.h"
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace miniql {
+namespace storage {
+
+// Arquivo de dados como um vetor de páginas de tamanho fixo.
+// Todo I/O passa pela IoEngine; erros lançam std::runtime_error.
+//
+// Com direct = true o arquivo é aberto com O_DIRECT (sem passar pelo page
+// cache do kernel: o buffer pool já é o cache). Page é alinhada em
+// PAGE_SIZE, como O_DIRECT exige. Se o sistema de arquivos recusar
+// O_DIRECT, abre sem ele e direct() devolve false.
+class PageFile {
+public:
+    PageFile(const std::string& path, IoEngine& io, bool direct = false);
+    ~PageFile();
+
+    PageFile(const PageFile&) = delete;
+    PageFile& operator=(const PageFile&) = delete;
+
+    // Páginas além do fim do arquivo são lidas como zeros
+    void read(PageId id, Page& page);
+    void write(PageId id, const Page& page);
+
+    // Leitura assíncrona para submeter em lote via io().submit();
+    // done(ok) roda na thread da engine, com a página já preenchida
+    IoRequest readRequest(PageId id, Page& page, std::function<void(bool ok)> done);
+
+    // Grava todas as páginas num único lote e espera
+    void writeBatch(const std::vector<std::pair<PageId, const Page*>>& pages);
+
+    // fsync dos dados
+    void sync();
+
+    PageId pageCount() const;
+    const std::string& path() const { return path_; }
+    bool direct() const { return direct_; }
+    IoEngine& io() { return io_; }
+
+private:
+    std::string path_;
+    IoEngine& io_;
+    int fd_;
+    bool direct_;
+};
+
+} // namespace storage
+} // namespace miniql
+
+#endif // MINIQL_STORAGE_PAGE_FILE_H
@@ -0,0 +1,49 @@
+#ifndef MINIQL_STORAGE_RECOVERY_H
+#define MINIQL_STORAGE_RECOVERY_H
+
+#include "storage/page_file.h"
+#include "storage/wal.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+namespace miniql {
+namespace storage {
+
+// RECOVERY (redo paralelo)
+// Relê o WAL a partir do redo_lsn do último checkpoint em lotes. Cada lote
+// passa por duas fases paralelas:
+//   1. verificação de CRC (fatias contíguas do lote por thread); o primeiro
+//      registro inválido é o fim do log
+//   2. redo particionado por página (page % threads): cada página pertence
+//      a uma única thread, então a ordem dos registros de uma página é
+//      preservada sem locks
+// Um registro só é aplicado se for mais novo que o PageLSN da página, o
+// que torna o redo idempotente.
+//
+// Registros lógicos (tabelas em memória) não têm página: são entregues em
+// ordem de LSN, na thread que chamou recover, ao callback table_redo.
+
+struct RecoveryStats {
+    Lsn redo_lsn = WAL_START_LSN;
+    Lsn end_lsn = WAL_START_LSN;    // fim do log válido
+    uint64_t records = 0;
+    uint64_t applied = 0;
+    uint64_t skipped = 0;           // página já continha o registro
+    uint64_t table_records = 0;
+    uint64_t log_bytes = 0;
+    size_t threads = 1;
+    double seconds = 0.0;
+};
+
+using TableRedoFn = std::function<void(const WalRecord&)>;
+
+// threads == 0 usa std::thread::hardware_concurrency()
+RecoveryStats recover(const std::string& wal_path, PageFile& file, Lsn redo_lsn, size_t threads,
+                      const TableRedoFn& table_redo = TableRedoFn());
+
+} // namespace storage
+} // namespace miniql
+
+#endif // MINIQL_STORAGE_RECOVERY_H
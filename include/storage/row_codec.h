@@ -0,0 +1,171 @@
+#ifndef MINIQL_STORAGE_ROW_CODEC_H
+#define MINIQL_STORAGE_ROW_CODEC_H
+
+#include "catalog/schema.h"
+#include "common/value.h"
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace miniql {
+namespace storage {
+
+// FORMATO COMPACTO DE LINHA
+// O schema já diz o tipo e a posição de cada coluna, então a linha não
+// carrega tags nem contagem de colunas:
+//
+//   header u8 | bitmap de NULLs | seção fixa | offsets | dados variáveis
+//
+//   header:  bits 0-1 = largura dos offsets (0: 1 byte, 1: 2, 2: 4)
+//   bitmap:  ceil(colunas / 8) bytes, bit i = coluna i é NULL
+//   fixa:    8 bytes por coluna INT/DATE/TIMESTAMP (int64) ou REAL
+//            (double), na ordem do schema; zeros se NULL
+//   offsets: um por coluna TEXT/BLOB, fim dos seus bytes relativo ao início
+//            dos dados variáveis (o início é o fim da anterior)
+//   dados:   bytes das colunas variáveis, concatenados
+//
+// A posição de uma coluna fixa é constante por schema e a de uma variável
+// sai de dois offsets, então ler uma coluna é O(1) sem decodificar as
+// outras. A largura dos offsets é a menor que cabe o total de bytes
+// variáveis da linha (linhas curtas: 1 byte por coluna de texto).
+//
+// Numa sequência (página, arquivo) cada linha vem prefixada pelo tamanho
+// em varint, no lugar de um RowSize fixo de 4 bytes.
+//
+// Inteiros e doubles em ordem de bytes do host, como o resto do WAL.
+
+// Varint LEB128: 7 bits por byte, bit alto = continua
+void putVarint(std::string& out, uint64_t value);
+// Avança data; false se truncado ou mais longo que 10 bytes
+bool getVarint(const char*& data, const char* end, uint64_t& value);
+
+// Ajusta o valor ao tipo da coluna antes de gravar: INTEGER em coluna REAL
+// vira REAL. false se o tipo não couber (TEXT em INT, REAL em INT, ...).
+bool conformValue(DataType type, Value& value);
+
+class RowCodec;
+
+// Linha codificada, validada só no cabeçalho: cada acesso é O(1) e confere
+// os limites do que lê. Aponta para os bytes do chamador (não copia).
+class RowView {
+public:
+    RowView() = default;
+
+    bool isNull(size_t column) const { return (bitmap_[column >> 3] >> (column & 7)) & 1; }
+
+    // Sem checagem de tipo nem de NULL (o chamador conhece o schema)
+    int64_t intAt(size_t column) const;
+    double realAt(size_t column) const;
+    std::string_view textAt(size_t column) const;
+
+    Value value(size_t column) const;
+
+private:
+    friend class RowCodec;
+    RowView(const RowCodec& codec, const unsigned char* bitmap, const char* fixed, const char* offsets,
+            const char* var, size_t var_size, unsigned width)
+        : codec_(&codec), bitmap_(bitmap), fixed_(fixed), offsets_(offsets), var_(var), var_size_(var_size),
+          width_(width) {}
+
+    const RowCodec* codec_ = nullptr;
+    const unsigned char* bitmap_ = nullptr;
+    const char* fixed_ = nullptr;
+    const char* offsets_ = nullptr;
+    const char* var_ = nullptr;
+    size_t var_size_ = 0;
+    unsigned width_ = 1;
+
+    size_t offsetAt(size_t slot) const;
+};
+
+// Codificador gerado a partir do schema: a posição de cada coluna é
+// calculada uma vez no construtor, e encode/decode só percorrem as listas
+// de colunas fixas e variáveis. Decodificação lança std::runtime_error em
+// dados truncados ou corrompidos.
+class RowCodec {
+public:
+    explicit RowCodec(const catalog::TableSchema& schema);
+
+    size_t columnCount() const { return slots_.size(); }
+
+    // Aplica conformValue a cada valor; lança std::runtime_error se algum
+    // não couber na coluna
+    void conform(Row& row) const;
+
+    // Acrescenta a linha a out. Lança std::runtime_error se o número de
+    // valores ou o tipo de algum não bater com o schema (ver conformValue).
+    void encode(const Row& row, std::string& out) const;
+    std::string encode(const Row& row) const;
+    size_t encodedSize(const Row& row) const;
+
+    inline RowView view(const char* data, size_t length) const;
+
+    Row decode(const char* data, size_t length) const;
+    void decode(const char* data, size_t length, Row& out) const;
+
+    // Só as colunas pedidas, na ordem pedida
+    Row project(const char* data, size_t length, const std::vector<size_t>& columns) const;
+
+    // Sequências: varint(tamanho) + linha. readFramed avança data e
+    // devolve false no fim dos dados.
+    void encodeFramed(const Row& row, std::string& out) const;
+    inline bool readFramed(const char*& data, const char* end, RowView& out) const;
+
+private:
+    friend class RowView;
+
+    enum class SlotKind : uint8_t { INT, REAL, VAR };
+
+    struct Slot {
+        SlotKind kind;
+        DataType type;
+        uint32_t index;         // byte na seção fixa ou nº do offset
+    };
+
+    std::string table_;
+    std::vector<Slot> slots_;
+    std::vector<std::string> names_;
+    std::vector<uint32_t> fixed_columns_;
+    std::vector<uint32_t> var_columns_;
+    size_t bitmap_bytes_;
+    size_t fixed_bytes_;
+    size_t header_bytes_;               // header + bitmap + seção fixa
+
+    [[noreturn]] void typeMismatch(size_t column, const Value& value) const;
+    [[noreturn]] static void corrupt(const char* what);
+};
+
+// view() e readFramed() ficam no header: rodam uma vez por linha num scan
+RowView RowCodec::view(const char* data, size_t length) const {
+    if (length < header_bytes_) corrupt("truncated header");
+    uint8_t code = static_cast<uint8_t>(data[0]);
+    if (code > 2) corrupt("unknown header byte");
+
+    unsigned width = 1u << code;
+    size_t offsets = var_columns_.size() * width;
+    if (length - header_bytes_ < offsets) corrupt("truncated offsets");
+
+    const char* fixed = data + 1 + bitmap_bytes_;
+    return RowView(*this, reinterpret_cast<const unsigned char*>(data + 1), fixed, fixed + fixed_bytes_,
+                   fixed + fixed_bytes_ + offsets, length - header_bytes_ - offsets, width);
+}
+
+bool RowCodec::readFramed(const char*& data, const char* end, RowView& out) const {
+    if (data >= end) return false;
+    uint64_t length = static_cast<uint8_t>(*data);
+    if (length < 0x80) {
+        data++;
+    } else if (!getVarint(data, end, length)) {
+        corrupt("truncated length prefix");
+    }
+    if (length > static_cast<uint64_t>(end - data)) corrupt("length prefix past the end of the data");
+    out = view(data, static_cast<size_t>(length));
+    data += length;
+    return true;
+}
+
+} // namespace storage
+} // namespace miniql
+
+#endif // MINIQL_STORAGE_ROW_CODEC_H
@@ -0,0 +1,72 @@
+#ifndef MINIQL_STORAGE_STARTUP_PROFILE_H
+#define MINIQL_STORAGE_STARTUP_PROFILE_H
+
+#include "storage/storage_manager.h"
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+namespace miniql {
+namespace storage {
+
+// TEMPO DE ABERTURA (miniql --generate-db / --bench-open)
+// Mede quanto um restart leva até a primeira consulta: catálogo, redo do
+// WAL, montagem dos índices, checkpoint pós-recovery e a latência da
+// primeira busca e da primeira leitura de página, com o cache de páginas
+// do sistema frio.
+
+// Banco sintético: tabelas ENGINE = MEMORY com tamanhos em Zipf (a primeira
+// é a maior), um arquivo de dados de `pages` páginas e, depois do último
+// checkpoint, uma cauda de `wal_tail_ops` alterações que o próximo recovery
+// precisa refazer (o processo fecha sem checkpoint, como num crash).
+struct SyntheticDbSpec {
+    size_t tables = 200;
+    size_t rows = 1000000;              // total, somando todas as tabelas
+    size_t pages = 16384;               // 64 MB de dados
+    size_t wal_tail_ops = 200000;       // inserts, deletes e escritas de página
+    uint64_t seed = 42;
+};
+
+struct SyntheticDbInfo {
+    size_t tables = 0;
+    size_t rows = 0;                    // linhas vivas ao final
+    size_t pages = 0;
+    uint64_t data_bytes = 0;
+    uint64_t wal_bytes = 0;
+    double seconds = 0.0;
+};
+
+// Lança std::runtime_error se o diretório já existir e não estiver vazio
+SyntheticDbInfo generateSyntheticDatabase(const std::string& dir, const SyntheticDbSpec& spec);
+
+struct OpenProfile {
+    std::string dir;
+    bool cold = false;
+    size_t dropped_files = 0;           // arquivos tirados do cache de páginas
+    uint64_t data_bytes = 0;
+    uint64_t wal_bytes = 0;
+
+    OpenStats open;
+    RecoveryStats recovery;
+
+    // Primeira consulta: busca pela chave primária na maior tabela em
+    // memória e leitura de uma página do arquivo de dados (miss no buffer
+    // pool, disco frio); "next" é a mesma operação já aquecida
+    std::string lookup_table;
+    double first_lookup_us = -1.0;      // < 0: nenhuma tabela com chave primária
+    double next_lookup_us = 0.0;        // média de 1000 chaves aleatórias
+    double first_page_us = -1.0;        // < 0: arquivo de dados vazio
+    double next_page_us = 0.0;          // a mesma página, já no buffer pool
+};
+
+// Abre uma cópia descartável de dir (o recovery e o checkpoint da abertura
+// alteram o banco; a cópia deixa cada execução igual e o original intacto).
+// cold: tira os arquivos da cópia do cache de páginas antes de abrir.
+OpenProfile profileOpen(const std::string& dir, bool cold);
+
+void printOpenProfile(std::ostream& out, const OpenProfile& profile);
+
+} // namespace storage
+} // namespace miniql
+
+#endif // MINIQL_STORAGE_STARTUP_PROFILE_H
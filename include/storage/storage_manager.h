@@ -0,0 +1,134 @@
+#ifndef MINIQL_STORAGE_STORAGE_MANAGER_H
+#define MINIQL_STORAGE_STORAGE_MANAGER_H
+
+#include "storage/buffer_pool.h"
+#include "storage/checkpoint.h"
+#include "storage/io_engine.h"
+#include "storage/memory_table.h"
+#include "storage/page_file.h"
+#include "storage/recovery.h"
+#include "storage/wal.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace miniql {
+namespace storage {
+
+// STORAGE MANAGER
+// Junta arquivo de dados, WAL, buffer pool e checkpoints de um diretório:
+//
+//   <dir>/data.db      páginas
+//   <dir>/wal.log      write-ahead log
+//   <dir>/checkpoint   arquivo mestre (redo_lsn do último checkpoint)
+//
+// Ao abrir: lê o arquivo mestre, refaz o WAL a partir do redo_lsn, corta a
+// cauda inválida do log e faz um checkpoint. Depois disso uma thread de
+// fundo faz checkpoints fuzzy periodicamente ou quando o WAL cresce
+// checkpoint_wal_bytes desde o último, o que limita o tempo do próximo
+// recovery.
+//
+// Todo I/O de dados e do WAL passa por uma IoEngine (io_uring quando o
+// kernel permite, senão um pool de threads).
+//
+// Tabelas ENGINE = MEMORY também vivem aqui: o recovery as reconstrói a
+// partir dos registros lógicos do WAL e cada checkpoint grava um snapshot
+// delas.
+
+struct StorageOptions {
+    size_t buffer_pool_pages = 1024;
+    size_t recovery_threads = 0;                    // 0 = núcleos disponíveis
+    bool background_checkpoints = true;
+    std::chrono::milliseconds checkpoint_interval{30000};
+    uint64_t checkpoint_wal_bytes = 64ull << 20;
+    IoEngineKind io_engine = IoEngineKind::AUTO;
+    unsigned io_queue_depth = 64;
+    bool direct_io = false;                         // O_DIRECT no arquivo de dados
+    size_t readahead_pages = 32;                    // 0 desliga o read-ahead
+    bool checkpoint_on_close = true;                // false: o próximo recovery refaz o WAL
+                                                    // desde o último checkpoint (como após um crash)
+};
+
+// Tempo de cada fase da abertura (startup)
+struct OpenStats {
+    double catalog_seconds = 0.0;       // arquivo mestre + registros TABLE_CREATE
+    double replay_seconds = 0.0;        // redo de páginas e linhas
+    double index_seconds = 0.0;         // índices hash das tabelas em memória
+    double checkpoint_seconds = 0.0;    // checkpoint depois do redo
+    double total_seconds = 0.0;         // inclui abrir arquivos, WAL e buffer pool
+    size_t tables = 0;
+    size_t rows = 0;
+};
+
+class StorageManager {
+public:
+    explicit StorageManager(const std::string& dir, StorageOptions options = StorageOptions());
+    ~StorageManager();
+
+    StorageManager(const StorageManager&) = delete;
+    StorageManager& operator=(const StorageManager&) = delete;
+
+    // Escreve bytes no payload da página, registrando no WAL antes.
+    // Retorna o LSN do registro; durável só depois de commit().
+    Lsn write(PageId page, uint16_t offset, const void* data, uint16_t length);
+    void read(PageId page, uint16_t offset, void* out, uint16_t length);
+
+    // Torna duráveis todas as escritas feitas até aqui (group commit)
+    void commit();
+
+    CheckpointInfo checkpoint();
+
+    // Cria uma tabela ENGINE = MEMORY (registrada no WAL; durável após
+    // commit). Lança std::runtime_error se o nome já existir.
+    MemoryTable& createMemoryTable(const catalog::TableSchema& schema);
+
+    // nullptr se não existir
+    MemoryTable* memoryTable(const std::string& name);
+
+    // Nomes das tabelas em memória, em ordem alfabética
+    std::vector<std::string> memoryTableNames();
+
+    const RecoveryStats& recoveryStats() const { return recovery_; }
+    const OpenStats& openStats() const { return open_; }
+    PageId pageCount() const { return file_->pageCount(); }
+    const std::string& directory() const { return dir_; }
+
+    IoEngine& io() { return *io_; }
+    Wal& wal() { return *wal_; }
+    BufferPool& bufferPool() { return *pool_; }
+
+private:
+    std::string dir_;
+    StorageOptions options_;
+    RecoveryStats recovery_;
+    OpenStats open_;
+
+    std::unique_ptr<IoEngine> io_;                  // antes dos que a usam
+    std::unique_ptr<PageFile> file_;
+    std::unique_ptr<Wal> wal_;
+    std::unique_ptr<BufferPool> pool_;
+
+    std::mutex tables_mutex_;
+    MemoryTableSet memory_tables_;
+
+    std::mutex checkpoint_mutex_;                   // um checkpoint por vez
+    std::atomic<Lsn> last_checkpoint_{INVALID_LSN};
+
+    std::thread checkpointer_;
+    std::mutex checkpointer_mutex_;
+    std::condition_variable checkpointer_wake_;
+    bool stop_ = false;
+    bool checkpoint_requested_ = false;
+
+    void checkpointerLoop();
+};
+
+} // namespace storage
+} // namespace miniql
+
+#endif // MINIQL_STORAGE_STORAGE_MANAGER_H
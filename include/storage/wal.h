@@ -0,0 +1,176 @@
+#ifndef MINIQL_STORAGE_WAL_H
+#define MINIQL_STORAGE_WAL_H
+
+#include "storage/io_engine.h"
+#include "storage/page.h"
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace miniql {
+namespace storage {
+
+// WRITE-AHEAD LOG
+// Toda modificação de página é registrada no WAL antes de ser aplicada.
+// O LSN de um registro é base + o seu offset no arquivo, então "refazer a
+// partir do LSN X" é um seek. A base começa em 0 e só muda quando o início
+// do log, já coberto por um checkpoint, é descartado (truncateBefore): os
+// LSNs continuam os mesmos, o arquivo é que passa a começar mais adiante.
+//
+// Arquivo:  "MQLWAL02" + base u64 | registro | registro | ...
+// Registro: crc32 u32 | tamanho total u32 | lsn u64 | tipo u8 | payload
+//   PAGE_WRITE: page u32 | offset u16 | tamanho u16 | bytes
+//   CHECKPOINT: redo_lsn u64
+//   TABLE_CREATE / ROW_INSERT / ROW_DELETE: registros lógicos das tabelas
+//   em memória, payload definido em storage/memory_table.h
+//
+// O CRC cobre tudo depois dele; o primeiro registro inválido marca o fim
+// do log (escrita interrompida por crash).
+
+constexpr Lsn WAL_START_LSN = 16;
+
+// Menor início de log que vale a cópia de truncateBefore
+constexpr uint64_t WAL_TRUNCATE_MIN_BYTES = 1 << 20;
+
+enum class WalRecordType : uint8_t {
+    PAGE_WRITE = 1,
+    CHECKPOINT = 2,
+    TABLE_CREATE = 3,
+    ROW_INSERT = 4,
+    ROW_DELETE = 5,
+};
+
+// Registros que não são de página (o redo físico os ignora)
+inline bool isTableRecord(WalRecordType type) {
+    return type == WalRecordType::TABLE_CREATE || type == WalRecordType::ROW_INSERT ||
+           type == WalRecordType::ROW_DELETE;
+}
+
+// Maior payload aceito em um registro
+constexpr size_t WAL_MAX_PAYLOAD = 1 << 20;
+
+// Registro decodificado; bytes aponta para o buffer de onde foi lido
+// (dados da página em PAGE_WRITE, payload inteiro nos registros de tabela)
+struct WalRecord {
+    Lsn lsn = INVALID_LSN;
+    WalRecordType type = WalRecordType::PAGE_WRITE;
+    PageId page = 0;
+    uint16_t offset = 0;            // relativo ao payload da página
+    uint32_t length = 0;
+    const char* bytes = nullptr;
+    Lsn redo_lsn = INVALID_LSN;     // CHECKPOINT
+};
+
+class Wal {
+public:
+    // Abre (ou cria) o log e descarta o que houver depois de end_lsn,
+    // que deve ser o fim do log válido encontrado pelo recovery. A escrita
+    // do buffer e o fdatasync vão pela IoEngine; o WAL não usa O_DIRECT
+    // (appends não são alinhados em página).
+    Wal(const std::string& path, Lsn end_lsn, IoEngine& io);
+    ~Wal();
+
+    Wal(const Wal&) = delete;
+    Wal& operator=(const Wal&) = delete;
+
+    Lsn appendPageWrite(PageId page, uint16_t offset, const void* data, uint16_t length);
+    Lsn appendCheckpoint(Lsn redo_lsn);
+
+    // Lança std::runtime_error se o payload passar de WAL_MAX_PAYLOAD
+    Lsn appendTableRecord(WalRecordType type, const std::string& payload);
+
+    // Garante que o registro em lsn (e todos antes dele) está em disco.
+    // Group commit: quem chega durante um fsync em andamento pega carona
+    // no próximo, em vez de fazer um fsync por registro.
+    //
+    // Falhas lançam std::runtime_error. Escrita que falha (ou curta) devolve
+    // os bytes ao buffer: a próxima tentativa reescreve o mesmo intervalo e
+    // o arquivo nunca fica com um buraco antes de registros posteriores.
+    // fsync que falha marca o WAL como falho (o kernel pode ter descartado
+    // as páginas sujas, então repetir o fsync não prova nada): daí em diante
+    // todo append e flush lança.
+    void flush(Lsn lsn);
+    void flushAll();
+
+    // Descarta o log antes de lsn (um registro já coberto pelo checkpoint):
+    // copia [lsn, fim escrito) para "<path>.tmp" com a base nova, fsync e
+    // rename por cima do log. Só copia quando a parte descartada passa de
+    // WAL_TRUNCATE_MIN_BYTES e não é menor que a cópia, então cada byte
+    // copiado paga um byte descartado e o arquivo fica em ~2x a cauda viva.
+    // Escritas e fsyncs esperam a cópia; appends seguem no buffer.
+    //
+    // Retorna os bytes descartados (0 se não truncou). O rename só fica
+    // durável com o fsync do diretório, que fica com quem chama; antes
+    // disso um crash deixa o log antigo ou o novo, ambos válidos.
+    uint64_t truncateBefore(Lsn lsn);
+
+    // Próximo LSN a ser atribuído
+    Lsn endLsn() const;
+    Lsn durableLsn() const;
+
+    const std::string& path() const { return path_; }
+
+private:
+    std::string path_;
+    IoEngine& io_;
+    int fd_;
+    Lsn base_;                      // LSN do offset 0 do arquivo (write_mutex_)
+
+    mutable std::mutex mutex_;      // buffer e LSNs
+    std::mutex write_mutex_;        // serializa escrita + fsync no arquivo
+    std::string buffer_;            // registros ainda não escritos
+    Lsn buffer_start_;              // LSN do primeiro byte de buffer_
+    Lsn next_lsn_;
+    Lsn durable_;                   // tudo antes disso está em disco
+    std::string failure_;           // não vazio: fsync falhou, WAL inutilizável
+
+    Lsn append(WalRecordType type, const std::string& payload);
+    void writeOut(Lsn target, bool sync);
+    void checkFailedLocked() const;
+};
+
+// Lote de registros lidos em sequência. O registro i ocupa
+// data[offsets[i], offsets[i + 1]) e tem LSN start + offsets[i].
+struct WalBatch {
+    Lsn start = INVALID_LSN;
+    std::vector<char> data;
+    std::vector<uint32_t> offsets;
+
+    size_t size() const { return offsets.empty() ? 0 : offsets.size() - 1; }
+    Lsn lsnAt(size_t i) const { return start + offsets[i]; }
+    const char* recordAt(size_t i) const { return data.data() + offsets[i]; }
+    uint32_t lengthAt(size_t i) const { return offsets[i + 1] - offsets[i]; }
+};
+
+// Leitura sequencial do WAL em lotes. O reader só confere o enquadramento
+// (tamanho e LSN de cada registro); o CRC fica para decodeWalRecord, que o
+// recovery chama em paralelo sobre o lote. Um start antes do início do
+// arquivo (log já truncado) começa no primeiro registro que restou.
+class WalReader {
+public:
+    WalReader(const std::string& path, Lsn start);
+    ~WalReader();
+
+    WalReader(const WalReader&) = delete;
+    WalReader& operator=(const WalReader&) = delete;
+
+    // Lê até max_bytes de registros completos; false no fim do log
+    bool nextBatch(WalBatch& batch, size_t max_bytes);
+
+    // LSN logo após o último registro enquadrado
+    Lsn position() const { return position_; }
+
+private:
+    int fd_;
+    Lsn base_;
+    Lsn position_;
+    bool ended_;
+};
+
+// Confere o CRC e decodifica um registro; false se estiver corrompido
+bool decodeWalRecord(const char* data, uint32_t length, Lsn lsn, WalRecord& record);
+
+} // namespace storage
+} // namespace miniql
+
+#endif // MINIQL_STORAGE_WAL_H
@@ -0,0 +1,84 @@
+#ifndef MINIQL_STORAGE_ZONE_MAP_H
+#define MINIQL_STORAGE_ZONE_MAP_H
+
+#include "catalog/schema.h"
+#include "common/value.h"
+#include "storage/hash_index.h"
+#include <cstdint>
+#include <vector>
+
+namespace miniql {
+namespace storage {
+
+// ZONE MAPS
+// Resumo por bloco de ZONE_BLOCK_ROWS linhas consecutivas (a "página" de
+// uma tabela em memória) para cada coluna INT/REAL/DATE/TIMESTAMP: menor e
+// maior valor não-NULL e quantidade de NULLs. Um scan com limites por
+// coluna pula blocos cujo intervalo não pode satisfazê-los; em tabelas
+// inseridas mais ou menos em ordem de id ou de tempo, um filtro de
+// intervalo lê só os poucos blocos que o cobrem.
+//
+// Mantidos a cada insert e delete. Um delete só recalcula o bloco quando a
+// linha removida tinha o mínimo ou o máximo da coluna.
+
+constexpr size_t ZONE_BLOCK_ROWS = 1024;
+
+struct ZoneSummary {
+    Value min;                  // NULL enquanto o bloco não tiver valores
+    Value max;
+    uint32_t nulls = 0;
+};
+
+// Limite de uma coluna tirado do WHERE: low <= col <= high (ou <).
+// NULL em low/high = sem limite daquele lado.
+struct ColumnRange {
+    size_t column = 0;
+    Value low;
+    Value high;
+    bool low_inclusive = true;
+    bool high_inclusive = true;
+};
+
+struct ZoneScanStats {
+    size_t blocks = 0;
+    size_t blocks_skipped = 0;
+    size_t rows = 0;            // linhas vivas entregues ao chamador
+};
+
+class ZoneMap {
+public:
+    explicit ZoneMap(const catalog::TableSchema& schema);
+
+    bool tracks(size_t column) const { return column < slots_.size() && slots_[column] >= 0; }
+    size_t blockCount() const { return live_rows_.size(); }
+
+    void insert(RowId id, const Row& row);
+
+    // Chamado depois de a linha sair da tabela: rows/live já não a contêm
+    void erase(RowId id, const Row& removed, const std::vector<Row>& rows, const std::vector<uint8_t>& live);
+
+    void clear();
+
+    // false só se nenhuma linha viva do bloco pode satisfazer todos os
+    // limites (blocos vazios também são pulados)
+    bool mayMatch(size_t block, const std::vector<ColumnRange>& ranges) const;
+
+    // nullptr se a coluna não tiver zone map ou o bloco não existir
+    const ZoneSummary* summary(size_t block, size_t column) const;
+    uint32_t liveRows(size_t block) const { return block < live_rows_.size() ? live_rows_[block] : 0; }
+
+    size_t memoryBytes() const;
+
+private:
+    std::vector<int> slots_;                        // coluna → índice em zones_ (-1 = sem)
+    std::vector<size_t> columns_;                   // índice em zones_ → coluna
+    std::vector<std::vector<ZoneSummary>> zones_;   // [slot][bloco]
+    std::vector<uint32_t> live_rows_;               // por bloco
+
+    void recompute(size_t slot, size_t block, const std::vector<Row>& rows, const std::vector<uint8_t>& live);
+};
+
+} // namespace storage
+} // namespace miniql
+
+#endif // MINIQL_STORAGE_ZONE_MAP_H
@@ -0,0 +1,112 @@
+#include "ast/expression.h"
+
+namespace miniql {
+namespace ast {
+
+ExprPtr makeColumn(const std::string& name, int index) {
+    return std::make_unique<ColumnExpr>(name, index);
+}
+
+ExprPtr makeLiteral(Value value) {
+    return std::make_unique<LiteralExpr>(std::move(value));
+}
+
+ExprPtr makeBinary(BinaryOp op, ExprPtr left, ExprPtr right) {
+    return std::make_unique<BinaryExpr>(op, std::move(left), std::move(right));
+}
+
+ExprPtr makeUnary(UnaryOp op, ExprPtr operand) {
+    return std::make_unique<UnaryExpr>(op, std::move(operand));
+}
+
+bool isComparison(BinaryOp op) {
+    return op == BinaryOp::EQ || op == BinaryOp::NE ||
+           op == BinaryOp::LT || op == BinaryOp::LE ||
+           op == BinaryOp::GT || op == BinaryOp::GE;
+}
+
+bool isArithmetic(BinaryOp op) {
+    return op == BinaryOp::ADD || op == BinaryOp::SUB ||
+           op == BinaryOp::MUL || op == BinaryOp::DIV || op == BinaryOp::MOD;
+}
+
+bool isLogical(BinaryOp op) {
+    return op == BinaryOp::AND || op == BinaryOp::OR;
+}
+
+BinaryOp flipComparison(BinaryOp op) {
+    switch (op) {
+        case BinaryOp::LT: return BinaryOp::GT;
+        case BinaryOp::LE: return BinaryOp::GE;
+        case BinaryOp::GT: return BinaryOp::LT;
+        case BinaryOp::GE: return BinaryOp::LE;
+        default: return op;
+    }
+}
+
+bool binaryOpFromToken(lexer::TokenType type, BinaryOp& op) {
+    using lexer::TokenType;
+    switch (type) {
+        case TokenType::PLUS: op = BinaryOp::ADD; return true;
+        case TokenType::MINUS: op = BinaryOp::SUB; return true;
+        case TokenType::STAR: op = BinaryOp::MUL; return true;
+        case TokenType::SLASH: op = BinaryOp::DIV; return true;
+        case TokenType::PERCENT: op = BinaryOp::MOD; return true;
+        case TokenType::EQUAL: op = BinaryOp::EQ; return true;
+        case TokenType::NOT_EQUAL: op = BinaryOp::NE; return true;
+        case TokenType::LESS_THAN: op = BinaryOp::LT; return true;
+        case TokenType::LESS_EQUAL: op = BinaryOp::LE; return true;
+        case TokenType::GREATER_THAN: op = BinaryOp::GT; return true;
+        case TokenType::GREATER_EQUAL: op = BinaryOp::GE; return true;
+        case TokenType::AND: op = BinaryOp::AND; return true;
+        case TokenType::OR: op = BinaryOp::OR; return true;
+        default: return false;
+    }
+}
+
+std::string binaryOpToString(BinaryOp op) {
+    switch (op) {
+        case BinaryOp::ADD: return "+";
+        case BinaryOp::SUB: return "-";
+        case BinaryOp::MUL: return "*";
+        case BinaryOp::DIV: return "/";
+        case BinaryOp::MOD: return "%";
+        case BinaryOp::EQ: return "=";
+        case BinaryOp::NE: return "!=";
+        case BinaryOp::LT: return "<";
+        case BinaryOp::LE: return "<=";
+        case BinaryOp::GT: return ">";
+        case BinaryOp::GE: return ">=";
+        case BinaryOp::AND: return "AND";
+        case BinaryOp::OR: return "OR";
+        default: return "?";
+    }
+}
+
+std::string expressionToString(const Expression& expr) {
+    switch (expr.getType()) {
+        case ExprType::COLUMN: {
+            const auto& column = static_cast<const ColumnExpr&>(expr);
+            if (column.table_name.empty()) return column.column_name;
+            return column.table_name + "." + column.column_name;
+        }
+        case ExprType::LITERAL:
+            return static_cast<const LiteralExpr&>(expr).value.toString();
+        case ExprType::BINARY: {
+            const auto& binary = static_cast<const BinaryExpr&>(expr);
+            return "(" + expressionToString(*binary.left) + " " +
+                   binaryOpToString(binary.op) + " " +
+                   expressionToString(*binary.right) + ")";
+        }
+        case ExprType::UNARY: {
+            const auto& unary = static_cast<const UnaryExpr&>(expr);
+            if (unary.op == UnaryOp::NOT) return "NOT " + expressionToString(*unary.operand);
+            return "-" + expressionToString(*unary.operand);
+        }
+        default:
+            return "?";
+    }
+}
+
+} // namespace ast
+} // namespace miniql
@@ -0,0 +1,45 @@
+#include "catalog/schema.h"
+#include <cctype>
+
+namespace miniql {
+namespace catalog {
+
+std::string tableEngineToString(TableEngine engine) {
+    switch (engine) {
+        case TableEngine::DISK: return "DISK";
+        case TableEngine::MEMORY: return "MEMORY";
+    }
+    return "UNKNOWN";
+}
+
+bool parseTableEngine(const std::string& name, TableEngine& engine) {
+    std::string upper;
+    for (char c : name) upper += static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+
+    if (upper == "DISK") {
+        engine = TableEngine::DISK;
+    } else if (upper == "MEMORY") {
+        engine = TableEngine::MEMORY;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+int TableSchema::columnIndex(const std::string& column_name) const {
+    for (size_t i = 0; i < columns.size(); i++) {
+        const std::string& name = columns[i].name;
+        if (name.size() != column_name.size()) continue;
+
+        bool equal = true;
+        for (size_t j = 0; j < name.size() && equal; j++) {
+            equal = std::toupper(static_cast<unsigned char>(name[j])) ==
+                    std::toupper(static_cast<unsigned char>(column_name[j]));
+        }
+        if (equal) return static_cast<int>(i);
+    }
+    return -1;
+}
+
+} // namespace catalog
+} // namespace miniql
@@ -0,0 +1,62 @@
+#include "common/crc32.h"
+#include <array>
+#include <cstring>
+
+namespace miniql {
+
+namespace {
+
+// Slicing-by-8: 8 tabelas, processa 8 bytes por iteração. O WAL inteiro
+// passa por aqui durante o recovery, então a versão byte a byte vira o
+// gargalo da leitura do log.
+using CrcTables = std::array<std::array<uint32_t, 256>, 8>;
+
+CrcTables buildTables() {
+    CrcTables tables{};
+    for (uint32_t i = 0; i < 256; i++) {
+        uint32_t c = i;
+        for (int k = 0; k < 8; k++) {
+            c = (c & 1) ? 0xedb88320u ^ (c >> 1) : c >> 1;
+        }
+        tables[0][i] = c;
+    }
+    for (uint32_t i = 0; i < 256; i++) {
+        for (size_t t = 1; t < 8; t++) {
+            uint32_t prev = tables[t - 1][i];
+            tables[t][i] = tables[0][prev & 0xff] ^ (prev >> 8);
+        }
+    }
+    return tables;
+}
+
+} // namespace
+
+uint32_t crc32(const void* data, size_t length, uint32_t seed) {
+    static const CrcTables t = buildTables();
+
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    uint32_t crc = ~seed;
+
+    while (length >= 8) {
+        uint32_t lo;
+        uint32_t hi;
+        std::memcpy(&lo, bytes, 4);
+        std::memcpy(&hi, bytes + 4, 4);
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        lo = __builtin_bswap32(lo);
+        hi = __builtin_bswap32(hi);
+#endif
+        lo ^= crc;
+        crc = t[7][lo & 0xff] ^ t[6][(lo >> 8) & 0xff] ^ t[5][(lo >> 16) & 0xff] ^ t[4][lo >> 24] ^
+              t[3][hi & 0xff] ^ t[2][(hi >> 8) & 0xff] ^ t[1][(hi >> 16) & 0xff] ^ t[0][hi >> 24];
+        bytes += 8;
+        length -= 8;
+    }
+
+    while (length-- > 0) {
+        crc = t[0][(crc ^ *bytes++) & 0xff] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+} // namespace miniql
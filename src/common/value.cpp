@@ -0,0 +1,114 @@
+#include "common/value.h"
+#include <cmath>
+#include <cstring>
+#include <sstream>
+
+namespace miniql {
+
+std::string dataTypeToString(DataType type) {
+    switch (type) {
+        case DataType::INT: return "INT";
+        case DataType::REAL: return "REAL";
+        case DataType::TEXT: return "TEXT";
+        case DataType::BLOB: return "BLOB";
+        case DataType::DATE: return "DATE";
+        case DataType::TIMESTAMP: return "TIMESTAMP";
+        default: return "UNKNOWN";
+    }
+}
+
+bool isNumericType(DataType type) {
+    return type == DataType::INT || type == DataType::REAL ||
+           type == DataType::DATE || type == DataType::TIMESTAMP;
+}
+
+int64_t Value::asInt() const {
+    if (kind() == Kind::REAL) return static_cast<int64_t>(std::get<double>(data_));
+    return std::get<int64_t>(data_);
+}
+
+double Value::asReal() const {
+    if (kind() == Kind::INTEGER) return static_cast<double>(std::get<int64_t>(data_));
+    return std::get<double>(data_);
+}
+
+// Ordem: NULL < números < textos. NaN fica depois de todos os outros
+// números e é igual a si mesmo (como no PostgreSQL): sort, histogramas e
+// std::map precisam de uma ordem fraca estrita, e NaN "igual a tudo" não é
+int Value::compare(const Value& other) const {
+    auto rank = [](Kind k) {
+        switch (k) {
+            case Kind::NULL_VALUE: return 0;
+            case Kind::INTEGER:
+            case Kind::REAL: return 1;
+            default: return 2;
+        }
+    };
+
+    int left_rank = rank(kind());
+    int right_rank = rank(other.kind());
+    if (left_rank != right_rank) return left_rank < right_rank ? -1 : 1;
+
+    switch (left_rank) {
+        case 0:
+            return 0;
+        case 1:
+            if (kind() == Kind::INTEGER && other.kind() == Kind::INTEGER) {
+                int64_t a = std::get<int64_t>(data_);
+                int64_t b = std::get<int64_t>(other.data_);
+                return a < b ? -1 : (a > b ? 1 : 0);
+            } else {
+                double a = asReal();
+                double b = other.asReal();
+                if (std::isnan(a) || std::isnan(b)) return std::isnan(a) - std::isnan(b);
+                return a < b ? -1 : (a > b ? 1 : 0);
+            }
+        default:
+            return asText().compare(other.asText());
+    }
+}
+
+uint64_t Value::hash() const {
+    switch (kind()) {
+        case Kind::NULL_VALUE:
+            return mixHash(0);
+        case Kind::INTEGER:
+            return mixHash(static_cast<uint64_t>(std::get<int64_t>(data_)));
+        case Kind::REAL: {
+            // Reais inteiros precisam do mesmo hash do INTEGER equivalente
+            // e todos os NaN (iguais entre si em compare) o mesmo hash
+            double d = std::get<double>(data_);
+            if (std::isnan(d)) return mixHash(0x7ff8000000000000ULL);
+            if (std::floor(d) == d && std::fabs(d) < 9.2e18) {
+                return mixHash(static_cast<uint64_t>(static_cast<int64_t>(d)));
+            }
+            uint64_t bits;
+            std::memcpy(&bits, &d, sizeof(bits));
+            return mixHash(bits);
+        }
+        default: {
+            // FNV-1a seguido de mistura final
+            uint64_t h = 0xcbf29ce484222325ULL;
+            for (unsigned char c : asText()) {
+                h ^= c;
+                h *= 0x100000001b3ULL;
+            }
+            return mixHash(h);
+        }
+    }
+}
+
+std::string Value::toString() const {
+    switch (kind()) {
+        case Kind::NULL_VALUE: return "NULL";
+        case Kind::INTEGER: return std::to_string(std::get<int64_t>(data_));
+        case Kind::REAL: {
+            std::ostringstream ss;
+            ss << std::get<double>(data_);
+            return ss.str();
+        }
+        default: return "'" + asText() + "'";
+    }
+}
+
+} // namespace miniql
@@ -0,0 +1,253 @@
+#include "executor/materialized_view.h"
+#include "executor/result_cache.h"
+#include "executor/table_scan.h"
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+
+// Benchmark do cache de resultados da sessão.
+// Uso: ./cache_bench [linhas] [consultas]
+//
+// Clientes repetem um conjunto pequeno de SELECTs com grafias diferentes
+// (caixa, espaços, comentários, ';' opcional) sobre uma tabela em memória,
+// com algumas escritas no meio. Cada consulta passa pelo Scanner, vira
+// chave e é respondida do cache ou executada (seq scan com zone maps) e
+// guardada. Compara a latência média com e sem cache, confere que todo
+// hit é igual à execução e que uma escrita invalida as entradas da tabela
+// e das views materializadas sobre ela.
+
+using namespace miniql;
+using namespace miniql::ast;
+using namespace miniql::executor;
+
+namespace {
+
+constexpr int64_t TS_STEP = 1000;
+constexpr size_t TEMPLATES = 40;
+
+catalog::TableSchema eventsSchema() {
+    catalog::TableSchema schema;
+    schema.name = "events";
+    schema.engine = catalog::TableEngine::MEMORY;
+    schema.columns = {
+        {"id", DataType::INT},
+        {"ts", DataType::TIMESTAMP},
+        {"amount", DataType::REAL},
+        {"region", DataType::INT},
+    };
+    schema.columns[0].primary_key = true;
+    return schema;
+}
+
+Row eventRow(int64_t id, std::mt19937_64& rng) {
+    return {Value::integer(id), Value::integer(id * TS_STEP + static_cast<int64_t>(rng() % TS_STEP)),
+            Value::real(static_cast<double>(rng() % 100000) / 100.0), Value::integer(static_cast<int64_t>(rng() % 16))};
+}
+
+struct Query {
+    int64_t low;
+    int64_t high;
+};
+
+// Mesma consulta, grafias diferentes
+std::string spell(const Query& query, std::mt19937_64& rng) {
+    std::string lo = std::to_string(query.low);
+    std::string hi = std::to_string(query.high);
+    switch (rng() % 4) {
+        case 0: return "SELECT * FROM events WHERE ts >= " + lo + " AND ts < " + hi + ";";
+        case 1: return "select *  from Events where ts>=" + lo + " and ts<" + hi;
+        case 2: return "SELECT *\n  FROM events -- painel\n WHERE ts >= " + lo + "\n   AND ts < " + hi + " ;";
+        default: return "/* poll */ SeLeCt * FROM EVENTS WHERE TS >= " + lo + " AND TS < " + hi;
+    }
+}
+
+CachedResult execute(const storage::MemoryTable& table, const Query& query) {
+    ExprPtr predicate = makeBinary(BinaryOp::AND,
+                                   makeBinary(BinaryOp::GE, makeColumn("ts"), makeLiteral(Value::integer(query.low))),
+                                   makeBinary(BinaryOp::LT, makeColumn("ts"), makeLiteral(Value::integer(query.high))));
+    std::string error;
+    resolveColumns(*predicate, table.schema(), error);
+
+    CachedResult result;
+    for (const auto& column : table.schema().columns) result.columns.push_back(column.name);
+    scanTable(table, predicate.get(), [&](storage::RowId, const Row& row) { result.rows.push_back(row); });
+    return result;
+}
+
+bool sameResult(const CachedResult& a, const CachedResult& b) {
+    if (a.columns != b.columns || a.rows.size() != b.rows.size()) return false;
+    for (size_t i = 0; i < a.rows.size(); i++) {
+        if (a.rows[i].size() != b.rows[i].size()) return false;
+        for (size_t j = 0; j < a.rows[i].size(); j++) {
+            if (a.rows[i][j].kind() != b.rows[i][j].kind() || a.rows[i][j] != b.rows[i][j]) return false;
+        }
+    }
+    return true;
+}
+
+struct RunResult {
+    double us_per_query = 0.0;
+    size_t writes = 0;
+    ResultCacheStats cache;
+};
+
+// verify: executa também a cada hit e compara
+RunResult run(storage::MemoryTable& table, ResultCache& cache, const std::vector<Query>& queries, size_t count,
+              int64_t& next_id, bool verify) {
+    std::mt19937_64 rng(99);
+    RunResult result;
+    cache.resetStats();
+    auto start = std::chrono::steady_clock::now();
+
+    for (size_t i = 0; i < count; i++) {
+        // 1% de escritas: linha nova no fim da tabela
+        if (rng() % 100 == 0) {
+            table.insert(eventRow(next_id++, rng));
+            result.writes++;
+            continue;
+        }
+
+        // Poucas consultas quentes: metade das requisições nas 4 primeiras
+        size_t pick = rng() % 2 ? rng() % 4 : rng() % queries.size();
+        const Query& query = queries[pick];
+        lexer::Scanner scanner(spell(query, rng));
+        CacheKey key = makeCacheKey(scanner.scanTokens());
+
+        CacheTicket ticket;
+        std::shared_ptr<const CachedResult> cached = cache.lookup(key, &ticket);
+        if (cached) {
+            if (verify && !sameResult(*cached, execute(table, query))) {
+                throw std::runtime_error("cache hit differs from execution for ts in [" +
+                                         std::to_string(query.low) + ", " + std::to_string(query.high) + ")");
+            }
+            continue;
+        }
+        cache.store(key, ticket, execute(table, query));
+    }
+
+    result.us_per_query = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() /
+                          static_cast<double>(count);
+    result.cache = cache.stats();
+    return result;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t rows = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 500000;
+    size_t count = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 20000;
+
+    try {
+        storage::MemoryTable table(eventsSchema(), nullptr);
+        std::mt19937_64 rng(1);
+        int64_t next_id = 0;
+        for (size_t i = 0; i < rows; i++) table.insert(eventRow(next_id++, rng));
+
+        // Janelas de 0.1% a 2% da tabela; as quentes ficam no fim (dados
+        // recentes), onde caem as escritas
+        std::vector<Query> queries;
+        int64_t span = static_cast<int64_t>(rows) * TS_STEP;
+        for (size_t i = 0; i < TEMPLATES; i++) {
+            int64_t width = span / 1000 * static_cast<int64_t>(1 + rng() % 20);
+            int64_t low = i < 4 ? span - width : static_cast<int64_t>(rng() % static_cast<uint64_t>(span - width));
+            queries.push_back({low, low + width});
+        }
+
+        // Correção: todo hit conferido com a execução
+        {
+            ResultCache cache;
+            CacheInvalidator invalidator(cache, table);
+            RunResult checked = run(table, cache, queries, count / 4, next_id, true);
+            std::cout << "Verified " << checked.cache.hits << " cache hits against execution ("
+                      << checked.writes << " writes, " << checked.cache.invalidations << " invalidations)\n";
+
+            // Uma escrita descarta as entradas da tabela na hora
+            lexer::Scanner scanner(spell(queries[0], rng));
+            CacheKey key = makeCacheKey(scanner.scanTokens());
+            CacheTicket ticket;
+            if (!cache.lookup(key, &ticket)) cache.store(key, ticket, execute(table, queries[0]));
+            size_t before = cache.stats().entries;
+            table.insert(eventRow(next_id++, rng));
+            if (cache.lookup(key) || cache.stats().entries != 0) {
+                std::cerr << "FAILED: write did not invalidate the cached result\n";
+                return 1;
+            }
+            std::cout << "Write invalidated " << before << " cached results\n";
+
+            // SELECT numa view: a chave traz o nome da view, mas as escritas
+            // chegam pela tabela base (observador da MemoryTable ou shell)
+            lexer::Scanner create("CREATE MATERIALIZED VIEW by_region AS "
+                                  "SELECT region, COUNT(*), SUM(amount) FROM events GROUP BY region;");
+            MaterializedView view(parseMaterializedView(create.scanTokens()), table);
+            cache.addView(view.definition().name, view.definition().table);
+            lexer::Scanner select("SELECT * FROM By_Region");
+            CacheKey view_key = makeCacheKey(select.scanTokens());
+            auto cacheView = [&] {
+                CacheTicket view_ticket;
+                if (!cache.lookup(view_key, &view_ticket)) {
+                    cache.store(view_key, view_ticket, {view.columnNames(), view.rows()});
+                }
+                return cache.lookup(view_key) != nullptr;
+            };
+
+            bool cached_before_insert = cacheView();
+            table.insert(eventRow(next_id++, rng));
+            bool stale_after_insert = cache.lookup(view_key) != nullptr;
+
+            bool cached_before_delete = cacheView();
+            lexer::Scanner remove("DELETE FROM Events WHERE id = 0;");
+            cache.noteWrite(writtenTable(remove.scanTokens()));
+            bool stale_after_delete = cache.lookup(view_key) != nullptr;
+
+            if (!cached_before_insert || !cached_before_delete || stale_after_insert || stale_after_delete) {
+                std::cerr << "FAILED: write to events did not invalidate the cached SELECT on view by_region\n";
+                return 1;
+            }
+            std::cout << "Writes to events invalidated the cached SELECT on view by_region\n";
+        }
+
+        // Palavras-chave não reservadas como nomes de tabela, coluna e view
+        {
+            lexer::Scanner insert("INSERT INTO View VALUES (1);");
+            lexer::Scanner select("SELECT engine FROM view WHERE analyze > 0");
+            lexer::Scanner create("CREATE MATERIALIZED VIEW engine AS SELECT view, COUNT(*) FROM view GROUP BY view;");
+            std::string written = writtenTable(insert.scanTokens());
+            CacheKey key = makeCacheKey(select.scanTokens());
+            ViewDefinition definition = parseMaterializedView(create.scanTokens());
+            if (written != "view" || key.tables != std::vector<std::string>{"view"} || definition.name != "engine" ||
+                definition.table != "view" || definition.group_by != std::vector<std::string>{"view"}) {
+                std::cerr << "FAILED: view/engine/analyze not accepted as names (written table '" << written
+                          << "', view '" << definition.name << "' on '" << definition.table << "')\n";
+                return 1;
+            }
+            std::cout << "ANALYZE, ENGINE, MATERIALIZED and VIEW accepted as table, column and view names\n\n";
+        }
+
+        std::cout << std::left << std::setw(22) << "configuration" << std::right << std::setw(12) << "us/query"
+                  << std::setw(11) << "hit rate" << std::setw(10) << "entries" << std::setw(12) << "memory"
+                  << std::setw(11) << "evictions" << "\n";
+        auto print = [](const std::string& name, const RunResult& r) {
+            std::cout << std::left << std::setw(22) << name << std::right << std::fixed << std::setprecision(2)
+                      << std::setw(12) << r.us_per_query << std::setw(10) << std::setprecision(1)
+                      << 100.0 * r.cache.hitRate() << "%" << std::setw(10) << r.cache.entries << std::setw(9)
+                      << r.cache.bytes / 1024 << " KB" << std::setw(11) << r.cache.evictions << "\n";
+        };
+
+        ResultCache disabled(0);
+        print("no cache", run(table, disabled, queries, count, next_id, false));
+
+        // Resultados de 50 KB a 1 MB: o limite menor rejeita os grandes e
+        // vive de evictions; o maior guarda o conjunto inteiro
+        for (size_t megabytes : {4, 16, 64}) {
+            ResultCache cache(megabytes << 20);
+            CacheInvalidator invalidator(cache, table);
+            print("cache " + std::to_string(megabytes) + " MB", run(table, cache, queries, count, next_id, false));
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
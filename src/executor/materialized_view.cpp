@@ -0,0 +1,513 @@
+#include "executor/materialized_view.h"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <mutex>
+#include <stdexcept>
+
+namespace miniql {
+namespace executor {
+
+namespace {
+
+using lexer::Token;
+using lexer::TokenType;
+
+std::string upper(const std::string& text) {
+    std::string out;
+    for (char c : text) out += static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+    return out;
+}
+
+bool sameName(const std::string& a, const std::string& b) { return upper(a) == upper(b); }
+
+// ============================================================================
+// PARSER DO CREATE MATERIALIZED VIEW
+// ============================================================================
+
+class TokenCursor {
+public:
+    explicit TokenCursor(const std::vector<Token>& tokens) : tokens_(tokens) {}
+
+    const Token& peek() const { return tokens_[std::min(position_, tokens_.size() - 1)]; }
+    bool check(TokenType type) const { return peek().type == type; }
+
+    bool match(TokenType type) {
+        if (!check(type)) return false;
+        position_++;
+        return true;
+    }
+
+    const Token& expect(TokenType type, const std::string& what) {
+        if (!check(type)) fail("Expected " + what);
+        return tokens_[position_++];
+    }
+
+    // Identificador ou palavra-chave não reservada (coluna "view", ...)
+    const Token& expectName(const std::string& what) {
+        if (!lexer::isNameToken(peek())) fail("Expected " + what);
+        return tokens_[position_++];
+    }
+
+    [[noreturn]] void fail(const std::string& message) const {
+        const Token& token = peek();
+        std::string near = token.type == TokenType::END_OF_FILE ? "end of input" : "'" + token.lexeme + "'";
+        throw std::runtime_error("[Line " + std::to_string(token.line) + ", Col " + std::to_string(token.column) +
+                                 "] " + message + " near " + near);
+    }
+
+private:
+    const std::vector<Token>& tokens_;
+    size_t position_ = 0;
+};
+
+ViewColumn parseViewColumn(TokenCursor& in) {
+    ViewColumn item;
+    std::string name = in.expectName("column or aggregate").lexeme;
+
+    if (in.match(TokenType::LPAREN)) {
+        item.aggregate = true;
+        if (!parseAggregateFunction(name, item.function)) {
+            throw std::runtime_error("Unsupported aggregate in materialized view: " + name +
+                                     " (use COUNT, SUM, MIN or MAX)");
+        }
+        if (in.match(TokenType::STAR)) {
+            if (item.function != AggregateFunction::COUNT) in.fail("Only COUNT accepts *");
+        } else {
+            item.column = in.expectName("column name").lexeme;
+        }
+        in.expect(TokenType::RPAREN, "')'");
+    } else {
+        item.column = name;
+    }
+
+    if (in.match(TokenType::AS)) item.alias = in.expectName("alias").lexeme;
+    return item;
+}
+
+// ============================================================================
+// RECÁLCULO (referência)
+// ============================================================================
+
+struct RowLess {
+    bool operator()(const Row& a, const Row& b) const {
+        for (size_t i = 0; i < std::min(a.size(), b.size()); i++) {
+            int c = a[i].compare(b[i]);
+            if (c != 0) return c < 0;
+        }
+        return a.size() < b.size();
+    }
+};
+
+int resolveColumn(const catalog::TableSchema& schema, const std::string& name) {
+    int index = schema.columnIndex(name);
+    if (index < 0) throw std::runtime_error("Unknown column " + name + " in table " + schema.name);
+    return index;
+}
+
+Value recomputeAggregate(const ViewColumn& item, int column, bool real, const std::vector<const Row*>& rows) {
+    if (item.column.empty()) return Value::integer(static_cast<int64_t>(rows.size()));
+
+    std::vector<Value> values;
+    for (const Row* row : rows) {
+        if (!(*row)[column].isNull()) values.push_back((*row)[column]);
+    }
+
+    switch (item.function) {
+        case AggregateFunction::COUNT:
+            return Value::integer(static_cast<int64_t>(values.size()));
+        case AggregateFunction::SUM: {
+            if (values.empty()) return Value::null();
+            if (real) {
+                double sum = 0.0;
+                for (const Value& v : values) sum += v.asReal();
+                return Value::real(sum);
+            }
+            int64_t sum = 0;
+            for (const Value& v : values) sum += v.asInt();
+            return Value::integer(sum);
+        }
+        case AggregateFunction::MIN:
+            if (values.empty()) return Value::null();
+            return *std::min_element(values.begin(), values.end());
+        case AggregateFunction::MAX:
+            if (values.empty()) return Value::null();
+            return *std::max_element(values.begin(), values.end());
+    }
+    return Value::null();
+}
+
+bool sameValue(const Value& a, const Value& b) {
+    if (a.kind() == Value::Kind::REAL || b.kind() == Value::Kind::REAL) {
+        if (!a.isNumeric() || !b.isNumeric()) return false;
+        double x = a.asReal();
+        double y = b.asReal();
+        if (std::isnan(x) || std::isnan(y)) return std::isnan(x) && std::isnan(y);
+        return std::fabs(x - y) <= 1e-9 * std::max({1.0, std::fabs(x), std::fabs(y)});
+    }
+    return a.kind() == b.kind() && a == b;
+}
+
+std::string rowToString(const Row& row) {
+    std::string out = "(";
+    for (size_t i = 0; i < row.size(); i++) {
+        if (i) out += ", ";
+        out += row[i].toString();
+    }
+    return out + ")";
+}
+
+} // namespace
+
+// ============================================================================
+// DEFINIÇÃO
+// ============================================================================
+
+std::string aggregateFunctionToString(AggregateFunction function) {
+    switch (function) {
+        case AggregateFunction::COUNT: return "COUNT";
+        case AggregateFunction::SUM: return "SUM";
+        case AggregateFunction::MIN: return "MIN";
+        case AggregateFunction::MAX: return "MAX";
+    }
+    return "?";
+}
+
+bool parseAggregateFunction(const std::string& name, AggregateFunction& function) {
+    std::string key = upper(name);
+    if (key == "COUNT") function = AggregateFunction::COUNT;
+    else if (key == "SUM") function = AggregateFunction::SUM;
+    else if (key == "MIN") function = AggregateFunction::MIN;
+    else if (key == "MAX") function = AggregateFunction::MAX;
+    else return false;
+    return true;
+}
+
+std::string ViewColumn::outputName() const {
+    if (!alias.empty()) return alias;
+    if (!aggregate) return column;
+    return aggregateFunctionToString(function) + "(" + (column.empty() ? "*" : column) + ")";
+}
+
+std::string ViewDefinition::toSql() const {
+    std::string sql = "CREATE MATERIALIZED VIEW " + name + " AS SELECT ";
+    for (size_t i = 0; i < columns.size(); i++) {
+        const ViewColumn& item = columns[i];
+        if (i) sql += ", ";
+        if (item.aggregate) {
+            sql += aggregateFunctionToString(item.function) + "(" + (item.column.empty() ? "*" : item.column) + ")";
+        } else {
+            sql += item.column;
+        }
+        if (!item.alias.empty()) sql += " AS " + item.alias;
+    }
+    sql += " FROM " + table;
+    for (size_t i = 0; i < group_by.size(); i++) sql += (i ? ", " : " GROUP BY ") + group_by[i];
+    return sql + ";";
+}
+
+ViewDefinition parseMaterializedView(const std::vector<Token>& tokens) {
+    if (tokens.empty()) throw std::runtime_error("Empty statement");
+    TokenCursor in(tokens);
+    ViewDefinition view;
+
+    in.expect(TokenType::CREATE, "CREATE");
+    in.expect(TokenType::MATERIALIZED, "MATERIALIZED");
+    in.expect(TokenType::VIEW, "VIEW");
+    view.name = in.expectName("view name").lexeme;
+    in.expect(TokenType::AS, "AS");
+    in.expect(TokenType::SELECT, "SELECT");
+
+    do {
+        view.columns.push_back(parseViewColumn(in));
+    } while (in.match(TokenType::COMMA));
+
+    in.expect(TokenType::FROM, "FROM");
+    view.table = in.expectName("table name").lexeme;
+
+    if (in.check(TokenType::WHERE)) in.fail("WHERE is not supported in materialized views");
+    if (in.match(TokenType::GROUP)) {
+        in.expect(TokenType::BY, "BY");
+        do {
+            view.group_by.push_back(in.expectName("column name").lexeme);
+        } while (in.match(TokenType::COMMA));
+    }
+
+    in.match(TokenType::SEMICOLON);
+    if (!in.check(TokenType::END_OF_FILE)) in.fail("Unexpected token");
+    return view;
+}
+
+// ============================================================================
+// VIEW
+// ============================================================================
+
+size_t MaterializedView::RowHash::operator()(const Row& key) const {
+    uint64_t h = 0;
+    for (const Value& value : key) h = mixHash(h ^ value.hash());
+    return static_cast<size_t>(h);
+}
+
+MaterializedView::MaterializedView(ViewDefinition definition, storage::MemoryTable& table)
+    : definition_(std::move(definition)), table_(table) {
+    const catalog::TableSchema& schema = table.schema();
+    if (!sameName(definition_.table, schema.name)) {
+        throw std::runtime_error("View " + definition_.name + " reads table " + definition_.table + ", not " +
+                                 schema.name);
+    }
+
+    for (const std::string& name : definition_.group_by) {
+        group_columns_.push_back(static_cast<size_t>(resolveColumn(schema, name)));
+    }
+
+    for (const ViewColumn& item : definition_.columns) {
+        column_names_.push_back(item.outputName());
+
+        if (!item.aggregate) {
+            size_t column = static_cast<size_t>(resolveColumn(schema, item.column));
+            auto it = std::find(group_columns_.begin(), group_columns_.end(), column);
+            if (it == group_columns_.end()) {
+                throw std::runtime_error("Column " + item.column + " must appear in GROUP BY or in an aggregate");
+            }
+            outputs_.push_back(-static_cast<int>(it - group_columns_.begin()) - 1);
+            continue;
+        }
+
+        Aggregate aggregate{item.function, -1, false, -1};
+        if (!item.column.empty()) {
+            aggregate.column = resolveColumn(schema, item.column);
+            DataType type = schema.columns[aggregate.column].type;
+            if (item.function == AggregateFunction::SUM) {
+                if (!isNumericType(type)) {
+                    throw std::runtime_error("SUM requires a numeric column: " + item.column + " is " +
+                                             dataTypeToString(type));
+                }
+                aggregate.real = type == DataType::REAL;
+            }
+            if (item.function == AggregateFunction::MIN || item.function == AggregateFunction::MAX) {
+                size_t column = static_cast<size_t>(aggregate.column);
+                auto it = std::find(ordered_columns_.begin(), ordered_columns_.end(), column);
+                aggregate.ordered = static_cast<int>(it - ordered_columns_.begin());
+                if (it == ordered_columns_.end()) ordered_columns_.push_back(column);
+            }
+        }
+        outputs_.push_back(static_cast<int>(aggregates_.size()));
+        aggregates_.push_back(aggregate);
+    }
+
+    // Sem GROUP BY o grupo único existe mesmo com a tabela vazia
+    if (group_columns_.empty()) groups_.emplace(Row(), newGroup());
+    table_.addObserver(this);
+}
+
+MaterializedView::~MaterializedView() {
+    table_.removeObserver(this);
+}
+
+Row MaterializedView::groupKey(const Row& row) const {
+    Row key;
+    key.reserve(group_columns_.size());
+    for (size_t column : group_columns_) key.push_back(row[column]);
+    return key;
+}
+
+MaterializedView::Group MaterializedView::newGroup() const {
+    Group group;
+    group.accumulators.resize(aggregates_.size());
+    group.ordered.resize(ordered_columns_.size());
+    return group;
+}
+
+void MaterializedView::rowInserted(const Row& row) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    Row key = groupKey(row);
+    auto it = groups_.find(key);
+    if (it == groups_.end()) it = groups_.emplace(std::move(key), newGroup()).first;
+    Group& group = it->second;
+
+    group.rows++;
+    for (size_t i = 0; i < aggregates_.size(); i++) {
+        const Aggregate& aggregate = aggregates_[i];
+        if (aggregate.column < 0 || aggregate.ordered >= 0) continue;
+        const Value& value = row[aggregate.column];
+        if (value.isNull()) continue;
+
+        Accumulator& acc = group.accumulators[i];
+        acc.count++;
+        if (aggregate.function == AggregateFunction::SUM) {
+            if (aggregate.real) acc.real_sum += value.asReal();
+            else acc.int_sum += value.asInt();
+        }
+    }
+    for (size_t i = 0; i < ordered_columns_.size(); i++) {
+        const Value& value = row[ordered_columns_[i]];
+        if (!value.isNull()) group.ordered[i][value]++;
+    }
+}
+
+void MaterializedView::rowErased(const Row& row) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    auto it = groups_.find(groupKey(row));
+    if (it == groups_.end()) return;
+    Group& group = it->second;
+
+    group.rows--;
+    if (group.rows == 0 && !group_columns_.empty()) {
+        groups_.erase(it);
+        return;
+    }
+
+    for (size_t i = 0; i < aggregates_.size(); i++) {
+        const Aggregate& aggregate = aggregates_[i];
+        if (aggregate.column < 0 || aggregate.ordered >= 0) continue;
+        const Value& value = row[aggregate.column];
+        if (value.isNull()) continue;
+
+        Accumulator& acc = group.accumulators[i];
+        acc.count--;
+        if (aggregate.function == AggregateFunction::SUM) {
+            if (aggregate.real) acc.real_sum = acc.count ? acc.real_sum - value.asReal() : 0.0;
+            else acc.int_sum -= value.asInt();
+        }
+    }
+    for (size_t i = 0; i < ordered_columns_.size(); i++) {
+        const Value& value = row[ordered_columns_[i]];
+        if (value.isNull()) continue;
+        auto entry = group.ordered[i].find(value);
+        if (entry != group.ordered[i].end() && --entry->second == 0) group.ordered[i].erase(entry);
+    }
+}
+
+Row MaterializedView::output(const Row& key, const Group& group) const {
+    Row row;
+    row.reserve(outputs_.size());
+    for (int slot : outputs_) {
+        if (slot < 0) {
+            row.push_back(key[static_cast<size_t>(-slot - 1)]);
+            continue;
+        }
+
+        const Aggregate& aggregate = aggregates_[slot];
+        const Accumulator& acc = group.accumulators[slot];
+        if (aggregate.column < 0) {
+            row.push_back(Value::integer(static_cast<int64_t>(group.rows)));
+            continue;
+        }
+
+        switch (aggregate.function) {
+            case AggregateFunction::COUNT:
+                row.push_back(Value::integer(static_cast<int64_t>(acc.count)));
+                break;
+            case AggregateFunction::SUM:
+                if (acc.count == 0) row.push_back(Value::null());
+                else row.push_back(aggregate.real ? Value::real(acc.real_sum) : Value::integer(acc.int_sum));
+                break;
+            case AggregateFunction::MIN:
+            case AggregateFunction::MAX: {
+                const auto& values = group.ordered[aggregate.ordered];
+                if (values.empty()) row.push_back(Value::null());
+                else if (aggregate.function == AggregateFunction::MIN) row.push_back(values.begin()->first);
+                else row.push_back(values.rbegin()->first);
+                break;
+            }
+        }
+    }
+    return row;
+}
+
+std::vector<Row> MaterializedView::rows() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    std::vector<Row> result;
+    result.reserve(groups_.size());
+    for (const auto& entry : groups_) result.push_back(output(entry.first, entry.second));
+    return result;
+}
+
+std::unique_ptr<ResultCursor> MaterializedView::read() const {
+    return std::make_unique<VectorCursor>(column_names_, rows());
+}
+
+size_t MaterializedView::groupCount() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return groups_.size();
+}
+
+size_t MaterializedView::memoryBytes() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    // Estimativa: nós do hash e dos multiconjuntos (map ~ 3 ponteiros + cor)
+    constexpr size_t MAP_NODE_OVERHEAD = 4 * sizeof(void*);
+    size_t bytes = groups_.bucket_count() * sizeof(void*);
+    for (const auto& entry : groups_) {
+        bytes += sizeof(entry) + sizeof(void*) + entry.first.capacity() * sizeof(Value);
+        for (const Value& value : entry.first) {
+            if (value.kind() == Value::Kind::TEXT) bytes += value.asText().capacity();
+        }
+        bytes += entry.second.accumulators.capacity() * sizeof(Accumulator);
+        for (const auto& values : entry.second.ordered) {
+            bytes += values.size() * (MAP_NODE_OVERHEAD + sizeof(std::pair<const Value, uint64_t>));
+        }
+    }
+    return bytes;
+}
+
+// ============================================================================
+// CONFERÊNCIA
+// ============================================================================
+
+std::vector<Row> recomputeView(const MaterializedView& view, const storage::MemoryTable& table) {
+    const ViewDefinition& definition = view.definition();
+    const catalog::TableSchema& schema = table.schema();
+
+    std::vector<int> group_columns;
+    for (const std::string& name : definition.group_by) group_columns.push_back(resolveColumn(schema, name));
+
+    std::vector<Row> copies;
+    table.scan([&](storage::RowId, const Row& row) { copies.push_back(row); });
+
+    std::map<Row, std::vector<const Row*>, RowLess> groups;
+    if (group_columns.empty()) groups[Row()];
+    for (const Row& row : copies) {
+        Row key;
+        for (int column : group_columns) key.push_back(row[column]);
+        groups[key].push_back(&row);
+    }
+
+    std::vector<Row> result;
+    for (const auto& entry : groups) {
+        Row out;
+        for (const ViewColumn& item : definition.columns) {
+            int column = item.column.empty() ? -1 : resolveColumn(schema, item.column);
+            if (!item.aggregate) {
+                size_t position = std::find(group_columns.begin(), group_columns.end(), column) - group_columns.begin();
+                out.push_back(entry.first[position]);
+                continue;
+            }
+            bool real = column >= 0 && schema.columns[column].type == DataType::REAL;
+            out.push_back(recomputeAggregate(item, column, real, entry.second));
+        }
+        result.push_back(std::move(out));
+    }
+    return result;
+}
+
+bool sameViewRows(std::vector<Row> a, std::vector<Row> b, std::string& difference) {
+    if (a.size() != b.size()) {
+        difference = "row count " + std::to_string(a.size()) + " vs " + std::to_string(b.size());
+        return false;
+    }
+    std::sort(a.begin(), a.end(), RowLess());
+    std::sort(b.begin(), b.end(), RowLess());
+
+    for (size_t i = 0; i < a.size(); i++) {
+        bool same = a[i].size() == b[i].size();
+        for (size_t j = 0; same && j < a[i].size(); j++) same = sameValue(a[i][j], b[i][j]);
+        if (!same) {
+            difference = "row " + std::to_string(i) + ": " + rowToString(a[i]) + " vs " + rowToString(b[i]);
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace executor
+} // namespace miniql
@@ -0,0 +1,232 @@
+#include "executor/materialized_view.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+
+// Benchmark e conferência das views materializadas incrementais.
+// Uso: ./matview_bench [linhas] [operações]
+//
+// Carrega uma tabela de vendas, cria views agregadas (com e sem GROUP BY,
+// com colunas que têm NULLs) e aplica uma carga mista de INSERT/DELETE.
+// A cada lote de operações cada view é comparada com o recálculo completo;
+// qualquer diferença termina com código 1. Uma segunda carga, com NaN nos
+// preços, confere MIN/MAX (NaN tem posição fixa na ordem). No fim compara o custo de ler a
+// view (O(grupos)) com o de recalcular a consulta com uma passada de hash
+// aggregation (O(tabela)) e o custo que a manutenção acrescenta a cada
+// INSERT.
+
+using namespace miniql;
+using namespace miniql::executor;
+
+namespace {
+
+const char* const REGIONS[] = {"north", "south", "east", "west", "central", "islands", "export", "online"};
+
+catalog::TableSchema salesSchema() {
+    catalog::TableSchema schema;
+    schema.name = "sales";
+    schema.engine = catalog::TableEngine::MEMORY;
+    schema.columns = {
+        {"id", DataType::INT},
+        {"region", DataType::TEXT},
+        {"product", DataType::INT},
+        {"amount", DataType::INT},
+        {"price", DataType::REAL},
+    };
+    schema.columns[0].primary_key = true;
+    return schema;
+}
+
+class Workload {
+public:
+    explicit Workload(uint64_t seed) : rng_(seed) {}
+
+    Row next() {
+        int64_t id = next_id_++;
+        std::string region = REGIONS[rng_() % 8];
+        int64_t product = static_cast<int64_t>(rng_() % 200);
+        // ~5% de NULL em amount e price para exercitar COUNT(col) e SUM de NULLs
+        Value amount = rng_() % 20 == 0 ? Value::null() : Value::integer(static_cast<int64_t>(rng_() % 1000) - 100);
+        Value price = rng_() % 20 == 0 ? Value::null() : Value::real(static_cast<double>(rng_() % 100000) / 100.0);
+        return {Value::integer(id), Value::text(region), Value::integer(product), amount, price};
+    }
+
+    std::mt19937_64& rng() { return rng_; }
+
+private:
+    std::mt19937_64 rng_;
+    int64_t next_id_ = 0;
+};
+
+ViewDefinition define(const std::string& sql) {
+    lexer::Scanner scanner(sql);
+    std::vector<lexer::Token> tokens = scanner.scanTokens();
+    if (scanner.hasErrors()) throw std::runtime_error(scanner.getErrors().front());
+    return parseMaterializedView(tokens);
+}
+
+bool verify(const std::vector<std::unique_ptr<MaterializedView>>& views, const storage::MemoryTable& table,
+            const std::string& when) {
+    for (const auto& view : views) {
+        std::string difference;
+        if (!sameViewRows(view->rows(), recomputeView(*view, table), difference)) {
+            std::cerr << "MISMATCH in " << view->definition().name << " " << when << ": " << difference << "\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+// MIN/MAX sobre REAL com NaN: os multiconjuntos (std::map<Value, ...>)
+// precisam de NaN numa posição fixa (depois de todos os números), senão
+// inserções e remoções se misturam com outras chaves
+bool checkNanOrder() {
+    const double POOL[] = {std::nan(""), -1.5, 0.0, 2.25, 1e9, -std::nan("")};
+    storage::MemoryTable table(salesSchema(), nullptr);
+    std::vector<std::unique_ptr<MaterializedView>> views;
+    views.push_back(std::make_unique<MaterializedView>(
+        define("CREATE MATERIALIZED VIEW nan_by_region AS SELECT region, MIN(price), MAX(price), COUNT(price) "
+               "FROM sales GROUP BY region;"),
+        table));
+    views.push_back(std::make_unique<MaterializedView>(
+        define("CREATE MATERIALIZED VIEW nan_totals AS SELECT MIN(price), MAX(price) FROM sales;"), table));
+
+    std::mt19937_64 rng(5);
+    std::vector<storage::RowId> live;
+    for (int op = 0; op < 2000; op++) {
+        if (live.empty() || rng() % 10 < 6) {
+            Row row = {Value::integer(op), Value::text(REGIONS[rng() % 2]), Value::integer(0), Value::null(),
+                       Value::real(POOL[rng() % 6])};
+            live.push_back(table.insert(std::move(row)));
+        } else {
+            size_t pick = rng() % live.size();
+            table.erase(live[pick]);
+            live[pick] = live.back();
+            live.pop_back();
+        }
+        if (!verify(views, table, "with NaN prices after " + std::to_string(op + 1) + " operations")) return false;
+    }
+
+    // Com NaN vivo, MAX é NaN e MIN é o menor número
+    table.insert({Value::integer(-1), Value::text("north"), Value::integer(0), Value::null(), Value::real(-7.0)});
+    table.insert({Value::integer(-2), Value::text("north"), Value::integer(0), Value::null(),
+                  Value::real(std::nan(""))});
+    Row totals = views[1]->rows().front();
+    if (totals[0] != Value::real(-7.0) || !std::isnan(totals[1].realValue())) {
+        std::cerr << "MISMATCH in nan_totals: MIN " << totals[0].toString() << ", MAX " << totals[1].toString()
+                  << "\n";
+        return false;
+    }
+    return verify(views, table, "with NaN prices");
+}
+
+template <typename Fn>
+double averageUs(int repetitions, Fn&& fn) {
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < repetitions; r++) fn();
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / repetitions;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t rows = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 200000;
+    size_t operations = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 100000;
+    const size_t CHECK_EVERY = std::max<size_t>(1, operations / 20);
+
+    const char* const VIEWS[] = {
+        "CREATE MATERIALIZED VIEW by_region AS SELECT region, COUNT(*), SUM(amount), SUM(price), "
+        "MIN(amount), MAX(price) FROM sales GROUP BY region;",
+        "CREATE MATERIALIZED VIEW by_product AS SELECT region, product, COUNT(amount) AS sold, "
+        "MIN(price) AS cheapest, MAX(price) AS dearest FROM sales GROUP BY region, product;",
+        "CREATE MATERIALIZED VIEW totals AS SELECT COUNT(*), COUNT(price), SUM(amount), MAX(amount) FROM sales;",
+    };
+
+    try {
+        storage::MemoryTable table(salesSchema(), nullptr);
+        Workload workload(7);
+        std::vector<storage::RowId> live;
+
+        // Metade antes das views (estado inicial vem do scan), metade depois
+        for (size_t i = 0; i < rows / 2; i++) live.push_back(table.insert(workload.next()));
+
+        std::vector<std::unique_ptr<MaterializedView>> views;
+        for (const char* sql : VIEWS) views.push_back(std::make_unique<MaterializedView>(define(sql), table));
+        if (!verify(views, table, "after initial build")) return 1;
+
+        for (size_t i = rows / 2; i < rows; i++) live.push_back(table.insert(workload.next()));
+        if (!verify(views, table, "after load")) return 1;
+
+        // Carga mista: 60% INSERT, 40% DELETE de uma linha viva qualquer
+        size_t inserts = 0;
+        size_t deletes = 0;
+        for (size_t op = 1; op <= operations; op++) {
+            if (live.empty() || workload.rng()() % 10 < 6) {
+                live.push_back(table.insert(workload.next()));
+                inserts++;
+            } else {
+                size_t pick = workload.rng()() % live.size();
+                table.erase(live[pick]);
+                live[pick] = live.back();
+                live.pop_back();
+                deletes++;
+            }
+            if (op % CHECK_EVERY == 0 && !verify(views, table, "after " + std::to_string(op) + " operations")) {
+                return 1;
+            }
+        }
+
+        std::cout << "Materialized views: " << rows << " rows loaded, " << inserts << " inserts, " << deletes
+                  << " deletes, " << table.size() << " rows live\n";
+        std::cout << "Incremental state matched full recomputation at every check\n";
+        if (!checkNanOrder()) return 1;
+        std::cout << "MIN/MAX over REAL with NaN matched recomputation (NaN sorts after every number)\n\n";
+
+        std::cout << std::left << std::setw(14) << "view" << std::right << std::setw(9) << "groups"
+                  << std::setw(14) << "read (us)" << std::setw(16) << "recompute (us)" << std::setw(11)
+                  << "speedup" << std::setw(13) << "state (KB)" << "\n";
+        for (const auto& view : views) {
+            double read = averageUs(200, [&] { (void)view->rows(); });
+            // Recalcular = uma passada de hash aggregation sobre a tabela
+            // inteira (a mesma que constrói uma view nova)
+            double recompute = averageUs(5, [&] {
+                MaterializedView fresh(view->definition(), table);
+                (void)fresh.rows();
+            });
+            std::cout << std::left << std::setw(14) << view->definition().name << std::right << std::setw(9)
+                      << view->groupCount() << std::fixed << std::setprecision(2) << std::setw(14) << read
+                      << std::setw(16) << recompute << std::setw(10) << std::setprecision(0) << recompute / read
+                      << "x" << std::setw(13) << view->memoryBytes() / 1024 << "\n";
+        }
+
+        // Custo da manutenção por INSERT: tabela sem views x com as três
+        const int BATCH = 20000;
+        storage::MemoryTable plain(salesSchema(), nullptr);
+        Workload plain_rows(11);
+        Workload view_rows(11);
+        double bare = averageUs(BATCH, [&] { plain.insert(plain_rows.next()); });
+        storage::MemoryTable watched(salesSchema(), nullptr);
+        std::vector<std::unique_ptr<MaterializedView>> watchers;
+        for (const char* sql : VIEWS) watchers.push_back(std::make_unique<MaterializedView>(define(sql), watched));
+        double maintained = averageUs(BATCH, [&] { watched.insert(view_rows.next()); });
+        std::cout << "\nINSERT cost: " << std::setprecision(3) << bare << " us without views, " << maintained
+                  << " us with " << watchers.size() << " views\n";
+
+        // Esvaziar a tabela: os grupos somem e a view sem GROUP BY volta a
+        // COUNT 0 / SUM NULL
+        for (storage::RowId id : live) table.erase(id);
+        if (!verify(views, table, "after deleting every row")) return 1;
+        std::cout << "Empty table: " << views[0]->groupCount() << " groups in by_region, totals = ";
+        std::vector<Row> totals = views[2]->rows();
+        for (const Value& value : totals.front()) std::cout << value.toString() << " ";
+        std::cout << "\n";
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
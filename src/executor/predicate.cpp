@@ -0,0 +1,534 @@
+#include "executor/predicate.h"
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+
+namespace miniql {
+namespace executor {
+
+using ast::BinaryExpr;
+using ast::BinaryOp;
+using ast::ColumnExpr;
+using ast::ExprType;
+using ast::Expression;
+using ast::LiteralExpr;
+using ast::UnaryExpr;
+using ast::UnaryOp;
+
+namespace {
+
+// ============================================================================
+// OPERAÇÕES PRIMITIVAS (compartilhadas pelo interpretador e pelos kernels)
+// ============================================================================
+
+template <BinaryOp Op, typename T>
+inline bool compareValues(const T& a, const T& b) {
+    if constexpr (Op == BinaryOp::EQ) return a == b;
+    else if constexpr (Op == BinaryOp::NE) return a != b;
+    else if constexpr (Op == BinaryOp::LT) return a < b;
+    else if constexpr (Op == BinaryOp::LE) return a <= b;
+    else if constexpr (Op == BinaryOp::GT) return a > b;
+    else return a >= b;
+}
+
+// Aritmética inteira com overflow em complemento de dois (sem UB);
+// retorna false quando o resultado é NULL (divisão por zero)
+template <BinaryOp Op>
+inline bool applyArith(int64_t a, int64_t b, int64_t& out) {
+    uint64_t ua = static_cast<uint64_t>(a);
+    uint64_t ub = static_cast<uint64_t>(b);
+    if constexpr (Op == BinaryOp::ADD) { out = static_cast<int64_t>(ua + ub); return true; }
+    else if constexpr (Op == BinaryOp::SUB) { out = static_cast<int64_t>(ua - ub); return true; }
+    else if constexpr (Op == BinaryOp::MUL) { out = static_cast<int64_t>(ua * ub); return true; }
+    else if constexpr (Op == BinaryOp::DIV) {
+        if (b == 0) return false;
+        out = b == -1 ? static_cast<int64_t>(0 - ua) : a / b;
+        return true;
+    }
+    else {
+        if (b == 0) return false;
+        out = b == -1 ? 0 : a % b;
+        return true;
+    }
+}
+
+template <BinaryOp Op>
+inline bool applyArith(double a, double b, double& out) {
+    if constexpr (Op == BinaryOp::ADD) { out = a + b; return true; }
+    else if constexpr (Op == BinaryOp::SUB) { out = a - b; return true; }
+    else if constexpr (Op == BinaryOp::MUL) { out = a * b; return true; }
+    else if constexpr (Op == BinaryOp::DIV) {
+        if (b == 0.0) return false;
+        out = a / b;
+        return true;
+    }
+    else {
+        if (b == 0.0) return false;
+        out = std::fmod(a, b);
+        return true;
+    }
+}
+
+template <typename T>
+bool applyArith(BinaryOp op, T a, T b, T& out) {
+    switch (op) {
+        case BinaryOp::ADD: return applyArith<BinaryOp::ADD>(a, b, out);
+        case BinaryOp::SUB: return applyArith<BinaryOp::SUB>(a, b, out);
+        case BinaryOp::MUL: return applyArith<BinaryOp::MUL>(a, b, out);
+        case BinaryOp::DIV: return applyArith<BinaryOp::DIV>(a, b, out);
+        default: return applyArith<BinaryOp::MOD>(a, b, out);
+    }
+}
+
+bool compareResult(BinaryOp op, int cmp) {
+    switch (op) {
+        case BinaryOp::EQ: return cmp == 0;
+        case BinaryOp::NE: return cmp != 0;
+        case BinaryOp::LT: return cmp < 0;
+        case BinaryOp::LE: return cmp <= 0;
+        case BinaryOp::GT: return cmp > 0;
+        default: return cmp >= 0;
+    }
+}
+
+// REAL segue a ordem de Value::compare (NaN igual a si mesmo e maior que
+// qualquer outro número), para os kernels concordarem com o interpretador;
+// fora de NaN é a comparação direta
+template <BinaryOp Op>
+inline bool compareValues(double a, double b) {
+    if (std::isunordered(a, b)) return compareResult(Op, std::isnan(a) - std::isnan(b));
+    return compareValues<Op, double>(a, b);
+}
+
+// ============================================================================
+// KERNELS
+// ============================================================================
+// Cada kernel é uma função especializada por (tipo, operador) em tempo de
+// compilação. O caso comum (valor do tipo da coluna) é um load + compare;
+// NULL retorna false e tipos inesperados caem na comparação genérica.
+
+template <BinaryOp Cmp>
+struct IntCompare {
+    static bool run(const KernelState& s, const Row& row) {
+        const Value& v = row[s.column];
+        if (v.kind() == Value::Kind::INTEGER) return compareValues<Cmp>(v.intValue(), s.int_constant);
+        if (v.isNull()) return false;
+        return compareResult(Cmp, v.compare(Value::integer(s.int_constant)));
+    }
+};
+
+template <BinaryOp Cmp>
+struct RealCompare {
+    static bool run(const KernelState& s, const Row& row) {
+        const Value& v = row[s.column];
+        if (v.kind() == Value::Kind::REAL) return compareValues<Cmp>(v.realValue(), s.real_constant);
+        if (v.kind() == Value::Kind::INTEGER) {
+            return compareValues<Cmp>(static_cast<double>(v.intValue()), s.real_constant);
+        }
+        if (v.isNull()) return false;
+        return compareResult(Cmp, v.compare(Value::real(s.real_constant)));
+    }
+};
+
+template <BinaryOp Cmp>
+struct TextCompare {
+    static bool run(const KernelState& s, const Row& row) {
+        const Value& v = row[s.column];
+        if (v.kind() == Value::Kind::TEXT) return compareValues<Cmp>(v.asText().compare(s.text_constant), 0);
+        if (v.isNull()) return false;
+        return compareResult(Cmp, v.compare(Value::text(s.text_constant)));
+    }
+};
+
+template <BinaryOp Arith, BinaryOp Cmp>
+struct IntArithCompare {
+    static bool run(const KernelState& s, const Row& row) {
+        const Value& v = row[s.column];
+        if (v.kind() == Value::Kind::INTEGER) {
+            int64_t result;
+            return applyArith<Arith>(v.intValue(), s.int_operand, result) &&
+                   compareValues<Cmp>(result, s.int_constant);
+        }
+        if (v.kind() == Value::Kind::REAL) {
+            double result;
+            return applyArith<Arith>(v.realValue(), static_cast<double>(s.int_operand), result) &&
+                   compareValues<Cmp>(result, static_cast<double>(s.int_constant));
+        }
+        return false;   // NULL ou texto: aritmética resulta em NULL
+    }
+};
+
+// Operando INT com constante REAL (ex: qty / 2 >= 2.5): a aritmética segue
+// os tipos do valor e do operando, como no interpretador (divisão inteira
+// se ambos forem INTEGER), e só o resultado é comparado como REAL
+template <BinaryOp Arith, BinaryOp Cmp>
+struct IntArithRealCompare {
+    static bool run(const KernelState& s, const Row& row) {
+        const Value& v = row[s.column];
+        if (v.kind() == Value::Kind::INTEGER) {
+            int64_t result;
+            return applyArith<Arith>(v.intValue(), s.int_operand, result) &&
+                   compareValues<Cmp>(static_cast<double>(result), s.real_constant);
+        }
+        if (v.kind() == Value::Kind::REAL) {
+            double result;
+            return applyArith<Arith>(v.realValue(), static_cast<double>(s.int_operand), result) &&
+                   compareValues<Cmp>(result, s.real_constant);
+        }
+        return false;
+    }
+};
+
+template <BinaryOp Arith, BinaryOp Cmp>
+struct RealArithCompare {
+    static bool run(const KernelState& s, const Row& row) {
+        const Value& v = row[s.column];
+        double x;
+        if (v.kind() == Value::Kind::REAL) x = v.realValue();
+        else if (v.kind() == Value::Kind::INTEGER) x = static_cast<double>(v.intValue());
+        else return false;
+
+        double result;
+        return applyArith<Arith>(x, s.real_operand, result) &&
+               compareValues<Cmp>(result, s.real_constant);
+    }
+};
+
+// Tabelas de despacho: (operador em runtime) -> instância do template
+
+template <template <BinaryOp> class K>
+KernelFn byComparison(BinaryOp cmp) {
+    switch (cmp) {
+        case BinaryOp::EQ: return &K<BinaryOp::EQ>::run;
+        case BinaryOp::NE: return &K<BinaryOp::NE>::run;
+        case BinaryOp::LT: return &K<BinaryOp::LT>::run;
+        case BinaryOp::LE: return &K<BinaryOp::LE>::run;
+        case BinaryOp::GT: return &K<BinaryOp::GT>::run;
+        case BinaryOp::GE: return &K<BinaryOp::GE>::run;
+        default: return nullptr;
+    }
+}
+
+template <template <BinaryOp, BinaryOp> class K, BinaryOp Arith>
+KernelFn byComparison(BinaryOp cmp) {
+    switch (cmp) {
+        case BinaryOp::EQ: return &K<Arith, BinaryOp::EQ>::run;
+        case BinaryOp::NE: return &K<Arith, BinaryOp::NE>::run;
+        case BinaryOp::LT: return &K<Arith, BinaryOp::LT>::run;
+        case BinaryOp::LE: return &K<Arith, BinaryOp::LE>::run;
+        case BinaryOp::GT: return &K<Arith, BinaryOp::GT>::run;
+        case BinaryOp::GE: return &K<Arith, BinaryOp::GE>::run;
+        default: return nullptr;
+    }
+}
+
+template <template <BinaryOp, BinaryOp> class K>
+KernelFn byArithmetic(BinaryOp arith, BinaryOp cmp) {
+    switch (arith) {
+        case BinaryOp::ADD: return byComparison<K, BinaryOp::ADD>(cmp);
+        case BinaryOp::SUB: return byComparison<K, BinaryOp::SUB>(cmp);
+        case BinaryOp::MUL: return byComparison<K, BinaryOp::MUL>(cmp);
+        case BinaryOp::DIV: return byComparison<K, BinaryOp::DIV>(cmp);
+        case BinaryOp::MOD: return byComparison<K, BinaryOp::MOD>(cmp);
+        default: return nullptr;
+    }
+}
+
+// ============================================================================
+// RECONHECIMENTO DE FORMATOS
+// ============================================================================
+
+enum class Family { INT, REAL, TEXT, NONE };
+
+Family columnFamily(DataType type) {
+    switch (type) {
+        case DataType::INT:
+        case DataType::DATE:
+        case DataType::TIMESTAMP: return Family::INT;
+        case DataType::REAL: return Family::REAL;
+        case DataType::TEXT: return Family::TEXT;
+        default: return Family::NONE;
+    }
+}
+
+const Value* literalOf(const Expression& expr) {
+    if (expr.getType() != ExprType::LITERAL) return nullptr;
+    const Value& value = static_cast<const LiteralExpr&>(expr).value;
+    return value.isNull() ? nullptr : &value;
+}
+
+const ColumnExpr* columnOf(const Expression& expr) {
+    if (expr.getType() != ExprType::COLUMN) return nullptr;
+    return &static_cast<const ColumnExpr&>(expr);
+}
+
+bool compileLeaf(const Expression& term, const catalog::TableSchema& schema, Kernel& kernel) {
+    if (term.getType() != ExprType::BINARY) return false;
+    const auto& compare = static_cast<const BinaryExpr&>(term);
+    if (!ast::isComparison(compare.op)) return false;
+
+    // Normaliza para "<lado variável> op constante"
+    const Expression* lhs = compare.left.get();
+    const Value* constant = literalOf(*compare.right);
+    BinaryOp cmp = compare.op;
+    if (!constant) {
+        constant = literalOf(*compare.left);
+        lhs = compare.right.get();
+        cmp = ast::flipComparison(compare.op);
+    }
+    if (!constant || (!constant->isNumeric() && constant->kind() != Value::Kind::TEXT)) return false;
+
+    // col arith const  (ou const arith col para operadores comutativos)
+    const ColumnExpr* column = columnOf(*lhs);
+    const Value* operand = nullptr;
+    BinaryOp arith = BinaryOp::ADD;
+    if (!column && lhs->getType() == ExprType::BINARY) {
+        const auto& arithmetic = static_cast<const BinaryExpr&>(*lhs);
+        if (!ast::isArithmetic(arithmetic.op)) return false;
+        arith = arithmetic.op;
+        column = columnOf(*arithmetic.left);
+        operand = literalOf(*arithmetic.right);
+        if (!column && (arith == BinaryOp::ADD || arith == BinaryOp::MUL)) {
+            column = columnOf(*arithmetic.right);
+            operand = literalOf(*arithmetic.left);
+        }
+        if (!column || !operand || !operand->isNumeric()) return false;
+    }
+    if (!column || column->column_index < 0 ||
+        static_cast<size_t>(column->column_index) >= schema.columns.size()) {
+        return false;
+    }
+
+    Family family = columnFamily(schema.columns[column->column_index].type);
+    KernelState& state = kernel.state;
+    state.column = column->column_index;
+
+    if (family == Family::TEXT) {
+        if (operand || constant->kind() != Value::Kind::TEXT) return false;
+        state.text_constant = constant->asText();
+        kernel.fn = byComparison<TextCompare>(cmp);
+        kernel.name = "text_cmp";
+    }
+    else if (family == Family::INT || family == Family::REAL) {
+        if (!constant->isNumeric()) return false;
+
+        // O tipo da aritmética depende só do operando (e, por linha, do valor
+        // da coluna); a constante da comparação não muda a aritmética
+        bool int_constant = constant->kind() == Value::Kind::INTEGER;
+        if (operand && operand->kind() == Value::Kind::INTEGER) {
+            state.int_operand = operand->intValue();
+            if (int_constant) {
+                state.int_constant = constant->intValue();
+                kernel.fn = byArithmetic<IntArithCompare>(arith, cmp);
+                kernel.name = "int_arith_cmp";
+            } else {
+                state.real_constant = constant->asReal();
+                kernel.fn = byArithmetic<IntArithRealCompare>(arith, cmp);
+                kernel.name = "int_arith_real_cmp";
+            }
+        } else if (operand) {
+            state.real_operand = operand->asReal();
+            state.real_constant = constant->asReal();
+            kernel.fn = byArithmetic<RealArithCompare>(arith, cmp);
+            kernel.name = "real_arith_cmp";
+        } else if (family == Family::INT && int_constant) {
+            state.int_constant = constant->intValue();
+            kernel.fn = byComparison<IntCompare>(cmp);
+            kernel.name = "int_cmp";
+        } else {
+            state.real_constant = constant->asReal();
+            kernel.fn = byComparison<RealCompare>(cmp);
+            kernel.name = "real_cmp";
+        }
+    }
+    else {
+        return false;
+    }
+
+    kernel.name += " " + ast::expressionToString(term);
+    return kernel.fn != nullptr;
+}
+
+void flattenTerms(const Expression& expr, BinaryOp op, std::vector<const Expression*>& terms) {
+    if (expr.getType() == ExprType::BINARY) {
+        const auto& binary = static_cast<const BinaryExpr&>(expr);
+        if (binary.op == op) {
+            flattenTerms(*binary.left, op, terms);
+            flattenTerms(*binary.right, op, terms);
+            return;
+        }
+    }
+    terms.push_back(&expr);
+}
+
+Value boolValue(bool value) {
+    return Value::integer(value ? 1 : 0);
+}
+
+} // namespace
+
+// ============================================================================
+// RESOLUÇÃO DE COLUNAS
+// ============================================================================
+
+bool resolveColumns(Expression& expr, const catalog::TableSchema& schema, std::string& error) {
+    switch (expr.getType()) {
+        case ExprType::COLUMN: {
+            auto& column = static_cast<ColumnExpr&>(expr);
+            column.column_index = schema.columnIndex(column.column_name);
+            if (column.column_index < 0) {
+                error = "Unknown column '" + column.column_name + "' in table '" + schema.name + "'";
+                return false;
+            }
+            return true;
+        }
+        case ExprType::BINARY: {
+            auto& binary = static_cast<BinaryExpr&>(expr);
+            return resolveColumns(*binary.left, schema, error) &&
+                   resolveColumns(*binary.right, schema, error);
+        }
+        case ExprType::UNARY:
+            return resolveColumns(*static_cast<UnaryExpr&>(expr).operand, schema, error);
+        default:
+            return true;
+    }
+}
+
+// ============================================================================
+// INTERPRETADOR
+// ============================================================================
+
+bool isTrue(const Value& value) {
+    if (value.kind() == Value::Kind::INTEGER) return value.intValue() != 0;
+    if (value.kind() == Value::Kind::REAL) return value.realValue() != 0.0;
+    return false;
+}
+
+Value evaluate(const Expression& expr, const Row& row) {
+    switch (expr.getType()) {
+        case ExprType::COLUMN: {
+            const auto& column = static_cast<const ColumnExpr&>(expr);
+            if (column.column_index < 0) {
+                throw std::runtime_error("Unresolved column: " + column.column_name);
+            }
+            if (static_cast<size_t>(column.column_index) >= row.size()) return Value::null();
+            return row[column.column_index];
+        }
+
+        case ExprType::LITERAL:
+            return static_cast<const LiteralExpr&>(expr).value;
+
+        case ExprType::UNARY: {
+            const auto& unary = static_cast<const UnaryExpr&>(expr);
+            Value operand = evaluate(*unary.operand, row);
+            if (operand.isNull()) return operand;
+            if (unary.op == UnaryOp::NOT) return boolValue(!isTrue(operand));
+            if (operand.kind() == Value::Kind::INTEGER) {
+                return Value::integer(static_cast<int64_t>(0 - static_cast<uint64_t>(operand.intValue())));
+            }
+            if (operand.kind() == Value::Kind::REAL) return Value::real(-operand.realValue());
+            return Value::null();
+        }
+
+        case ExprType::BINARY: {
+            const auto& binary = static_cast<const BinaryExpr&>(expr);
+
+            // AND/OR com curto-circuito e lógica de três valores
+            if (binary.op == BinaryOp::AND || binary.op == BinaryOp::OR) {
+                bool is_and = binary.op == BinaryOp::AND;
+                Value left = evaluate(*binary.left, row);
+                if (!left.isNull() && isTrue(left) != is_and) return boolValue(!is_and);
+                Value right = evaluate(*binary.right, row);
+                if (!right.isNull() && isTrue(right) != is_and) return boolValue(!is_and);
+                if (left.isNull() || right.isNull()) return Value::null();
+                return boolValue(is_and);
+            }
+
+            Value left = evaluate(*binary.left, row);
+            Value right = evaluate(*binary.right, row);
+            if (left.isNull() || right.isNull()) return Value::null();
+
+            if (ast::isComparison(binary.op)) {
+                return boolValue(compareResult(binary.op, left.compare(right)));
+            }
+
+            if (!left.isNumeric() || !right.isNumeric()) return Value::null();
+            if (left.kind() == Value::Kind::INTEGER && right.kind() == Value::Kind::INTEGER) {
+                int64_t result;
+                if (!applyArith(binary.op, left.intValue(), right.intValue(), result)) return Value::null();
+                return Value::integer(result);
+            }
+            double result;
+            if (!applyArith(binary.op, left.asReal(), right.asReal(), result)) return Value::null();
+            return Value::real(result);
+        }
+
+        default:
+            return Value::null();
+    }
+}
+
+// ============================================================================
+// COMPILAÇÃO
+// ============================================================================
+
+CompiledPredicate compilePredicate(const Expression* predicate, const catalog::TableSchema& schema) {
+    CompiledPredicate compiled;
+    if (!predicate) return compiled;
+
+    // Disjunção: só vale a pena se todos os termos virarem kernels
+    if (predicate->getType() == ExprType::BINARY &&
+        static_cast<const BinaryExpr*>(predicate)->op == BinaryOp::OR) {
+        std::vector<const Expression*> terms;
+        flattenTerms(*predicate, BinaryOp::OR, terms);
+
+        std::vector<Kernel> kernels;
+        for (const Expression* term : terms) {
+            Kernel kernel;
+            if (!compileLeaf(*term, schema, kernel)) break;
+            kernels.push_back(std::move(kernel));
+        }
+        if (kernels.size() == terms.size()) {
+            compiled.mode_ = CompiledPredicate::Mode::ANY_OF;
+            compiled.kernels_ = std::move(kernels);
+        } else {
+            compiled.interpreted_.push_back(predicate);
+        }
+        return compiled;
+    }
+
+    // Conjunção: kernels para o que der, interpretador para o resto
+    std::vector<const Expression*> terms;
+    flattenTerms(*predicate, BinaryOp::AND, terms);
+    for (const Expression* term : terms) {
+        Kernel kernel;
+        if (compileLeaf(*term, schema, kernel)) {
+            compiled.kernels_.push_back(std::move(kernel));
+        } else {
+            compiled.interpreted_.push_back(term);
+        }
+    }
+    return compiled;
+}
+
+std::string CompiledPredicate::describe() const {
+    if (kernels_.empty() && interpreted_.empty()) return "no filter";
+
+    std::ostringstream ss;
+    const char* joiner = mode_ == Mode::ANY_OF ? " OR " : " AND ";
+    bool first = true;
+    for (const Kernel& kernel : kernels_) {
+        if (!first) ss << joiner;
+        ss << "[" << kernel.name << "]";
+        first = false;
+    }
+    for (const Expression* term : interpreted_) {
+        if (!first) ss << joiner;
+        ss << "[interpreted " << ast::expressionToString(*term) << "]";
+        first = false;
+    }
+    return ss.str();
+}
+
+} // namespace executor
+} // namespace miniql
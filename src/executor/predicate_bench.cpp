@@ -0,0 +1,129 @@
+#include "executor/predicate.h"
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <random>
+
+// Benchmark de filtros: interpretador da AST vs kernels compilados.
+// Uso: ./predicate_bench [linhas] [repetições]
+
+using namespace miniql;
+using namespace miniql::ast;
+
+struct Case {
+    std::string description;
+    ExprPtr predicate;
+};
+
+static ExprPtr col(const std::string& name) { return makeColumn(name); }
+static ExprPtr num(int64_t v) { return makeLiteral(Value::integer(v)); }
+static ExprPtr real(double v) { return makeLiteral(Value::real(v)); }
+static ExprPtr str(const std::string& v) { return makeLiteral(Value::text(v)); }
+
+static ExprPtr bin(BinaryOp op, ExprPtr l, ExprPtr r) {
+    return makeBinary(op, std::move(l), std::move(r));
+}
+
+template <typename Fn>
+static double timeIt(int repetitions, Fn&& fn, size_t& matches) {
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < repetitions; r++) matches = fn();
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::milli>(elapsed).count() / repetitions;
+}
+
+int main(int argc, char* argv[]) {
+    size_t row_count = argc > 1 ? std::stoul(argv[1]) : 1000000;
+    int repetitions = argc > 2 ? std::stoi(argv[2]) : 5;
+
+    catalog::TableSchema schema;
+    schema.name = "orders";
+    schema.columns = {
+        {"id", DataType::INT},
+        {"price", DataType::REAL},
+        {"qty", DataType::INT},
+        {"status", DataType::TEXT},
+    };
+
+    const char* statuses[] = {"open", "paid", "shipped", "cancelled"};
+    std::mt19937_64 rng(42);
+    std::vector<Row> rows;
+    rows.reserve(row_count);
+    for (size_t i = 0; i < row_count; i++) {
+        rows.push_back({
+            Value::integer(static_cast<int64_t>(i)),
+            rng() % 50 == 0    ? Value::null()
+            : rng() % 200 == 0 ? Value::real(std::nan(""))      // NaN: kernels seguem Value::compare
+                               : Value::real(double(rng() % 100000) / 100.0),
+            Value::integer(static_cast<int64_t>(rng() % 100)),
+            Value::text(statuses[rng() % 4]),
+        });
+    }
+
+    std::vector<Case> cases;
+    cases.push_back({"qty > 50", bin(BinaryOp::GT, col("qty"), num(50))});
+    cases.push_back({"price <= 250.0", bin(BinaryOp::LE, col("price"), real(250.0))});
+    cases.push_back({"status = 'paid'", bin(BinaryOp::EQ, col("status"), str("paid"))});
+    cases.push_back({"qty >= 10 AND price < 500.0",
+        bin(BinaryOp::AND, bin(BinaryOp::GE, col("qty"), num(10)),
+                           bin(BinaryOp::LT, col("price"), real(500.0)))});
+    cases.push_back({"qty < 5 OR qty > 95",
+        bin(BinaryOp::OR, bin(BinaryOp::LT, col("qty"), num(5)),
+                          bin(BinaryOp::GT, col("qty"), num(95)))});
+    cases.push_back({"price * 2 > 1000.0",
+        bin(BinaryOp::GT, bin(BinaryOp::MUL, col("price"), num(2)), real(1000.0))});
+    cases.push_back({"id % 7 = 3", bin(BinaryOp::EQ, bin(BinaryOp::MOD, col("id"), num(7)), num(3))});
+    cases.push_back({"qty / 2 >= 2.5",
+        bin(BinaryOp::GE, bin(BinaryOp::DIV, col("qty"), num(2)), real(2.5))});
+    cases.push_back({"qty % 7 < 2.5",
+        bin(BinaryOp::LT, bin(BinaryOp::MOD, col("qty"), num(7)), real(2.5))});
+    cases.push_back({"price + 1 > 100",
+        bin(BinaryOp::GT, bin(BinaryOp::ADD, col("price"), num(1)), num(100))});
+    cases.push_back({"qty > 10 AND NOT status = 'open' (mixed)",
+        bin(BinaryOp::AND, bin(BinaryOp::GT, col("qty"), num(10)),
+            makeUnary(UnaryOp::NOT, bin(BinaryOp::EQ, col("status"), str("open"))))});
+
+    std::cout << "Filter benchmark: " << row_count << " rows, "
+              << repetitions << " repetitions (avg ms per scan)\n\n";
+    std::cout << std::left << std::setw(42) << "predicate"
+              << std::right << std::setw(12) << "interp"
+              << std::setw(12) << "compiled"
+              << std::setw(10) << "speedup" << "\n";
+
+    bool mismatch = false;
+    for (Case& c : cases) {
+        std::string error;
+        if (!executor::resolveColumns(*c.predicate, schema, error)) {
+            std::cerr << error << "\n";
+            return 1;
+        }
+        executor::CompiledPredicate compiled = executor::compilePredicate(c.predicate.get(), schema);
+
+        size_t interp_matches = 0;
+        size_t compiled_matches = 0;
+        double interp_ms = timeIt(repetitions, [&] {
+            size_t n = 0;
+            for (const Row& row : rows) n += executor::isTrue(executor::evaluate(*c.predicate, row));
+            return n;
+        }, interp_matches);
+        double compiled_ms = timeIt(repetitions, [&] {
+            size_t n = 0;
+            for (const Row& row : rows) n += compiled.matches(row);
+            return n;
+        }, compiled_matches);
+
+        std::cout << std::left << std::setw(42) << c.description
+                  << std::right << std::fixed << std::setprecision(2)
+                  << std::setw(12) << interp_ms
+                  << std::setw(12) << compiled_ms
+                  << std::setw(9) << interp_ms / compiled_ms << "x";
+        if (interp_matches != compiled_matches) {
+            std::cout << "  MISMATCH (" << interp_matches << " vs " << compiled_matches << ")";
+            mismatch = true;
+        }
+        std::cout << "\n";
+    }
+
+    return mismatch ? 1 : 0;
+}
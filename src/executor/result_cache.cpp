@@ -0,0 +1,296 @@
+#include "executor/result_cache.h"
+#include "metrics/metrics.h"
+#include <algorithm>
+#include <cctype>
+
+namespace miniql {
+namespace executor {
+
+namespace {
+
+using lexer::isNameToken;
+using lexer::Token;
+using lexer::TokenType;
+
+std::string lower(const std::string& text) {
+    std::string out;
+    out.reserve(text.size());
+    for (char c : text) out += static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    return out;
+}
+
+// Lista de tabelas depois de FROM/JOIN: t [AS a | a] {, u [AS b | b]}
+size_t collectTables(const std::vector<Token>& tokens, size_t i, std::vector<std::string>& tables) {
+    while (i < tokens.size() && isNameToken(tokens[i])) {
+        std::string name = lower(tokens[i].lexeme);
+        if (std::find(tables.begin(), tables.end(), name) == tables.end()) tables.push_back(name);
+        i++;
+        if (i < tokens.size() && tokens[i].type == TokenType::AS) i++;
+        if (i < tokens.size() && isNameToken(tokens[i])) i++;
+        if (i >= tokens.size() || tokens[i].type != TokenType::COMMA) break;
+        i++;
+    }
+    return i;
+}
+
+// Estimativa do que o resultado ocupa (vetores, strings, nós da LRU)
+size_t resultBytes(const CacheKey& key, const CachedResult& result) {
+    size_t bytes = sizeof(CachedResult) + 2 * key.text.size() + 128;
+    for (const std::string& column : result.columns) bytes += sizeof(std::string) + column.capacity();
+    for (const std::string& table : key.tables) bytes += 2 * (sizeof(std::string) + table.size());
+    bytes += result.rows.capacity() * sizeof(Row);
+    for (const Row& row : result.rows) {
+        bytes += row.capacity() * sizeof(Value);
+        for (const Value& value : row) {
+            if (value.kind() == Value::Kind::TEXT) bytes += value.asText().capacity();
+        }
+    }
+    return bytes;
+}
+
+} // namespace
+
+// ============================================================================
+// CHAVES
+// ============================================================================
+
+CacheKey makeCacheKey(const std::vector<Token>& tokens) {
+    CacheKey key;
+    size_t end = tokens.size();
+    while (end > 0 && (tokens[end - 1].type == TokenType::END_OF_FILE ||
+                       tokens[end - 1].type == TokenType::SEMICOLON)) {
+        end--;
+    }
+    if (end == 0) return key;
+
+    // tipo | tamanho | lexeme normalizado, token a token (strings podem
+    // conter qualquer byte, então nada de separadores)
+    for (size_t i = 0; i < end; i++) {
+        const Token& token = tokens[i];
+        key.text += static_cast<char>(token.type);
+        std::string lexeme;
+        if (token.type == TokenType::IDENTIFIER) lexeme = lower(token.lexeme);
+        else if (token.type == TokenType::NUMBER || token.type == TokenType::STRING) lexeme = token.lexeme;
+        key.text += std::to_string(lexeme.size());
+        key.text += ':';
+        key.text += lexeme;
+
+        if (token.type == TokenType::FROM || token.type == TokenType::JOIN) {
+            collectTables(tokens, i + 1, key.tables);
+        }
+    }
+
+    key.cacheable = tokens[0].type == TokenType::SELECT;
+    return key;
+}
+
+std::string writtenTable(const std::vector<Token>& tokens) {
+    auto nameAt = [&](size_t i) { return i < tokens.size() && isNameToken(tokens[i]) ? lower(tokens[i].lexeme) : ""; };
+    auto typeAt = [&](size_t i) { return i < tokens.size() ? tokens[i].type : TokenType::END_OF_FILE; };
+
+    switch (typeAt(0)) {
+        case TokenType::INSERT: return typeAt(1) == TokenType::INTO ? nameAt(2) : "";
+        case TokenType::UPDATE: return nameAt(1);
+        case TokenType::DELETE: return typeAt(1) == TokenType::FROM ? nameAt(2) : "";
+        case TokenType::DROP:
+        case TokenType::CREATE:
+            if (typeAt(1) == TokenType::TABLE || typeAt(1) == TokenType::VIEW) return nameAt(2);
+            if (typeAt(1) == TokenType::MATERIALIZED && typeAt(2) == TokenType::VIEW) return nameAt(3);
+            return "";
+        default: return "";
+    }
+}
+
+// ============================================================================
+// CACHE
+// ============================================================================
+
+ResultCache::ResultCache(size_t capacity_bytes) : capacity_(capacity_bytes) {}
+
+std::shared_ptr<const CachedResult> ResultCache::lookup(const CacheKey& key, CacheTicket* ticket) {
+    if (!key.cacheable) return nullptr;
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (capacity_ == 0) return nullptr;
+
+    auto it = entries_.find(key.text);
+    if (it != entries_.end()) {
+        Entry& entry = it->second;
+        bool fresh = true;
+        for (size_t i = 0; fresh && i < entry.tables.size(); i++) {
+            fresh = versionLocked(entry.tables[i]) == entry.versions[i];
+        }
+        if (fresh) {
+            lru_.splice(lru_.begin(), lru_, entry.lru);
+            stats_.hits++;
+            metrics::increment(metrics::Counter::RESULT_CACHE_HITS);
+            return entry.result;
+        }
+        eraseLocked(it);
+        stats_.invalidations++;
+    }
+
+    stats_.misses++;
+    metrics::increment(metrics::Counter::RESULT_CACHE_MISSES);
+    if (ticket) {
+        ticket->versions.clear();
+        for (const std::string& table : key.tables) ticket->versions.push_back(versionLocked(table));
+    }
+    return nullptr;
+}
+
+void ResultCache::store(const CacheKey& key, const CacheTicket& ticket, CachedResult result) {
+    if (!key.cacheable) return;
+    size_t bytes = resultBytes(key, result);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (capacity_ == 0) return;
+
+    // Grande demais, ou alguma tabela mudou enquanto a consulta executava
+    bool stale = ticket.versions.size() != key.tables.size();
+    for (size_t i = 0; !stale && i < key.tables.size(); i++) stale = versionLocked(key.tables[i]) != ticket.versions[i];
+    if (stale || bytes > capacity_ / 4) {
+        stats_.rejected++;
+        return;
+    }
+
+    auto existing = entries_.find(key.text);
+    if (existing != entries_.end()) eraseLocked(existing);
+
+    lru_.push_front(key.text);
+    Entry& entry = entries_[key.text];
+    entry.result = std::make_shared<const CachedResult>(std::move(result));
+    entry.tables = key.tables;
+    entry.versions = ticket.versions;
+    entry.bytes = bytes;
+    entry.lru = lru_.begin();
+    for (const std::string& table : key.tables) by_table_[table].insert(key.text);
+
+    bytes_ += bytes;
+    stats_.stores++;
+    evictLocked();
+}
+
+void ResultCache::noteWrite(const std::string& table) {
+    std::string name = lower(table);
+    std::lock_guard<std::mutex> lock(mutex_);
+    noteWriteLocked(name);
+
+    auto views = table_views_.find(name);
+    if (views == table_views_.end()) return;
+    for (const std::string& view : views->second) noteWriteLocked(view);
+}
+
+void ResultCache::addView(const std::string& view, const std::string& table) {
+    std::string view_name = lower(view);
+    std::string table_name = lower(table);
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto previous = view_table_.find(view_name);
+    if (previous != view_table_.end()) table_views_[previous->second].erase(view_name);
+    view_table_[view_name] = table_name;
+    table_views_[table_name].insert(view_name);
+}
+
+void ResultCache::removeView(const std::string& view) {
+    std::string name = lower(view);
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = view_table_.find(name);
+    if (it == view_table_.end()) return;
+    auto views = table_views_.find(it->second);
+    if (views != table_views_.end()) {
+        views->second.erase(name);
+        if (views->second.empty()) table_views_.erase(views);
+    }
+    view_table_.erase(it);
+}
+
+void ResultCache::noteWriteLocked(const std::string& name) {
+    versions_[name]++;
+
+    auto readers = by_table_.find(name);
+    if (readers == by_table_.end()) return;
+    std::vector<std::string> keys(readers->second.begin(), readers->second.end());
+    for (const std::string& text : keys) {
+        auto it = entries_.find(text);
+        if (it == entries_.end()) continue;
+        eraseLocked(it);
+        stats_.invalidations++;
+    }
+}
+
+uint64_t ResultCache::tableVersion(const std::string& table) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return versionLocked(lower(table));
+}
+
+void ResultCache::setCapacity(size_t bytes) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    capacity_ = bytes;
+    evictLocked();
+}
+
+bool ResultCache::enabled() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return capacity_ > 0;
+}
+
+void ResultCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+    lru_.clear();
+    by_table_.clear();
+    bytes_ = 0;
+}
+
+void ResultCache::resetStats() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats_ = ResultCacheStats();
+}
+
+ResultCacheStats ResultCache::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ResultCacheStats stats = stats_;
+    stats.entries = entries_.size();
+    stats.bytes = bytes_;
+    stats.capacity = capacity_;
+    return stats;
+}
+
+uint64_t ResultCache::versionLocked(const std::string& table) const {
+    auto it = versions_.find(table);
+    return it == versions_.end() ? 0 : it->second;
+}
+
+void ResultCache::eraseLocked(std::unordered_map<std::string, Entry>::iterator it) {
+    for (const std::string& table : it->second.tables) {
+        auto readers = by_table_.find(table);
+        if (readers == by_table_.end()) continue;
+        readers->second.erase(it->first);
+        if (readers->second.empty()) by_table_.erase(readers);
+    }
+    bytes_ -= it->second.bytes;
+    lru_.erase(it->second.lru);
+    entries_.erase(it);
+}
+
+void ResultCache::evictLocked() {
+    while (bytes_ > capacity_ && !lru_.empty()) {
+        eraseLocked(entries_.find(lru_.back()));
+        stats_.evictions++;
+    }
+}
+
+// ============================================================================
+// INVALIDAÇÃO PELAS TABELAS EM MEMÓRIA
+// ============================================================================
+
+CacheInvalidator::CacheInvalidator(ResultCache& cache, storage::MemoryTable& table)
+    : cache_(cache), table_(table), table_name_(lower(table.schema().name)) {
+    table_.addObserver(this, false);
+}
+
+CacheInvalidator::~CacheInvalidator() {
+    table_.removeObserver(this);
+}
+
+} // namespace executor
+} // namespace miniql
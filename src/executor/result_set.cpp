@@ -0,0 +1,19 @@
+#include "executor/result_set.h"
+#include <algorithm>
+
+namespace miniql {
+namespace executor {
+
+bool VectorCursor::nextBatch(std::vector<Row>& batch, size_t max_rows) {
+    batch.clear();
+    if (position_ >= rows_.size()) return false;
+
+    size_t end = std::min(rows_.size(), position_ + std::max<size_t>(max_rows, 1));
+    batch.assign(std::make_move_iterator(rows_.begin() + position_),
+                 std::make_move_iterator(rows_.begin() + end));
+    position_ = end;
+    return true;
+}
+
+} // namespace executor
+} // namespace miniql
@@ -0,0 +1,95 @@
+#include "executor/table_scan.h"
+#include <iomanip>
+#include <sstream>
+
+namespace miniql {
+namespace executor {
+
+using namespace ast;
+
+namespace {
+
+void collectRanges(const Expression* expr, std::vector<storage::ColumnRange>& out) {
+    if (!expr || expr->getType() != ExprType::BINARY) return;
+    const auto* binary = static_cast<const BinaryExpr*>(expr);
+
+    if (binary->op == BinaryOp::AND) {
+        collectRanges(binary->left.get(), out);
+        collectRanges(binary->right.get(), out);
+        return;
+    }
+    if (!isComparison(binary->op) || binary->op == BinaryOp::NE) return;
+
+    // Normaliza para "coluna op literal"
+    const Expression* left = binary->left.get();
+    const Expression* right = binary->right.get();
+    BinaryOp op = binary->op;
+    if (left->getType() == ExprType::LITERAL && right->getType() == ExprType::COLUMN) {
+        std::swap(left, right);
+        op = flipComparison(op);
+    }
+    if (left->getType() != ExprType::COLUMN || right->getType() != ExprType::LITERAL) return;
+
+    int column = static_cast<const ColumnExpr*>(left)->column_index;
+    const Value& value = static_cast<const LiteralExpr*>(right)->value;
+    if (column < 0 || !value.isNumeric()) return;
+
+    storage::ColumnRange range;
+    range.column = static_cast<size_t>(column);
+    switch (op) {
+        case BinaryOp::EQ: range.low = range.high = value; break;
+        case BinaryOp::LT: range.high = value; range.high_inclusive = false; break;
+        case BinaryOp::LE: range.high = value; break;
+        case BinaryOp::GT: range.low = value; range.low_inclusive = false; break;
+        case BinaryOp::GE: range.low = value; break;
+        default: return;
+    }
+    out.push_back(range);
+}
+
+std::string describeRange(const storage::ColumnRange& range, const catalog::TableSchema& schema) {
+    const std::string& name = schema.columns[range.column].name;
+    if (!range.low.isNull() && !range.high.isNull() && range.low == range.high) {
+        return name + " = " + range.low.toString();
+    }
+    std::string text;
+    if (!range.low.isNull()) text = name + (range.low_inclusive ? " >= " : " > ") + range.low.toString();
+    if (!range.high.isNull()) {
+        if (!text.empty()) text += " AND ";
+        text += name + (range.high_inclusive ? " <= " : " < ") + range.high.toString();
+    }
+    return text;
+}
+
+} // namespace
+
+std::vector<storage::ColumnRange> extractColumnRanges(const Expression* predicate) {
+    std::vector<storage::ColumnRange> ranges;
+    collectRanges(predicate, ranges);
+    return ranges;
+}
+
+std::string explainAnalyze(const storage::MemoryTable& table, const Expression* predicate, const ScanStats& stats) {
+    const catalog::TableSchema& schema = table.schema();
+    std::ostringstream out;
+    out << "Seq Scan on " << schema.name << "  (actual rows=" << stats.rows_matched << " time=" << std::fixed
+        << std::setprecision(3) << stats.seconds * 1000.0 << " ms)\n";
+    if (predicate) out << "  Filter: " << compilePredicate(predicate, schema).describe() << "\n";
+
+    std::string zone_terms;
+    for (const auto& range : extractColumnRanges(predicate)) {
+        if (!isNumericType(schema.columns[range.column].type)) continue;    // sem zone map
+        if (!zone_terms.empty()) zone_terms += " AND ";
+        zone_terms += describeRange(range, schema);
+    }
+    out << "  Zone map: " << (zone_terms.empty() ? "not applicable" : zone_terms) << "\n";
+
+    const storage::ZoneScanStats& zone = stats.zone;
+    out << "  Blocks: " << zone.blocks << " total, " << zone.blocks_skipped << " skipped by zone map, "
+        << zone.blocks - zone.blocks_skipped << " read\n";
+    out << "  Rows examined: " << zone.rows << "\n";
+    return out.str();
+}
+
+} // namespace executor
+} // namespace miniql
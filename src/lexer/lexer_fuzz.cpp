@@ -0,0 +1,62 @@
+#include "lexer/reference_scanner.h"
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+
+// ALVO DE FUZZING DO LEXER
+// Entrada arbitrária (bytes quaisquer, inclusive NUL e não-ASCII) vai para
+// o Scanner e para o lexer de referência; qualquer divergência de tokens,
+// posições ou erros aborta, e o fuzzer guarda a entrada como crash.
+//
+// libFuzzer:  clang++ -DMINIQL_LIBFUZZER -fsanitize=fuzzer,address,undefined
+//             (make lexer-fuzz)
+// AFL / replay: compilado sem MINIQL_LIBFUZZER ganha um main que lê cada
+//             arquivo passado na linha de comando, ou stdin se não houver
+//             nenhum (afl-fuzz -i corpus -o out -- ./lexer_fuzz)
+
+using namespace miniql::lexer;
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+    std::string source(reinterpret_cast<const char*>(data), size);
+    std::string diff = diffAgainstReference(source);
+    if (!diff.empty()) {
+        std::fprintf(stderr, "lexer divergence: %s\n", diff.c_str());
+        std::abort();
+    }
+    return 0;
+}
+
+#ifndef MINIQL_LIBFUZZER
+
+namespace {
+
+int runInput(const std::string& input) {
+    return LLVMFuzzerTestOneInput(reinterpret_cast<const uint8_t*>(input.data()), input.size());
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::string input((std::istreambuf_iterator<char>(std::cin)), std::istreambuf_iterator<char>());
+        return runInput(input);
+    }
+
+    for (int i = 1; i < argc; i++) {
+        std::ifstream file(argv[i], std::ios::binary);
+        if (!file) {
+            std::cerr << "Cannot open " << argv[i] << "\n";
+            return 1;
+        }
+        std::string input((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        runInput(input);
+    }
+    std::cout << "Replayed " << (argc - 1) << " inputs without divergence\n";
+    return 0;
+}
+
+#endif // MINIQL_LIBFUZZER
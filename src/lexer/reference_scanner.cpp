@@ -0,0 +1,254 @@
+#include "lexer/reference_scanner.h"
+#include <algorithm>
+#include <sstream>
+
+namespace miniql {
+namespace lexer {
+
+namespace {
+
+struct Keyword {
+    const char* text;
+    TokenType type;
+};
+
+const Keyword KEYWORDS[] = {
+    {"SELECT", TokenType::SELECT}, {"INSERT", TokenType::INSERT}, {"UPDATE", TokenType::UPDATE},
+    {"DELETE", TokenType::DELETE}, {"CREATE", TokenType::CREATE}, {"DROP", TokenType::DROP},
+    {"TABLE", TokenType::TABLE}, {"ANALYZE", TokenType::ANALYZE}, {"ENGINE", TokenType::ENGINE},
+    {"MATERIALIZED", TokenType::MATERIALIZED}, {"VIEW", TokenType::VIEW},
+    {"FROM", TokenType::FROM}, {"WHERE", TokenType::WHERE}, {"INTO", TokenType::INTO},
+    {"VALUES", TokenType::VALUES}, {"AND", TokenType::AND}, {"OR", TokenType::OR},
+    {"NOT", TokenType::NOT}, {"JOIN", TokenType::JOIN}, {"LEFT", TokenType::LEFT},
+    {"RIGHT", TokenType::RIGHT}, {"INNER", TokenType::INNER}, {"OUTER", TokenType::OUTER},
+    {"ON", TokenType::ON}, {"ORDER", TokenType::ORDER}, {"BY", TokenType::BY},
+    {"GROUP", TokenType::GROUP}, {"HAVING", TokenType::HAVING}, {"ASC", TokenType::ASC},
+    {"DESC", TokenType::DESC}, {"LIMIT", TokenType::LIMIT}, {"OFFSET", TokenType::OFFSET},
+    {"PRIMARY", TokenType::PRIMARY}, {"KEY", TokenType::KEY}, {"FOREIGN", TokenType::FOREIGN},
+    {"REFERENCES", TokenType::REFERENCES}, {"UNIQUE", TokenType::UNIQUE}, {"INDEX", TokenType::INDEX},
+    {"NULL", TokenType::NULL_KW}, {"INT", TokenType::INT}, {"TEXT", TokenType::TEXT},
+    {"REAL", TokenType::REAL}, {"BLOB", TokenType::BLOB}, {"DATE", TokenType::DATE},
+    {"TIMESTAMP", TokenType::TIMESTAMP}, {"AS", TokenType::AS},
+};
+
+bool digit(char c) { return c >= '0' && c <= '9'; }
+bool letter(char c) { return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_'; }
+
+// Comparação case-insensitive só com ASCII, caractere a caractere
+TokenType classifyWord(const std::string& word) {
+    for (const Keyword& keyword : KEYWORDS) {
+        size_t i = 0;
+        for (; keyword.text[i] && i < word.size(); i++) {
+            char c = word[i];
+            if (c >= 'a' && c <= 'z') c = static_cast<char>(c - 'a' + 'A');
+            if (c != keyword.text[i]) break;
+        }
+        if (keyword.text[i] == '\0' && i == word.size()) return keyword.type;
+    }
+    return TokenType::IDENTIFIER;
+}
+
+class Cursor {
+public:
+    explicit Cursor(const std::string& text) : text_(text) {}
+
+    bool done() const { return pos_ >= text_.size(); }
+    char at(size_t ahead = 0) const { return pos_ + ahead < text_.size() ? text_[pos_ + ahead] : '\0'; }
+    size_t pos() const { return pos_; }
+
+    char take() {
+        char c = text_[pos_++];
+        column_++;
+        if (c == '\n') {
+            line_++;
+            column_ = 0;
+        }
+        return c;
+    }
+
+    Token token(TokenType type, std::string lexeme) const { return Token(type, std::move(lexeme), line_, column_); }
+
+    std::string error(const std::string& message) const {
+        return "[Line " + std::to_string(line_) + ", Col " + std::to_string(column_) + "] " + message;
+    }
+
+private:
+    const std::string& text_;
+    size_t pos_ = 0;
+    int line_ = 1;
+    int column_ = 0;
+};
+
+} // namespace
+
+std::vector<Token> referenceScan(const std::string& source, std::vector<std::string>& errors) {
+    std::vector<Token> tokens;
+    errors.clear();
+    Cursor in(source);
+
+    while (!in.done()) {
+        size_t start = in.pos();
+        char c = in.take();
+        auto lexeme = [&] { return source.substr(start, in.pos() - start); };
+
+        if (c == ' ' || c == '\t' || c == '\r' || c == '\n') continue;
+
+        if (c == '-' && in.at() == '-') {
+            while (!in.done() && in.at() != '\n') in.take();
+            continue;
+        }
+        if (c == '/' && in.at() == '*') {
+            in.take();
+            bool closed = false;
+            while (!in.done()) {
+                if (in.at() == '*' && in.at(1) == '/') {
+                    in.take();
+                    in.take();
+                    closed = true;
+                    break;
+                }
+                in.take();
+            }
+            if (!closed) errors.push_back(in.error("Unterminated block comment"));
+            continue;
+        }
+
+        if (c == '\'' || c == '"') {
+            std::string value;
+            while (!in.done() && in.at() != c) {
+                if (in.at() == '\\' && in.at(1) == c) in.take();
+                value += in.take();
+            }
+            if (in.done()) {
+                errors.push_back(in.error("Unterminated string literal"));
+                continue;
+            }
+            in.take();
+            tokens.push_back(in.token(TokenType::STRING, value));
+            continue;
+        }
+
+        if (digit(c)) {
+            while (digit(in.at())) in.take();
+            if (in.at() == '.' && digit(in.at(1))) {
+                in.take();
+                while (digit(in.at())) in.take();
+            }
+            Token token = in.token(TokenType::NUMBER, lexeme());
+            try {
+                token.number_value = std::stod(token.lexeme);
+            } catch (const std::exception&) {
+                errors.push_back(in.error("Invalid number format: " + token.lexeme));
+                token.number_value = 0.0;
+            }
+            tokens.push_back(token);
+            continue;
+        }
+
+        if (letter(c)) {
+            while (letter(in.at()) || digit(in.at())) in.take();
+            std::string word = lexeme();
+            tokens.push_back(in.token(classifyWord(word), word));
+            continue;
+        }
+
+        TokenType type = TokenType::UNKNOWN;
+        switch (c) {
+            case '(': type = TokenType::LPAREN; break;
+            case ')': type = TokenType::RPAREN; break;
+            case ',': type = TokenType::COMMA; break;
+            case ';': type = TokenType::SEMICOLON; break;
+            case '.': type = TokenType::DOT; break;
+            case '+': type = TokenType::PLUS; break;
+            case '-': type = TokenType::MINUS; break;
+            case '*': type = TokenType::STAR; break;
+            case '/': type = TokenType::SLASH; break;
+            case '%': type = TokenType::PERCENT; break;
+            case '=': type = TokenType::EQUAL; break;
+            case '<':
+                if (in.at() == '=') {
+                    in.take();
+                    type = TokenType::LESS_EQUAL;
+                } else if (in.at() == '>') {
+                    in.take();
+                    type = TokenType::NOT_EQUAL;
+                } else {
+                    type = TokenType::LESS_THAN;
+                }
+                break;
+            case '>':
+                if (in.at() == '=') {
+                    in.take();
+                    type = TokenType::GREATER_EQUAL;
+                } else {
+                    type = TokenType::GREATER_THAN;
+                }
+                break;
+            case '!':
+                if (in.at() == '=') {
+                    in.take();
+                    type = TokenType::NOT_EQUAL;
+                } else {
+                    errors.push_back(in.error("Unexpected character '!'"));
+                    continue;
+                }
+                break;
+            default:
+                errors.push_back(in.error(std::string("Unexpected character: '") + c + "'"));
+                continue;
+        }
+        tokens.push_back(in.token(type, lexeme()));
+    }
+
+    tokens.push_back(in.token(TokenType::END_OF_FILE, ""));
+    return tokens;
+}
+
+std::string diffAgainstReference(const std::string& source) {
+    Scanner scanner(source);
+    std::vector<Token> actual = scanner.scanTokens();
+    const std::vector<std::string>& actual_errors = scanner.getErrors();
+
+    std::vector<std::string> expected_errors;
+    std::vector<Token> expected = referenceScan(source, expected_errors);
+
+    auto describe = [](const Token& token) {
+        std::ostringstream ss;
+        ss << tokenTypeToString(token.type) << " '" << token.lexeme << "' at " << token.line << ":" << token.column;
+        if (token.type == TokenType::NUMBER) ss << " value " << token.number_value;
+        return ss.str();
+    };
+
+    std::ostringstream diff;
+    size_t common = std::min(actual.size(), expected.size());
+    for (size_t i = 0; i < common; i++) {
+        const Token& a = actual[i];
+        const Token& e = expected[i];
+        bool same = a.type == e.type && a.lexeme == e.lexeme && a.line == e.line && a.column == e.column &&
+                    (a.type != TokenType::NUMBER || a.number_value == e.number_value);
+        if (!same) {
+            diff << "token " << i << ": scanner " << describe(a) << ", reference " << describe(e);
+            return diff.str();
+        }
+    }
+    if (actual.size() != expected.size()) {
+        diff << "token count: scanner " << actual.size() << ", reference " << expected.size();
+        return diff.str();
+    }
+
+    for (size_t i = 0; i < std::min(actual_errors.size(), expected_errors.size()); i++) {
+        if (actual_errors[i] != expected_errors[i]) {
+            diff << "error " << i << ": scanner \"" << actual_errors[i] << "\", reference \"" << expected_errors[i]
+                 << "\"";
+            return diff.str();
+        }
+    }
+    if (actual_errors.size() != expected_errors.size()) {
+        diff << "error count: scanner " << actual_errors.size() << ", reference " << expected_errors.size();
+        return diff.str();
+    }
+    return "";
+}
+
+} // namespace lexer
+} // namespace miniql
@@ -13,6 +13,12 @@ std::unordered_map<std::string, TokenType> Scanner::keywords_ = {
     {"CREATE", TokenType::CREATE},
     {"DROP", TokenType::DROP},
     {"TABLE", TokenType::TABLE},
+
+    // Não reservadas (isNonReservedKeyword)
+    {"ANALYZE", TokenType::ANALYZE},
+    {"ENGINE", TokenType::ENGINE},
+    {"MATERIALIZED", TokenType::MATERIALIZED},
+    {"VIEW", TokenType::VIEW},
     
     // Cláusulas
     {"FROM", TokenType::FROM},
@@ -99,12 +105,12 @@ void Scanner::scanToken() {
         case '=': addToken(TokenType::EQUAL); break;
         
         case '-':
-            if (match('-')) scanComment();
+            if (match('-')) scanComment('-');
             else addToken(TokenType::MINUS);
             break;
         
         case '/':
-            if (match('*')) scanComment();
+            if (match('*')) scanComment('/');
             else addToken(TokenType::SLASH);
             break;
         
@@ -210,6 +216,18 @@ std::string Token::typeToString() const {
     return tokenTypeToString(type);
 }
 
+bool isNonReservedKeyword(TokenType type) {
+    switch (type) {
+        case TokenType::ANALYZE:
+        case TokenType::ENGINE:
+        case TokenType::MATERIALIZED:
+        case TokenType::VIEW:
+            return true;
+        default:
+            return false;
+    }
+}
+
 std::string tokenTypeToString(TokenType type) {
     switch (type) {
         // Comandos DML
@@ -222,6 +240,10 @@ std::string tokenTypeToString(TokenType type) {
         case TokenType::CREATE: return "CREATE";
         case TokenType::DROP: return "DROP";
         case TokenType::TABLE: return "TABLE";
+        case TokenType::ANALYZE: return "ANALYZE";
+        case TokenType::ENGINE: return "ENGINE";
+        case TokenType::MATERIALIZED: return "MATERIALIZED";
+        case TokenType::VIEW: return "VIEW";
         
         // Cláusulas
         case TokenType::FROM: return "FROM";
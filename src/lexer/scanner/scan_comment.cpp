@@ -14,50 +14,41 @@ namespace lexer {
 // - Linha:  '--' [^\n]*
 // - Bloco:  '/*' .* '*/'
 // 
+// scanToken() já consumiu os dois caracteres de abertura ('--' ou '/*');
+// opener diz qual dos dois foi ('-' ou '/').
+//
 // Algoritmo para linha única:
-// 1. Já consumimos '--'
-// 2. Consome até '\n' ou EOF
-// 3. Não adiciona token (comentários são ignorados)
+// 1. Consome até '\n' ou EOF (o '\n' fica para o scanToken)
+// 2. Não adiciona token (comentários são ignorados)
 // 
 // Algoritmo para bloco:
-// 1. Já consumimos '/*'
-// 2. Consome até encontrar '*/'
-// 3. Suporta multi-linha
-// 4. Detecta comentários não fechados (erro)
+// 1. Consome até encontrar '*/'
+// 2. Suporta multi-linha (linha/coluna avançam como fora do comentário)
+// 3. Detecta comentários não fechados (erro)
 
-void Scanner::scanComment() {
-    if (peek() == '-' && peekNext() == '-') {
-        advance();
-        advance();
-        
+void Scanner::scanComment(char opener) {
+    if (opener == '-') {
         while (!isAtEnd() && peek() != '\n') {
             advance();
         }
         return;
     }
     
-    if (peek() == '/' && peekNext() == '*') {
-        advance();
-        advance();
-        
-        while (!isAtEnd()) {
-            if (peek() == '*' && peekNext() == '/') {
-                advance();
-                advance();
-                return;
-            }
-            
-            if (peek() == '\n') {
-                line_++;
-                column_ = 0;
-            }
-            
+    while (!isAtEnd()) {
+        if (peek() == '*' && peekNext() == '/') {
+            advance();
             advance();
+            return;
         }
         
-        // Se chegou aqui, comentário não foi fechado
-        addError("Unterminated block comment");
+        if (advance() == '\n') {
+            line_++;
+            column_ = 0;
+        }
     }
+    
+    // Se chegou aqui, comentário não foi fechado
+    addError("Unterminated block comment");
 }
 
 } // namespace lexer
@@ -22,18 +22,20 @@ void Scanner::scanString(char quote) {
     std::string value;
     
     while (!isAtEnd() && peek() != quote) {
-        // Suporte para strings multi-linha
-        if (peek() == '\n') {
-            line_++;
-            column_ = 0;
-        }
-        
         // Suporte para escape sequences
         if (peek() == '\\' && peekNext() == quote) {
             advance();
             value += advance();
-        } else {
-            value += advance();
+            continue;
+        }
+        
+        // Suporte para strings multi-linha: depois do '\n' a contagem de
+        // colunas recomeça, como fora da string
+        char c = advance();
+        value += c;
+        if (c == '\n') {
+            line_++;
+            column_ = 0;
         }
     }
     
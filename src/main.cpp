@@ -1,8 +1,88 @@
 #include "shell/repl.h"
+#include "storage/startup_profile.h"
+#include <cstdlib>
+#include <iomanip>
 #include <iostream>
+#include <string>
 
-int main() {
+namespace {
+
+void printUsage() {
+    std::cerr << "Usage: miniql\n"
+              << "       miniql --bench-open <dir> [--warm]\n"
+              << "       miniql --generate-db <dir> [--tables N] [--rows N] [--pages N] [--wal-ops N] [--seed N]\n";
+}
+
+bool parseCount(const std::string& text, uint64_t& value) {
+    if (text.empty() || text.find_first_not_of("0123456789") != std::string::npos) return false;
+    char* end = nullptr;
+    value = std::strtoull(text.c_str(), &end, 10);
+    return *end == '\0';
+}
+
+// miniql --bench-open <dir> [--warm]
+int benchOpen(int argc, char** argv) {
+    if (argc < 3) {
+        printUsage();
+        return 1;
+    }
+    bool cold = true;
+    for (int i = 3; i < argc; i++) {
+        if (std::string(argv[i]) != "--warm") {
+            printUsage();
+            return 1;
+        }
+        cold = false;
+    }
+    miniql::storage::printOpenProfile(std::cout, miniql::storage::profileOpen(argv[2], cold));
+    return 0;
+}
+
+// miniql --generate-db <dir> [--tables N] [--rows N] [--pages N] [--wal-ops N] [--seed N]
+int generateDb(int argc, char** argv) {
+    if (argc < 3) {
+        printUsage();
+        return 1;
+    }
+    miniql::storage::SyntheticDbSpec spec;
+    for (int i = 3; i < argc; i += 2) {
+        std::string option = argv[i];
+        uint64_t value = 0;
+        if (i + 1 >= argc || !parseCount(argv[i + 1], value)) {
+            printUsage();
+            return 1;
+        }
+        if (option == "--tables") spec.tables = value;
+        else if (option == "--rows") spec.rows = value;
+        else if (option == "--pages") spec.pages = value;
+        else if (option == "--wal-ops") spec.wal_tail_ops = value;
+        else if (option == "--seed") spec.seed = value;
+        else {
+            printUsage();
+            return 1;
+        }
+    }
+
+    miniql::storage::SyntheticDbInfo info = miniql::storage::generateSyntheticDatabase(argv[2], spec);
+    std::cout << "Generated " << argv[2] << ": " << info.tables << " memory tables, " << info.rows << " rows, "
+              << info.pages << " data pages (" << std::fixed << std::setprecision(1)
+              << info.data_bytes / (1024.0 * 1024.0) << " MB data, " << info.wal_bytes / (1024.0 * 1024.0)
+              << " MB WAL) in " << info.seconds << " s\n";
+    return 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
     try {
+        if (argc > 1) {
+            std::string mode = argv[1];
+            if (mode == "--bench-open") return benchOpen(argc, argv);
+            if (mode == "--generate-db") return generateDb(argc, argv);
+            printUsage();
+            return 1;
+        }
+
         miniql::REPL repl;
         repl.run();
         return 0;
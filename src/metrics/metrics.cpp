@@ -0,0 +1,499 @@
+#include "metrics/metrics.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <sstream>
+
+namespace miniql {
+namespace metrics {
+
+namespace {
+
+// ============================================================================
+// SHARDS POR THREAD
+// ============================================================================
+// Cada thread tem seu próprio shard e é a única que escreve nele. Por isso
+// o incremento é load + store relaxed (sem lock prefix); os atomics existem
+// apenas para que a leitura concorrente do snapshot não seja data race.
+
+inline void bump(std::atomic<uint64_t>& cell, uint64_t n) {
+    cell.store(cell.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+}
+
+inline uint64_t load(const std::atomic<uint64_t>& cell) {
+    return cell.load(std::memory_order_relaxed);
+}
+
+struct HistogramShard {
+    std::atomic<uint64_t> count{0};
+    std::atomic<uint64_t> sum{0};
+    std::atomic<uint64_t> min{std::numeric_limits<uint64_t>::max()};
+    std::atomic<uint64_t> max{0};
+    std::array<std::atomic<uint64_t>, HISTOGRAM_BUCKETS> buckets{};
+
+    void record(uint64_t value, uint64_t weight) {
+        bump(count, weight);
+        bump(sum, value * weight);
+        if (value < load(min)) min.store(value, std::memory_order_relaxed);
+        if (value > load(max)) max.store(value, std::memory_order_relaxed);
+        bump(buckets[bucketIndex(value)], weight);
+    }
+
+    void clear() {
+        count.store(0, std::memory_order_relaxed);
+        sum.store(0, std::memory_order_relaxed);
+        min.store(std::numeric_limits<uint64_t>::max(), std::memory_order_relaxed);
+        max.store(0, std::memory_order_relaxed);
+        for (auto& bucket : buckets) bucket.store(0, std::memory_order_relaxed);
+    }
+};
+
+struct ThreadShard {
+    std::array<std::atomic<uint64_t>, COUNTER_COUNT> counters{};
+    std::array<HistogramShard, HISTOGRAM_COUNT> histograms;
+
+    void clear() {
+        for (auto& counter : counters) counter.store(0, std::memory_order_relaxed);
+        for (auto& histogram : histograms) histogram.clear();
+    }
+};
+
+std::atomic<bool> g_enabled{true};
+
+// Contador de alocações: atomic trivial (inicialização constante) para
+// poder ser usado dentro de operator new sem risco de recursão.
+thread_local std::atomic<uint64_t> tl_allocations{0};
+
+// A thread já registrou (ou está registrando) seu shard. Sem isso, as
+// alocações de uma thread que nunca incrementa um contador ficariam fora
+// do snapshot; operator new registra o shard na primeira alocação contada.
+thread_local bool tl_registered = false;
+
+struct Registry {
+    std::mutex mutex;
+    std::vector<std::pair<ThreadShard*, std::atomic<uint64_t>*>> live;
+    std::unique_ptr<ThreadShard> retired{new ThreadShard()};  // threads já encerradas
+    uint64_t retired_allocations = 0;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+};
+
+// Nunca destruído: threads podem terminar depois dos destrutores estáticos
+Registry& registry() {
+    static Registry* instance = new Registry();
+    return *instance;
+}
+
+// Cria o registry na inicialização do programa para o uptime contar desde o início
+const bool registry_ready = (registry(), true);
+
+void mergeInto(HistogramSnapshot& dst, const HistogramShard& src) {
+    uint64_t count = load(src.count);
+    if (count == 0) return;
+    uint64_t src_min = load(src.min);
+    uint64_t src_max = load(src.max);
+    dst.min = dst.count == 0 ? src_min : std::min(dst.min, src_min);
+    dst.max = std::max(dst.max, src_max);
+    dst.count += count;
+    dst.sum += load(src.sum);
+    for (size_t i = 0; i < HISTOGRAM_BUCKETS; i++) {
+        dst.buckets[i] += load(src.buckets[i]);
+    }
+}
+
+void mergeInto(Snapshot& dst, const ThreadShard& src) {
+    for (size_t i = 0; i < COUNTER_COUNT; i++) {
+        dst.counters[i] += load(src.counters[i]);
+    }
+    for (size_t i = 0; i < HISTOGRAM_COUNT; i++) {
+        mergeInto(dst.histograms[i], src.histograms[i]);
+    }
+}
+
+void mergeInto(ThreadShard& dst, const ThreadShard& src) {
+    for (size_t i = 0; i < COUNTER_COUNT; i++) {
+        bump(dst.counters[i], load(src.counters[i]));
+    }
+    for (size_t i = 0; i < HISTOGRAM_COUNT; i++) {
+        const HistogramShard& from = src.histograms[i];
+        HistogramShard& to = dst.histograms[i];
+        if (load(from.count) == 0) continue;
+        bump(to.count, load(from.count));
+        bump(to.sum, load(from.sum));
+        if (load(from.min) < load(to.min)) to.min.store(load(from.min), std::memory_order_relaxed);
+        if (load(from.max) > load(to.max)) to.max.store(load(from.max), std::memory_order_relaxed);
+        for (size_t b = 0; b < HISTOGRAM_BUCKETS; b++) {
+            bump(to.buckets[b], load(from.buckets[b]));
+        }
+    }
+}
+
+// Registra o shard na criação da thread e devolve os totais ao registry
+// quando a thread termina
+struct ShardHandle {
+    ThreadShard* shard;
+
+    // tl_registered vem antes do new: as alocações do próprio registro não
+    // podem voltar a chamar localShard()
+    ShardHandle() : shard((tl_registered = true, new ThreadShard())) {
+        Registry& reg = registry();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        reg.live.emplace_back(shard, &tl_allocations);
+    }
+
+    ~ShardHandle() {
+        Registry& reg = registry();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        mergeInto(*reg.retired, *shard);
+        reg.retired_allocations += load(tl_allocations);
+        reg.live.erase(std::remove_if(reg.live.begin(), reg.live.end(),
+                                      [this](const auto& entry) { return entry.first == shard; }),
+                       reg.live.end());
+        delete shard;
+    }
+};
+
+ThreadShard& localShard() {
+    thread_local ShardHandle handle;
+    return *handle.shard;
+}
+
+// Formata nanossegundos com a unidade mais legível
+std::string formatDuration(uint64_t nanos) {
+    std::ostringstream ss;
+    ss << std::fixed << std::setprecision(1);
+    if (nanos < 1000) ss << nanos << "ns";
+    else if (nanos < 1000000) ss << nanos / 1e3 << "us";
+    else if (nanos < 1000000000) ss << nanos / 1e6 << "ms";
+    else ss << nanos / 1e9 << "s";
+    return ss.str();
+}
+
+void printHistogramLine(std::ostream& out, const char* label, const HistogramSnapshot& h) {
+    out << "  " << std::left << std::setw(20) << label;
+    if (h.count == 0) {
+        out << "no samples\n";
+        return;
+    }
+    out << "count=" << h.count
+        << " mean=" << formatDuration(static_cast<uint64_t>(h.mean()))
+        << " p50=" << formatDuration(h.percentile(0.50))
+        << " p99=" << formatDuration(h.percentile(0.99))
+        << " max=" << formatDuration(h.max) << "\n";
+}
+
+struct StatementMetric {
+    Counter counter;
+    const char* label;
+};
+
+const StatementMetric STATEMENT_METRICS[] = {
+    {Counter::STMT_SELECT, "select"},
+    {Counter::STMT_INSERT, "insert"},
+    {Counter::STMT_UPDATE, "update"},
+    {Counter::STMT_DELETE, "delete"},
+    {Counter::STMT_CREATE, "create"},
+    {Counter::STMT_DROP, "drop"},
+    {Counter::STMT_OTHER, "other"},
+};
+
+} // namespace
+
+// ============================================================================
+// HISTOGRAMA LOG-LINEAR
+// ============================================================================
+// Valores < 16 têm bucket próprio. Acima disso, cada potência de 2 é
+// dividida em 16 sub-buckets: o índice é formado pelo expoente e pelos
+// 4 bits seguintes ao bit mais significativo.
+
+size_t bucketIndex(uint64_t value) {
+    if (value < HISTOGRAM_SUB_COUNT) return static_cast<size_t>(value);
+#if defined(__GNUC__) || defined(__clang__)
+    unsigned msb = 63 - static_cast<unsigned>(__builtin_clzll(value));
+#else
+    unsigned msb = 0;
+    for (uint64_t v = value; v >>= 1;) msb++;
+#endif
+    unsigned shift = msb - HISTOGRAM_SUB_BITS;
+    return (shift + 1) * HISTOGRAM_SUB_COUNT +
+           static_cast<size_t>((value >> shift) & (HISTOGRAM_SUB_COUNT - 1));
+}
+
+uint64_t bucketLowerBound(size_t index) {
+    if (index < HISTOGRAM_SUB_COUNT) return index;
+    unsigned shift = static_cast<unsigned>(index / HISTOGRAM_SUB_COUNT) - 1;
+    return (HISTOGRAM_SUB_COUNT + index % HISTOGRAM_SUB_COUNT) << shift;
+}
+
+uint64_t HistogramSnapshot::percentile(double p) const {
+    if (count == 0) return 0;
+    p = std::min(std::max(p, 0.0), 1.0);
+    uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(p * double(count) + 0.5));
+
+    uint64_t seen = 0;
+    for (size_t i = 0; i < HISTOGRAM_BUCKETS; i++) {
+        seen += buckets[i];
+        if (seen >= rank) {
+            uint64_t lower = bucketLowerBound(i);
+            uint64_t upper = i + 1 < HISTOGRAM_BUCKETS
+                ? bucketLowerBound(i + 1) - 1
+                : std::numeric_limits<uint64_t>::max();
+            uint64_t mid = lower + (upper - lower) / 2;
+            return std::min(std::max(mid, min), max);
+        }
+    }
+    return max;
+}
+
+// ============================================================================
+// REGISTRO E AGREGAÇÃO
+// ============================================================================
+
+void increment(Counter counter, uint64_t n) {
+    if (!g_enabled.load(std::memory_order_relaxed)) return;
+    bump(localShard().counters[static_cast<size_t>(counter)], n);
+}
+
+void record(Histogram histogram, uint64_t nanos, uint64_t weight) {
+    if (!g_enabled.load(std::memory_order_relaxed)) return;
+    localShard().histograms[static_cast<size_t>(histogram)].record(nanos, weight);
+}
+
+void setEnabled(bool enabled) {
+    g_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool enabled() {
+    return g_enabled.load(std::memory_order_relaxed);
+}
+
+Snapshot snapshot() {
+    Snapshot snap;
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+
+    mergeInto(snap, *reg.retired);
+    uint64_t allocations = reg.retired_allocations;
+    for (const auto& entry : reg.live) {
+        mergeInto(snap, *entry.first);
+        allocations += load(*entry.second);
+    }
+    snap.counters[static_cast<size_t>(Counter::ALLOCATIONS)] += allocations;
+
+    snap.uptime_seconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - reg.start).count();
+    return snap;
+}
+
+// Zera os shards no lugar; um incremento concorrente de outra thread
+// pode se perder, o que é aceitável para estatísticas
+void reset() {
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    reg.retired->clear();
+    reg.retired_allocations = 0;
+    for (const auto& entry : reg.live) {
+        entry.first->clear();
+        entry.second->store(0, std::memory_order_relaxed);
+    }
+    reg.start = std::chrono::steady_clock::now();
+}
+
+// ============================================================================
+// SAÍDA
+// ============================================================================
+
+const char* counterName(Counter counter) {
+    switch (counter) {
+        case Counter::STMT_SELECT: return "select";
+        case Counter::STMT_INSERT: return "insert";
+        case Counter::STMT_UPDATE: return "update";
+        case Counter::STMT_DELETE: return "delete";
+        case Counter::STMT_CREATE: return "create";
+        case Counter::STMT_DROP: return "drop";
+        case Counter::STMT_OTHER: return "other";
+        case Counter::TOKENS_SCANNED: return "tokens_scanned";
+        case Counter::LEX_ERRORS: return "lex_errors";
+        case Counter::BUFFER_POOL_HITS: return "buffer_pool_hits";
+        case Counter::BUFFER_POOL_MISSES: return "buffer_pool_misses";
+        case Counter::PAGES_PREFETCHED: return "pages_prefetched";
+        case Counter::PAGES_WRITTEN: return "pages_written";
+        case Counter::ZONE_BLOCKS_SKIPPED: return "zone_blocks_skipped";
+        case Counter::RESULT_CACHE_HITS: return "result_cache_hits";
+        case Counter::RESULT_CACHE_MISSES: return "result_cache_misses";
+        case Counter::ALLOCATIONS: return "allocations";
+        default: return "unknown";
+    }
+}
+
+const char* histogramName(Histogram histogram) {
+    switch (histogram) {
+        case Histogram::LEX_LATENCY: return "lex_latency";
+        case Histogram::WAL_FSYNC_LATENCY: return "wal_fsync_latency";
+        default: return "unknown";
+    }
+}
+
+void printStats(std::ostream& out, const Snapshot& snap) {
+    double uptime = snap.uptime_seconds > 0 ? snap.uptime_seconds : 1.0;
+
+    out << "\nUptime: " << std::fixed << std::setprecision(1)
+        << snap.uptime_seconds << "s\n";
+
+    out << "\nStatements:\n";
+    uint64_t total = 0;
+    for (const auto& metric : STATEMENT_METRICS) {
+        uint64_t value = snap.counter(metric.counter);
+        total += value;
+        out << "  " << std::left << std::setw(20) << metric.label
+            << std::right << std::setw(10) << value
+            << "  (" << std::setprecision(2) << value / uptime << "/s)\n";
+    }
+    out << "  " << std::left << std::setw(20) << "total"
+        << std::right << std::setw(10) << total
+        << "  (" << std::setprecision(2) << total / uptime << "/s)\n";
+
+    out << "\nLatency:\n";
+    std::string lex_label = "lex (1/" + std::to_string(SampledTimer::SAMPLE_EVERY) + " sampled)";
+    printHistogramLine(out, lex_label.c_str(), snap.histogram(Histogram::LEX_LATENCY));
+    printHistogramLine(out, "wal fsync", snap.histogram(Histogram::WAL_FSYNC_LATENCY));
+
+    out << "\nLexer:\n";
+    out << "  " << std::left << std::setw(20) << "tokens scanned"
+        << snap.counter(Counter::TOKENS_SCANNED) << "\n";
+    out << "  " << std::left << std::setw(20) << "lex errors"
+        << snap.counter(Counter::LEX_ERRORS) << "\n";
+
+    out << "\nBuffer pool:\n";
+    uint64_t hits = snap.counter(Counter::BUFFER_POOL_HITS);
+    uint64_t misses = snap.counter(Counter::BUFFER_POOL_MISSES);
+    out << "  " << std::left << std::setw(20) << "hit ratio";
+    if (hits + misses == 0) {
+        out << "n/a (no page accesses)\n";
+    } else {
+        out << std::setprecision(2) << 100.0 * double(hits) / double(hits + misses)
+            << "% (" << hits << " hits, " << misses << " misses)\n";
+    }
+    out << "  " << std::left << std::setw(20) << "read-ahead pages"
+        << snap.counter(Counter::PAGES_PREFETCHED) << "\n";
+    out << "  " << std::left << std::setw(20) << "pages written"
+        << snap.counter(Counter::PAGES_WRITTEN) << "\n";
+
+    out << "\nScans:\n";
+    out << "  " << std::left << std::setw(20) << "zone map skips"
+        << snap.counter(Counter::ZONE_BLOCKS_SKIPPED) << " blocks\n";
+
+    out << "\nResult cache:\n";
+    uint64_t cache_hits = snap.counter(Counter::RESULT_CACHE_HITS);
+    uint64_t cache_misses = snap.counter(Counter::RESULT_CACHE_MISSES);
+    out << "  " << std::left << std::setw(20) << "hit ratio";
+    if (cache_hits + cache_misses == 0) {
+        out << "n/a (no cached lookups)\n";
+    } else {
+        out << std::setprecision(2) << 100.0 * double(cache_hits) / double(cache_hits + cache_misses)
+            << "% (" << cache_hits << " hits, " << cache_misses << " misses)\n";
+    }
+
+    out << "\nMemory:\n";
+    out << "  " << std::left << std::setw(20) << "allocations";
+#ifdef MINIQL_TRACK_ALLOCATIONS
+    out << snap.counter(Counter::ALLOCATIONS) << "\n";
+#else
+    out << "disabled (build with MINIQL_TRACK_ALLOCATIONS)\n";
+#endif
+    out << "\n";
+}
+
+void writePrometheus(std::ostream& out, const Snapshot& snap) {
+    out << std::setprecision(9);
+
+    out << "# HELP miniql_uptime_seconds Time since the metrics were started or reset.\n";
+    out << "# TYPE miniql_uptime_seconds gauge\n";
+    out << "miniql_uptime_seconds " << snap.uptime_seconds << "\n";
+
+    out << "# HELP miniql_statements_total Statements processed, by type.\n";
+    out << "# TYPE miniql_statements_total counter\n";
+    for (const auto& metric : STATEMENT_METRICS) {
+        out << "miniql_statements_total{type=\"" << metric.label << "\"} "
+            << snap.counter(metric.counter) << "\n";
+    }
+
+    struct PlainCounter {
+        Counter counter;
+        const char* name;
+        const char* help;
+    };
+    const PlainCounter plain[] = {
+        {Counter::TOKENS_SCANNED, "miniql_lexer_tokens_total", "Tokens produced by the lexer."},
+        {Counter::LEX_ERRORS, "miniql_lexer_errors_total", "Lexical errors reported."},
+        {Counter::BUFFER_POOL_HITS, "miniql_buffer_pool_hits_total", "Page requests served from the buffer pool."},
+        {Counter::BUFFER_POOL_MISSES, "miniql_buffer_pool_misses_total", "Page requests that required disk I/O."},
+        {Counter::PAGES_PREFETCHED, "miniql_pages_prefetched_total", "Pages read ahead for sequential scans."},
+        {Counter::PAGES_WRITTEN, "miniql_pages_written_total", "Pages written to the data file."},
+        {Counter::ZONE_BLOCKS_SKIPPED, "miniql_zone_map_blocks_skipped_total", "Table blocks skipped by zone maps."},
+        {Counter::RESULT_CACHE_HITS, "miniql_result_cache_hits_total", "SELECTs answered from the result cache."},
+        {Counter::RESULT_CACHE_MISSES, "miniql_result_cache_misses_total", "Cacheable SELECTs not found in the result cache."},
+        {Counter::ALLOCATIONS, "miniql_allocations_total", "Heap allocations (MINIQL_TRACK_ALLOCATIONS builds only)."},
+    };
+    for (const auto& counter : plain) {
+        out << "# HELP " << counter.name << " " << counter.help << "\n";
+        out << "# TYPE " << counter.name << " counter\n";
+        out << counter.name << " " << snap.counter(counter.counter) << "\n";
+    }
+
+    const double quantiles[] = {0.5, 0.9, 0.99, 0.999};
+    for (size_t i = 0; i < HISTOGRAM_COUNT; i++) {
+        const HistogramSnapshot& h = snap.histograms[i];
+        std::string name = std::string("miniql_") + histogramName(static_cast<Histogram>(i)) + "_seconds";
+        out << "# HELP " << name << " Latency summary from an HDR-style histogram.\n";
+        out << "# TYPE " << name << " summary\n";
+        for (double q : quantiles) {
+            out << name << "{quantile=\"" << q << "\"} " << h.percentile(q) / 1e9 << "\n";
+        }
+        out << name << "_sum " << h.sum / 1e9 << "\n";
+        out << name << "_count " << h.count << "\n";
+    }
+}
+
+bool dumpPrometheus(const std::string& path) {
+    std::ofstream file(path, std::ios::out | std::ios::trunc);
+    if (!file) return false;
+    writePrometheus(file, snapshot());
+    return static_cast<bool>(file);
+}
+
+} // namespace metrics
+} // namespace miniql
+
+// ============================================================================
+// CONTAGEM DE ALOCAÇÕES (opcional)
+// ============================================================================
+// Substitui o operator new global. Fica atrás de uma flag de compilação
+// porque até um incremento por alocação é custo que não queremos pagar
+// no build padrão.
+
+#ifdef MINIQL_TRACK_ALLOCATIONS
+void* operator new(std::size_t size) {
+    if (miniql::metrics::g_enabled.load(std::memory_order_relaxed)) {
+        miniql::metrics::bump(miniql::metrics::tl_allocations, 1);
+        if (!miniql::metrics::tl_registered) miniql::metrics::localShard();
+    }
+    if (size == 0) size = 1;
+    if (void* ptr = std::malloc(size)) return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+#endif
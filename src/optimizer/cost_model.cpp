@@ -0,0 +1,499 @@
+#include "optimizer/cost_model.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace miniql {
+namespace optimizer {
+
+namespace {
+
+using ast::BinaryExpr;
+using ast::BinaryOp;
+using ast::ColumnExpr;
+using ast::ExprPtr;
+using ast::ExprType;
+using ast::Expression;
+using ast::LiteralExpr;
+using ast::UnaryExpr;
+using ast::UnaryOp;
+
+double clamp01(double value) {
+    return std::min(std::max(value, 0.0), 1.0);
+}
+
+// Reconhece "coluna op literal" e "literal op coluna" (normalizado para
+// o primeiro formato)
+bool matchColumnLiteral(const Expression& expr, int& column, BinaryOp& op, const Value*& literal) {
+    if (expr.getType() != ExprType::BINARY) return false;
+    const auto& binary = static_cast<const BinaryExpr&>(expr);
+    if (!ast::isComparison(binary.op)) return false;
+
+    ExprType left = binary.left->getType();
+    ExprType right = binary.right->getType();
+    if (left == ExprType::COLUMN && right == ExprType::LITERAL) {
+        column = static_cast<const ColumnExpr&>(*binary.left).column_index;
+        literal = &static_cast<const LiteralExpr&>(*binary.right).value;
+        op = binary.op;
+        return true;
+    }
+    if (left == ExprType::LITERAL && right == ExprType::COLUMN) {
+        column = static_cast<const ColumnExpr&>(*binary.right).column_index;
+        literal = &static_cast<const LiteralExpr&>(*binary.left).value;
+        op = ast::flipComparison(binary.op);
+        return true;
+    }
+    return false;
+}
+
+double defaultSelectivity(BinaryOp op) {
+    if (op == BinaryOp::EQ) return DEFAULT_EQ_SELECTIVITY;
+    if (op == BinaryOp::NE) return 1.0 - DEFAULT_EQ_SELECTIVITY;
+    return DEFAULT_RANGE_SELECTIVITY;
+}
+
+double columnSelectivity(const TableStats* stats, int column, BinaryOp op, const Value& literal) {
+    if (literal.isNull()) return 0.0;   // comparação com NULL nunca é verdadeira
+    if (!stats || column < 0 || static_cast<size_t>(column) >= stats->columns.size() ||
+        stats->row_count == 0) {
+        return defaultSelectivity(op);
+    }
+
+    const ColumnStats& col = stats->columns[column];
+    double non_null = double(stats->row_count - col.null_count) / double(stats->row_count);
+    const EquiDepthHistogram& histogram = col.histogram;
+
+    double equal;
+    if (!histogram.empty()) equal = histogram.selectivityEqual(literal);
+    else if (col.distinct > 0) equal = 1.0 / double(col.distinct);
+    else equal = DEFAULT_EQ_SELECTIVITY;
+
+    auto less = [&](bool inclusive) {
+        if (histogram.empty()) return DEFAULT_RANGE_SELECTIVITY;
+        return histogram.selectivityLess(literal, inclusive);
+    };
+
+    double selectivity;
+    switch (op) {
+        case BinaryOp::EQ: selectivity = equal; break;
+        case BinaryOp::NE: selectivity = 1.0 - equal; break;
+        case BinaryOp::LT: selectivity = less(false); break;
+        case BinaryOp::LE: selectivity = less(true); break;
+        case BinaryOp::GT: selectivity = 1.0 - less(true); break;
+        case BinaryOp::GE: selectivity = 1.0 - less(false); break;
+        default: selectivity = DEFAULT_RANGE_SELECTIVITY; break;
+    }
+    return clamp01(selectivity) * non_null;
+}
+
+// Intervalo sobre uma coluna: lo/hi em "v >= lo AND v <= hi" (ou > e <).
+// Estimar os dois lados como independentes multiplicaria as frações; com
+// o histograma a fração do intervalo é P(v <= hi) - P(v < lo).
+double intervalSelectivity(const TableStats* stats, int column, const Value& lo, bool lo_inclusive,
+                           const Value& hi, bool hi_inclusive) {
+    if (lo.isNull() || hi.isNull()) return 0.0;
+    if (!stats || column < 0 || static_cast<size_t>(column) >= stats->columns.size() ||
+        stats->row_count == 0 || stats->columns[column].histogram.empty()) {
+        return DEFAULT_RANGE_SELECTIVITY * DEFAULT_RANGE_SELECTIVITY;
+    }
+    const ColumnStats& col = stats->columns[column];
+    double non_null = double(stats->row_count - col.null_count) / double(stats->row_count);
+    double below_hi = col.histogram.selectivityLess(hi, hi_inclusive);
+    double below_lo = col.histogram.selectivityLess(lo, !lo_inclusive);
+    return clamp01(below_hi - below_lo) * non_null;
+}
+
+// Achata uma cadeia do mesmo operador lógico: (a AND (b AND c)) -> [a, b, c]
+void flatten(ExprPtr expr, BinaryOp op, std::vector<ExprPtr>& terms) {
+    if (expr->getType() == ExprType::BINARY) {
+        auto& binary = static_cast<BinaryExpr&>(*expr);
+        if (binary.op == op) {
+            flatten(std::move(binary.left), op, terms);
+            flatten(std::move(binary.right), op, terms);
+            return;
+        }
+    }
+    terms.push_back(std::move(expr));
+}
+
+void collectConjuncts(const Expression& expr, std::vector<const Expression*>& terms) {
+    if (expr.getType() == ExprType::BINARY) {
+        const auto& binary = static_cast<const BinaryExpr&>(expr);
+        if (binary.op == BinaryOp::AND) {
+            collectConjuncts(*binary.left, terms);
+            collectConjuncts(*binary.right, terms);
+            return;
+        }
+    }
+    terms.push_back(&expr);
+}
+
+// Número aproximado de níveis de um índice com a cardinalidade dada
+double indexHeight(double rows) {
+    if (rows <= INDEX_FANOUT) return 1.0;
+    return std::ceil(std::log(rows) / std::log(INDEX_FANOUT));
+}
+
+} // namespace
+
+// ============================================================================
+// SELETIVIDADE E ORDEM DOS PREDICADOS
+// ============================================================================
+
+double estimateSelectivity(const Expression& predicate, const TableStats* stats) {
+    switch (predicate.getType()) {
+        case ExprType::BINARY: {
+            const auto& binary = static_cast<const BinaryExpr&>(predicate);
+            if (binary.op == BinaryOp::AND) {
+                // Limites inferior e superior na mesma coluna viram um
+                // intervalo; o resto é combinado como independente
+                std::vector<const Expression*> terms;
+                collectConjuncts(predicate, terms);
+
+                struct Bound {
+                    const Value* value = nullptr;
+                    bool inclusive = false;
+                    size_t term = 0;
+                };
+                std::vector<std::pair<Bound, Bound>> bounds;    // [coluna] -> (inferior, superior)
+                for (size_t i = 0; i < terms.size(); i++) {
+                    int column;
+                    BinaryOp op;
+                    const Value* literal;
+                    if (!matchColumnLiteral(*terms[i], column, op, literal) || column < 0) continue;
+                    if (op != BinaryOp::LT && op != BinaryOp::LE && op != BinaryOp::GT && op != BinaryOp::GE) continue;
+                    if (bounds.size() <= static_cast<size_t>(column)) bounds.resize(column + 1);
+                    bool lower = op == BinaryOp::GT || op == BinaryOp::GE;
+                    Bound& bound = lower ? bounds[column].first : bounds[column].second;
+                    // Havendo mais de um limite do mesmo lado, o primeiro vira
+                    // intervalo e os outros ficam como termos independentes
+                    if (!bound.value) bound = {literal, op == BinaryOp::GE || op == BinaryOp::LE, i};
+                }
+
+                double selectivity = 1.0;
+                std::vector<bool> used(terms.size(), false);
+                for (size_t column = 0; column < bounds.size(); column++) {
+                    const auto& [lower, upper] = bounds[column];
+                    if (!lower.value || !upper.value) continue;
+                    selectivity *= intervalSelectivity(stats, static_cast<int>(column), *lower.value,
+                                                       lower.inclusive, *upper.value, upper.inclusive);
+                    used[lower.term] = used[upper.term] = true;
+                }
+                for (size_t i = 0; i < terms.size(); i++) {
+                    if (!used[i]) selectivity *= estimateSelectivity(*terms[i], stats);
+                }
+                return selectivity;
+            }
+            if (binary.op == BinaryOp::OR) {
+                double a = estimateSelectivity(*binary.left, stats);
+                double b = estimateSelectivity(*binary.right, stats);
+                return clamp01(a + b - a * b);
+            }
+
+            int column;
+            BinaryOp op;
+            const Value* literal;
+            if (matchColumnLiteral(predicate, column, op, literal)) {
+                return columnSelectivity(stats, column, op, *literal);
+            }
+            return ast::isComparison(binary.op) ? defaultSelectivity(binary.op)
+                                                : DEFAULT_RANGE_SELECTIVITY;
+        }
+        case ExprType::UNARY: {
+            const auto& unary = static_cast<const UnaryExpr&>(predicate);
+            if (unary.op == UnaryOp::NOT) {
+                return 1.0 - estimateSelectivity(*unary.operand, stats);
+            }
+            return DEFAULT_RANGE_SELECTIVITY;
+        }
+        case ExprType::LITERAL: {
+            const Value& value = static_cast<const LiteralExpr&>(predicate).value;
+            if (value.isNull()) return 0.0;
+            return value.isNumeric() && value.asReal() == 0.0 ? 0.0 : 1.0;
+        }
+        default:
+            return DEFAULT_RANGE_SELECTIVITY;
+    }
+}
+
+double estimateEvaluationCost(const Expression& predicate) {
+    switch (predicate.getType()) {
+        case ExprType::BINARY: {
+            const auto& binary = static_cast<const BinaryExpr&>(predicate);
+            return CPU_OPERATOR_COST + estimateEvaluationCost(*binary.left) +
+                   estimateEvaluationCost(*binary.right);
+        }
+        case ExprType::UNARY: {
+            const auto& unary = static_cast<const UnaryExpr&>(predicate);
+            return CPU_OPERATOR_COST + estimateEvaluationCost(*unary.operand);
+        }
+        default:
+            return 0.0;
+    }
+}
+
+ExprPtr orderPredicates(ExprPtr predicate, const TableStats* stats) {
+    if (!predicate) return predicate;
+
+    if (predicate->getType() == ExprType::UNARY) {
+        auto& unary = static_cast<UnaryExpr&>(*predicate);
+        unary.operand = orderPredicates(std::move(unary.operand), stats);
+        return predicate;
+    }
+    if (predicate->getType() != ExprType::BINARY) return predicate;
+
+    BinaryOp op = static_cast<BinaryExpr&>(*predicate).op;
+    if (!ast::isLogical(op)) return predicate;
+
+    std::vector<ExprPtr> terms;
+    flatten(std::move(predicate), op, terms);
+
+    struct Ranked {
+        ExprPtr expr;
+        double rank;
+    };
+    std::vector<Ranked> ranked;
+    ranked.reserve(terms.size());
+    for (auto& term : terms) {
+        term = orderPredicates(std::move(term), stats);
+        double selectivity = estimateSelectivity(*term, stats);
+        double cost = std::max(estimateEvaluationCost(*term), CPU_OPERATOR_COST);
+        // AND: quer falhar cedo; OR: quer acertar cedo
+        double rank = op == BinaryOp::AND ? (selectivity - 1.0) / cost : -selectivity / cost;
+        ranked.push_back({std::move(term), rank});
+    }
+
+    std::stable_sort(ranked.begin(), ranked.end(),
+                     [](const Ranked& a, const Ranked& b) { return a.rank < b.rank; });
+
+    // Reconstrói à esquerda: ((t1 op t2) op t3) avalia t1 primeiro
+    ExprPtr result = std::move(ranked[0].expr);
+    for (size_t i = 1; i < ranked.size(); i++) {
+        result = ast::makeBinary(op, std::move(result), std::move(ranked[i].expr));
+    }
+    return result;
+}
+
+// ============================================================================
+// ESCOLHA DO CAMINHO DE ACESSO
+// ============================================================================
+
+AccessPath chooseAccessPath(const TableStats* stats,
+                            const Expression* predicate,
+                            const std::vector<IndexInfo>& indexes) {
+    // Sem ANALYZE assume uma tabela pequena
+    double rows = stats ? double(stats->row_count) : 1000.0;
+    double pages = std::max(1.0, std::ceil(rows / ROWS_PER_PAGE));
+    double eval_cost = predicate ? estimateEvaluationCost(*predicate) : 0.0;
+    double selectivity = predicate ? estimateSelectivity(*predicate, stats) : 1.0;
+
+    AccessPath best;
+    best.method = AccessMethod::SEQ_SCAN;
+    best.cost = pages * SEQ_PAGE_COST + rows * (CPU_TUPLE_COST + eval_cost);
+    best.rows = rows * selectivity;
+
+    if (!predicate || indexes.empty()) return best;
+
+    std::vector<const Expression*> conjuncts;
+    collectConjuncts(*predicate, conjuncts);
+
+    for (const Expression* term : conjuncts) {
+        int column;
+        BinaryOp op;
+        const Value* literal;
+        if (!matchColumnLiteral(*term, column, op, literal) || op == BinaryOp::NE) continue;
+
+        for (size_t i = 0; i < indexes.size(); i++) {
+            const IndexInfo& index = indexes[i];
+            if (index.column_index != column) continue;
+
+            double matching = rows * estimateSelectivity(*term, stats);
+            if (index.unique && op == BinaryOp::EQ) matching = std::min(matching, 1.0);
+
+            // Descida no índice + uma leitura aleatória por página de heap tocada
+            double cost = indexHeight(rows) * RANDOM_PAGE_COST +
+                          std::min(matching, pages) * RANDOM_PAGE_COST +
+                          matching * (CPU_TUPLE_COST + eval_cost);
+            if (cost < best.cost) {
+                best.method = AccessMethod::INDEX_SCAN;
+                best.index = static_cast<int>(i);
+                best.cost = cost;
+            }
+        }
+    }
+    return best;
+}
+
+// ============================================================================
+// ORDEM DE JOINS (DP sobre subconjuntos)
+// ============================================================================
+// best[S] guarda o plano mais barato que junta o conjunto S de relações.
+// Para cada S, testa todas as divisões S = A ∪ B (árvores bushy) e fica com
+// a de menor custo C_out = custo(A) + custo(B) + |S|. Divisões sem predicado
+// de join entre A e B (produto cartesiano) só são usadas se não houver outra.
+
+double equiJoinSelectivity(const ColumnStats* left, const ColumnStats* right) {
+    uint64_t distinct = 0;
+    if (left) distinct = std::max(distinct, left->distinct);
+    if (right) distinct = std::max(distinct, right->distinct);
+    return distinct > 0 ? 1.0 / double(distinct) : DEFAULT_EQ_SELECTIVITY;
+}
+
+std::string JoinPlan::toString(const std::vector<JoinRelation>& relations) const {
+    if (relation >= 0) return relations[relation].name;
+    if (!left || !right) return "";
+    return "(" + left->toString(relations) + " JOIN " + right->toString(relations) + ")";
+}
+
+namespace {
+
+struct DpEntry {
+    double cost = std::numeric_limits<double>::infinity();
+    uint32_t left = 0;
+    uint32_t right = 0;
+};
+
+JoinPlan buildPlan(uint32_t mask, const std::vector<DpEntry>& best,
+                   const std::vector<double>& rows) {
+    JoinPlan plan;
+    plan.rows = rows[mask];
+    if ((mask & (mask - 1)) == 0) {
+        plan.relation = 0;
+        while (!(mask & (1u << plan.relation))) plan.relation++;
+        return plan;
+    }
+    plan.cost = best[mask].cost;
+    plan.left = std::make_unique<JoinPlan>(buildPlan(best[mask].left, best, rows));
+    plan.right = std::make_unique<JoinPlan>(buildPlan(best[mask].right, best, rows));
+    return plan;
+}
+
+// Heurística para muitas relações: join left-deep que sempre escolhe
+// a relação conectada que gera o menor resultado intermediário
+JoinPlan greedyJoinOrder(const std::vector<JoinRelation>& relations,
+                         const std::vector<JoinEdge>& edges) {
+    size_t n = relations.size();
+    std::vector<bool> used(n, false);
+
+    size_t first = 0;
+    for (size_t i = 1; i < n; i++) {
+        if (relations[i].rows < relations[first].rows) first = i;
+    }
+    used[first] = true;
+
+    auto plan = std::make_unique<JoinPlan>();
+    plan->relation = static_cast<int>(first);
+    plan->rows = relations[first].rows;
+
+    for (size_t step = 1; step < n; step++) {
+        size_t pick = n;
+        double pick_rows = 0.0;
+        bool pick_connected = false;
+
+        for (size_t i = 0; i < n; i++) {
+            if (used[i]) continue;
+            double selectivity = 1.0;
+            bool connected = false;
+            for (const JoinEdge& edge : edges) {
+                if ((edge.left == i && edge.right < n && used[edge.right]) ||
+                    (edge.right == i && edge.left < n && used[edge.left])) {
+                    selectivity *= edge.selectivity;
+                    connected = true;
+                }
+            }
+            double result = plan->rows * relations[i].rows * selectivity;
+            if (pick == n || (connected && !pick_connected) ||
+                (connected == pick_connected && result < pick_rows)) {
+                pick = i;
+                pick_rows = result;
+                pick_connected = connected;
+            }
+        }
+
+        used[pick] = true;
+        auto leaf = std::make_unique<JoinPlan>();
+        leaf->relation = static_cast<int>(pick);
+        leaf->rows = relations[pick].rows;
+
+        auto join = std::make_unique<JoinPlan>();
+        join->rows = pick_rows;
+        join->cost = plan->cost + pick_rows;
+        join->left = std::move(plan);
+        join->right = std::move(leaf);
+        plan = std::move(join);
+    }
+    return std::move(*plan);
+}
+
+} // namespace
+
+JoinPlan optimizeJoinOrder(const std::vector<JoinRelation>& relations,
+                           const std::vector<JoinEdge>& edges) {
+    size_t n = relations.size();
+    if (n == 0) return JoinPlan();
+    if (n > MAX_DP_RELATIONS) return greedyJoinOrder(relations, edges);
+
+    uint32_t full = (1u << n) - 1;
+    std::vector<uint32_t> adjacent(n, 0);
+    for (const JoinEdge& edge : edges) {
+        if (edge.left >= n || edge.right >= n || edge.left == edge.right) continue;
+        adjacent[edge.left] |= 1u << edge.right;
+        adjacent[edge.right] |= 1u << edge.left;
+    }
+
+    // Cardinalidade de cada subconjunto: produto das linhas vezes a
+    // seletividade de todas as arestas internas
+    std::vector<double> rows(full + 1, 1.0);
+    for (uint32_t mask = 1; mask <= full; mask++) {
+        uint32_t low = mask & (~mask + 1);
+        uint32_t rest = mask ^ low;
+        size_t rel = 0;
+        while (!(low & (1u << rel))) rel++;
+
+        double result = rows[rest] * relations[rel].rows;
+        for (const JoinEdge& edge : edges) {
+            if (edge.left >= n || edge.right >= n) continue;
+            if ((edge.left == rel && (rest & (1u << edge.right))) ||
+                (edge.right == rel && (rest & (1u << edge.left)))) {
+                result *= edge.selectivity;
+            }
+        }
+        rows[mask] = result;
+    }
+
+    auto connected = [&](uint32_t a, uint32_t b) {
+        for (size_t i = 0; i < n; i++) {
+            if ((a & (1u << i)) && (adjacent[i] & b)) return true;
+        }
+        return false;
+    };
+
+    std::vector<DpEntry> best(full + 1);
+    for (size_t i = 0; i < n; i++) best[1u << i].cost = 0.0;
+
+    for (uint32_t mask = 1; mask <= full; mask++) {
+        if ((mask & (mask - 1)) == 0) continue;
+
+        for (int pass = 0; pass < 2 && best[mask].cost == std::numeric_limits<double>::infinity(); pass++) {
+            bool allow_cross = pass == 1;
+            // Submáscaras próprias; left < right evita avaliar a mesma divisão duas vezes
+            for (uint32_t left = (mask - 1) & mask; left > 0; left = (left - 1) & mask) {
+                uint32_t right = mask ^ left;
+                if (left > right) continue;
+                if (!allow_cross && !connected(left, right)) continue;
+
+                double cost = best[left].cost + best[right].cost + rows[mask];
+                if (cost < best[mask].cost) {
+                    best[mask].cost = cost;
+                    best[mask].left = left;
+                    best[mask].right = right;
+                }
+            }
+        }
+    }
+
+    return buildPlan(full, best, rows);
+}
+
+} // namespace optimizer
+} // namespace miniql
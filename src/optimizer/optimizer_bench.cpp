@@ -0,0 +1,552 @@
+#include "optimizer/cost_model.h"
+#include "optimizer/statistics.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+
+// Conferência do otimizador (estatísticas e modelo de custo).
+// Uso: ./optimizer_bench [linhas]
+//
+// 1. Ordem de joins: a DP contra a enumeração de todas as árvores (n <= 8)
+// 2. HyperLogLog: erro relativo contra a contagem exata de distintos
+// 3. Histograma: seletividade de =, < e intervalos contra contagens exatas
+//    numa coluna Zipf, e ordem dos buckets numa coluna REAL com NaN
+// 4. Ordem dos predicados: o termo mais seletivo vem primeiro
+// Sai com 1 se alguma conferência falhar.
+
+using namespace miniql;
+using namespace miniql::optimizer;
+using namespace miniql::ast;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+bool g_ok = true;
+
+void check(bool condition, const std::string& what) {
+    if (!condition) {
+        std::cout << "  FAILED: " << what << "\n";
+        g_ok = false;
+    }
+}
+
+// ============================================================================
+// 1. ORDEM DE JOINS
+// ============================================================================
+// Gera todas as árvores bushy (divisões não ordenadas) com a mesma regra da
+// DP: num nó, se alguma divisão tem predicado de join entre os lados, só
+// essas valem; senão (subconjunto desconexo) qualquer divisão vale. O custo
+// C_out de cada árvore é recalculado do zero, sem reaproveitar a DP.
+
+struct JoinCase {
+    std::vector<JoinRelation> relations;
+    std::vector<JoinEdge> edges;
+};
+
+double cardinality(const JoinCase& c, uint32_t mask) {
+    double rows = 1.0;
+    for (size_t i = 0; i < c.relations.size(); i++) {
+        if (mask & (1u << i)) rows *= c.relations[i].rows;
+    }
+    for (const JoinEdge& edge : c.edges) {
+        if ((mask & (1u << edge.left)) && (mask & (1u << edge.right))) rows *= edge.selectivity;
+    }
+    return rows;
+}
+
+bool crosses(const JoinCase& c, uint32_t a, uint32_t b) {
+    for (const JoinEdge& edge : c.edges) {
+        if (((a >> edge.left) & 1 && (b >> edge.right) & 1) || ((a >> edge.right) & 1 && (b >> edge.left) & 1)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Custos de todas as árvores admissíveis sobre mask
+void enumerateTrees(const JoinCase& c, uint32_t mask, std::vector<double>& costs, size_t& trees) {
+    if ((mask & (mask - 1)) == 0) {
+        costs.push_back(0.0);
+        trees++;
+        return;
+    }
+    uint32_t low = mask & (~mask + 1);
+    bool any_connected = false;
+    for (uint32_t left = (mask - 1) & mask; left > 0; left = (left - 1) & mask) {
+        if ((left & low) && crosses(c, left, mask ^ left)) any_connected = true;
+    }
+
+    double rows = cardinality(c, mask);
+    // A relação mais baixa sempre à esquerda: cada divisão aparece uma vez
+    for (uint32_t left = (mask - 1) & mask; left > 0; left = (left - 1) & mask) {
+        uint32_t right = mask ^ left;
+        if (!(left & low)) continue;
+        if (any_connected && !crosses(c, left, right)) continue;
+
+        std::vector<double> left_costs, right_costs;
+        size_t ignored = 0;
+        enumerateTrees(c, left, left_costs, ignored);
+        enumerateTrees(c, right, right_costs, ignored);
+        for (double l : left_costs) {
+            for (double r : right_costs) {
+                costs.push_back(l + r + rows);
+                trees++;
+            }
+        }
+    }
+}
+
+// Recalcula custo e linhas do plano devolvido pela DP
+double planCost(const JoinCase& c, const JoinPlan& plan, uint32_t& mask, bool& consistent) {
+    if (plan.relation >= 0) {
+        mask = 1u << plan.relation;
+        consistent = consistent && std::fabs(plan.rows - c.relations[plan.relation].rows) <= 1e-9 * plan.rows;
+        return 0.0;
+    }
+    uint32_t left_mask = 0, right_mask = 0;
+    double cost = planCost(c, *plan.left, left_mask, consistent) + planCost(c, *plan.right, right_mask, consistent);
+    consistent = consistent && (left_mask & right_mask) == 0;
+    mask = left_mask | right_mask;
+    double rows = cardinality(c, mask);
+    consistent = consistent && std::fabs(plan.rows - rows) <= 1e-9 * std::max(rows, 1.0);
+    return cost + rows;
+}
+
+JoinCase randomJoinCase(std::mt19937_64& rng, size_t n, const std::string& shape) {
+    JoinCase c;
+    std::uniform_real_distribution<double> log_rows(1.0, 6.0);
+    for (size_t i = 0; i < n; i++) {
+        c.relations.push_back({"r" + std::to_string(i), std::round(std::pow(10.0, log_rows(rng)))});
+    }
+    auto edge = [&](size_t a, size_t b) {
+        // 1 / distintos de uma das colunas, limitado pelas cardinalidades
+        double distinct = std::max(1.0, std::min(c.relations[a].rows, c.relations[b].rows) *
+                                            std::uniform_real_distribution<double>(0.05, 1.0)(rng));
+        c.edges.push_back({a, b, 1.0 / distinct});
+    };
+    if (shape == "chain" || shape == "cycle") {
+        for (size_t i = 0; i + 1 < n; i++) edge(i, i + 1);
+        if (shape == "cycle" && n > 2) edge(n - 1, 0);
+    } else if (shape == "star") {
+        for (size_t i = 1; i < n; i++) edge(0, i);
+    } else if (shape == "clique") {
+        for (size_t i = 0; i < n; i++)
+            for (size_t j = i + 1; j < n; j++) edge(i, j);
+    } else if (shape == "random") {
+        for (size_t i = 1; i < n; i++) edge(rng() % i, i);             // árvore geradora
+        for (size_t extra = 0; extra < n / 2; extra++) {
+            size_t a = rng() % n, b = rng() % n;
+            if (a != b) edge(a, b);
+        }
+    } else {                                                        // "split": dois componentes
+        for (size_t i = 0; i + 1 < n; i++) {
+            if (i + 1 != n / 2) edge(i, i + 1);
+        }
+    }
+    return c;
+}
+
+void checkJoinOrder() {
+    std::cout << "Join order: DP vs exhaustive enumeration\n";
+    std::cout << std::left << std::setw(10) << "shape" << std::right << std::setw(4) << "n" << std::setw(12)
+              << "trees" << std::setw(12) << "DP us" << std::setw(14) << "enum ms" << std::setw(10) << "cases"
+              << "\n";
+
+    std::mt19937_64 rng(7);
+    const char* shapes[] = {"chain", "star", "cycle", "clique", "random", "split"};
+    for (const char* shape : shapes) {
+        for (size_t n = 2; n <= 8; n++) {
+            double dp_us = 0.0, enum_ms = 0.0;
+            size_t trees = 0;
+            const int cases = n <= 6 ? 20 : 5;
+            for (int k = 0; k < cases; k++) {
+                JoinCase c = randomJoinCase(rng, n, shape);
+
+                auto t0 = Clock::now();
+                JoinPlan plan = optimizeJoinOrder(c.relations, c.edges);
+                dp_us += std::chrono::duration<double, std::micro>(Clock::now() - t0).count();
+
+                t0 = Clock::now();
+                std::vector<double> costs;
+                trees = 0;
+                enumerateTrees(c, (1u << n) - 1, costs, trees);
+                enum_ms += std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+                double best = *std::min_element(costs.begin(), costs.end());
+
+                uint32_t mask = 0;
+                bool consistent = true;
+                double recomputed = planCost(c, plan, mask, consistent);
+                std::string label = std::string(shape) + " n=" + std::to_string(n) + " case " + std::to_string(k);
+                check(consistent && mask == (1u << n) - 1, label + ": malformed plan " + plan.toString(c.relations));
+                check(std::fabs(recomputed - plan.cost) <= 1e-9 * std::max(best, 1.0),
+                      label + ": plan cost " + std::to_string(plan.cost) + " recomputes to " + std::to_string(recomputed));
+                check(std::fabs(plan.cost - best) <= 1e-9 * std::max(best, 1.0),
+                      label + ": DP cost " + std::to_string(plan.cost) + " but best tree costs " + std::to_string(best));
+            }
+            if (n == 4 || n == 8) {
+                std::cout << std::left << std::setw(10) << shape << std::right << std::setw(4) << n << std::setw(12)
+                          << trees << std::fixed << std::setprecision(1) << std::setw(12) << dp_us / cases
+                          << std::setw(14) << std::setprecision(2) << enum_ms / cases << std::setw(10) << cases << "\n";
+            }
+        }
+    }
+}
+
+// ============================================================================
+// 2. HYPERLOGLOG
+// ============================================================================
+
+void checkHyperLogLog() {
+    // Erro padrão documentado: 1.04 / sqrt(2^p). O erro quadrático médio de
+    // todas as execuções precisa ficar dentro dele (com folga de 15% pela
+    // amostra finita) e nenhuma estimativa pode passar de 4 erros padrão
+    const unsigned precision = 12;
+    const double standard_error = 1.04 / std::sqrt(double(1u << precision));
+
+    std::cout << "\nHyperLogLog (p = " << precision << ", standard error " << std::fixed << std::setprecision(2)
+              << 100.0 * standard_error << "%)\n";
+    std::cout << std::right << std::setw(10) << "distinct" << std::setw(12) << "rms err" << std::setw(12)
+              << "max |err|" << std::setw(8) << "runs" << "\n";
+
+    const uint64_t cardinalities[] = {100, 1000, 10000, 100000, 1000000};
+    double all_squares = 0.0;
+    int all_runs = 0;
+    for (uint64_t distinct : cardinalities) {
+        const int runs = distinct >= 1000000 ? 8 : 32;
+        double squares = 0.0, worst = 0.0;
+        for (int run = 0; run < runs; run++) {
+            // Cada valor aparece 1 a 3 vezes; repetições não podem mudar a estimativa
+            HyperLogLog sketch(precision), first_half(precision), second_half(precision);
+            int64_t base = static_cast<int64_t>(run) << 40;
+            for (uint64_t i = 0; i < distinct; i++) {
+                Value value = run % 2 ? Value::integer(base + static_cast<int64_t>(i))
+                                      : Value::text("key-" + std::to_string(run) + "-" + std::to_string(i));
+                for (uint64_t r = 0; r <= i % 3; r++) sketch.add(value);
+                (i % 2 ? first_half : second_half).add(value);
+            }
+            first_half.merge(second_half);
+            check(first_half.estimate() == sketch.estimate(),
+                  "merged sketch differs from a single sketch at " + std::to_string(distinct));
+
+            double error = std::fabs(double(sketch.estimate()) - double(distinct)) / double(distinct);
+            squares += error * error;
+            worst = std::max(worst, error);
+            check(error <= 4.0 * standard_error,
+                  "HLL error " + std::to_string(100.0 * error) + "% at " + std::to_string(distinct));
+        }
+        double rms = std::sqrt(squares / runs);
+        all_squares += squares;
+        all_runs += runs;
+        std::cout << std::setw(10) << distinct << std::setw(11) << std::setprecision(2) << 100.0 * rms << "%"
+                  << std::setw(11) << 100.0 * worst << "%" << std::setw(8) << runs << "\n";
+    }
+    double rms = std::sqrt(all_squares / all_runs);
+    std::cout << std::setw(10) << "all" << std::setw(11) << 100.0 * rms << "%" << std::setw(20) << all_runs << "\n";
+    check(rms <= 1.15 * standard_error, "HLL rms error " + std::to_string(100.0 * rms) + "% over all runs");
+}
+
+// ============================================================================
+// 3. HISTOGRAMA
+// ============================================================================
+// Coluna Zipf (s = 1.1 sobre 10000 valores) com 2% de NULLs. Um histograma
+// equi-depth só erra dentro do bucket da constante: em = e < o erro fica
+// abaixo da fração de linhas desse bucket; num intervalo (v >= a AND
+// v <= b), dos dois buckets das pontas.
+
+struct SkewedColumn {
+    std::vector<Row> rows;
+    std::vector<uint64_t> frequency;    // por valor (1..values)
+    std::vector<uint64_t> prefix;       // prefix[v] = linhas com valor < v
+    uint64_t nulls = 0;
+};
+
+SkewedColumn zipfColumn(size_t row_count, size_t values, double s, std::mt19937_64& rng) {
+    std::vector<double> cdf(values);
+    double total = 0.0;
+    for (size_t v = 0; v < values; v++) cdf[v] = total += 1.0 / std::pow(double(v + 1), s);
+    std::uniform_real_distribution<double> uniform(0.0, total);
+
+    // Permuta os valores: o mais frequente não é o menor
+    std::vector<int64_t> value_of(values);
+    for (size_t v = 0; v < values; v++) value_of[v] = static_cast<int64_t>(v + 1);
+    std::shuffle(value_of.begin(), value_of.end(), rng);
+
+    SkewedColumn column;
+    column.frequency.assign(values + 2, 0);
+    column.rows.reserve(row_count);
+    for (size_t i = 0; i < row_count; i++) {
+        if (rng() % 50 == 0) {
+            column.rows.push_back({Value::null()});
+            column.nulls++;
+            continue;
+        }
+        size_t rank = static_cast<size_t>(std::lower_bound(cdf.begin(), cdf.end(), uniform(rng)) - cdf.begin());
+        int64_t value = value_of[std::min(rank, values - 1)];
+        column.rows.push_back({Value::integer(value)});
+        column.frequency[value]++;
+    }
+    column.prefix.assign(values + 3, 0);
+    for (size_t v = 1; v < values + 2; v++) column.prefix[v + 1] = column.prefix[v] + column.frequency[v];
+    return column;
+}
+
+// Fração das linhas do bucket que contém value
+double bucketMass(const EquiDepthHistogram& histogram, const Value& value, uint64_t rows) {
+    for (const HistogramBucket& bucket : histogram.buckets()) {
+        if (!(bucket.upper < value)) return double(bucket.count) / double(rows);
+    }
+    return 0.0;
+}
+
+void checkHistogram(size_t row_count) {
+    const size_t values = 10000;
+    std::mt19937_64 rng(11);
+    SkewedColumn column = zipfColumn(row_count, values, 1.1, rng);
+
+    catalog::TableSchema schema;
+    schema.name = "events";
+    schema.columns = {{"v", DataType::INT}};
+    auto t0 = Clock::now();
+    TableStats stats = analyzeTable(schema, column.rows);
+    double analyze_ms = std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+    const EquiDepthHistogram& histogram = stats.columns[0].histogram;
+
+    std::cout << "\nHistogram selectivity: " << row_count << " rows, Zipf s=1.1 over " << values
+              << " values, " << histogram.buckets().size() << " buckets (ANALYZE " << std::fixed
+              << std::setprecision(1) << analyze_ms << " ms)\n";
+    std::cout << std::left << std::setw(12) << "predicate" << std::right << std::setw(8) << "tests" << std::setw(14)
+              << "mean |err|" << std::setw(13) << "max |err|" << std::setw(16) << "no stats |err|" << "\n";
+
+    auto selectivity = [&](ExprPtr predicate) { return estimateSelectivity(*predicate, &stats); };
+    auto column_ref = [] { return makeColumn("v", 0); };
+    auto literal = [](int64_t v) { return makeLiteral(Value::integer(v)); };
+    double rows = double(row_count);
+
+    struct Errors {
+        double sum = 0.0, worst = 0.0, default_sum = 0.0;
+        size_t tests = 0;
+        void add(double estimate, double exact, double fallback) {
+            sum += std::fabs(estimate - exact);
+            worst = std::max(worst, std::fabs(estimate - exact));
+            default_sum += std::fabs(fallback - exact);
+            tests++;
+        }
+    };
+    auto print = [](const char* name, const Errors& e) {
+        std::cout << std::left << std::setw(12) << name << std::right << std::setw(8) << e.tests << std::fixed
+                  << std::setprecision(3) << std::setw(13) << 100.0 * e.sum / e.tests << "%" << std::setw(12)
+                  << 100.0 * e.worst << "%" << std::setw(15) << 100.0 * e.default_sum / e.tests << "%\n";
+    };
+
+    Errors equal, less, range;
+    std::uniform_int_distribution<int64_t> any_value(1, static_cast<int64_t>(values));
+    for (int t = 0; t < 2000; t++) {
+        int64_t v = any_value(rng);
+        double exact = double(column.frequency[v]) / rows;
+        double estimate = selectivity(makeBinary(BinaryOp::EQ, column_ref(), literal(v)));
+        equal.add(estimate, exact, DEFAULT_EQ_SELECTIVITY);
+        check(std::fabs(estimate - exact) <= bucketMass(histogram, Value::integer(v), row_count) + 1e-9,
+              "v = " + std::to_string(v) + ": estimate " + std::to_string(estimate) + ", exact " + std::to_string(exact));
+
+        exact = double(column.prefix[v]) / rows;
+        estimate = selectivity(makeBinary(BinaryOp::LT, column_ref(), literal(v)));
+        less.add(estimate, exact, DEFAULT_RANGE_SELECTIVITY);
+        check(std::fabs(estimate - exact) <= bucketMass(histogram, Value::integer(v), row_count) + 1e-9,
+              "v < " + std::to_string(v) + ": estimate " + std::to_string(estimate) + ", exact " + std::to_string(exact));
+
+        int64_t a = any_value(rng), b = any_value(rng);
+        if (a > b) std::swap(a, b);
+        exact = double(column.prefix[b + 1] - column.prefix[a]) / rows;
+        estimate = selectivity(makeBinary(BinaryOp::AND, makeBinary(BinaryOp::GE, column_ref(), literal(a)),
+                                          makeBinary(BinaryOp::LE, column_ref(), literal(b))));
+        range.add(estimate, exact, DEFAULT_RANGE_SELECTIVITY * DEFAULT_RANGE_SELECTIVITY);
+        double slack = bucketMass(histogram, Value::integer(a), row_count) +
+                       bucketMass(histogram, Value::integer(b), row_count);
+        check(std::fabs(estimate - exact) <= slack + 1e-9,
+              std::to_string(a) + " <= v <= " + std::to_string(b) + ": estimate " + std::to_string(estimate) +
+              ", exact " + std::to_string(exact));
+    }
+
+    // Os valores mais frequentes: a estimativa por igualdade precisa
+    // reconhecer o pico (pelo menos metade da frequência real)
+    std::vector<int64_t> by_frequency;
+    for (size_t v = 1; v <= values; v++) by_frequency.push_back(static_cast<int64_t>(v));
+    std::sort(by_frequency.begin(), by_frequency.end(),
+              [&](int64_t a, int64_t b) { return column.frequency[a] > column.frequency[b]; });
+    for (size_t i = 0; i < 5; i++) {
+        int64_t v = by_frequency[i];
+        double exact = double(column.frequency[v]) / rows;
+        double estimate = selectivity(makeBinary(BinaryOp::EQ, column_ref(), literal(v)));
+        check(estimate >= 0.5 * exact, "heavy hitter " + std::to_string(v) + ": estimate " +
+                                           std::to_string(estimate) + ", exact " + std::to_string(exact));
+    }
+
+    print("=", equal);
+    print("<", less);
+    print("a<=v<=b", range);
+}
+
+// REAL com NaN: o sort do ANALYZE precisa de uma ordem fraca estrita
+// (NaN depois de todos os números), senão min/max e os limites dos
+// buckets saem fora de ordem
+void checkNanHistogram() {
+    std::mt19937_64 rng(13);
+    std::vector<Row> rows;
+    for (int i = 1; i <= 1000; i++) rows.push_back({Value::real(i)});
+    for (int i = 0; i < 100; i++) rows.push_back({Value::real(std::nan(""))});
+    std::shuffle(rows.begin(), rows.end(), rng);
+
+    catalog::TableSchema schema;
+    schema.name = "readings";
+    schema.columns = {{"x", DataType::REAL}};
+    TableStats stats = analyzeTable(schema, rows);
+    const ColumnStats& column = stats.columns[0];
+    const auto& buckets = column.histogram.buckets();
+
+    check(column.min == Value::real(1.0), "NaN column min: " + column.min.toString());
+    check(column.max.kind() == Value::Kind::REAL && std::isnan(column.max.realValue()),
+          "NaN column max: " + column.max.toString());
+    bool ordered = true;
+    for (size_t i = 1; i < buckets.size(); i++) ordered = ordered && buckets[i - 1].upper < buckets[i].upper;
+    check(ordered, "NaN column: bucket bounds out of order");
+
+    double estimate = estimateSelectivity(*makeBinary(BinaryOp::LT, makeColumn("x", 0), makeLiteral(Value::real(500.5))),
+                                          &stats);
+    double exact = 500.0 / 1100.0;
+    check(std::fabs(estimate - exact) <= bucketMass(column.histogram, Value::real(500.5), 1100) + 1e-9,
+          "x < 500.5 with NaN: estimate " + std::to_string(estimate) + ", exact " + std::to_string(exact));
+    std::cout << "NaN column: min " << column.min.toString() << ", max " << column.max.toString() << ", "
+              << buckets.size() << " ordered buckets, x < 500.5 estimated " << std::setprecision(3) << estimate
+              << " (exact " << exact << ")\n";
+}
+
+// ============================================================================
+// 4. ORDEM DOS PREDICADOS
+// ============================================================================
+
+void collect(const Expression& expr, BinaryOp op, std::vector<std::string>& terms) {
+    if (expr.getType() == ExprType::BINARY && static_cast<const BinaryExpr&>(expr).op == op) {
+        const auto& binary = static_cast<const BinaryExpr&>(expr);
+        collect(*binary.left, op, terms);
+        collect(*binary.right, op, terms);
+        return;
+    }
+    terms.push_back(expressionToString(expr));
+}
+
+void checkPredicateOrder(size_t row_count) {
+    // a: uniforme em 0..999, c: uniforme em 0..9, z: Zipf em 1..1000
+    std::mt19937_64 rng(5);
+    SkewedColumn z = zipfColumn(row_count, 1000, 1.2, rng);
+    catalog::TableSchema schema;
+    schema.name = "orders";
+    schema.columns = {{"a", DataType::INT}, {"c", DataType::INT}, {"z", DataType::INT}};
+    std::vector<Row> rows;
+    rows.reserve(row_count);
+    for (size_t i = 0; i < row_count; i++) {
+        rows.push_back({Value::integer(static_cast<int64_t>(rng() % 1000)), Value::integer(static_cast<int64_t>(rng() % 10)),
+                        z.rows[i][0]});
+    }
+    TableStats stats = analyzeTable(schema, rows);
+
+    auto term = [](const char* column, int index, BinaryOp op, int64_t v) {
+        return makeBinary(op, makeColumn(column, index), makeLiteral(Value::integer(v)));
+    };
+    int64_t top = 0;
+    for (size_t v = 1; v <= 1000; v++) {
+        if (z.frequency[v] > z.frequency[top]) top = static_cast<int64_t>(v);
+    }
+
+    // Termos com o mesmo custo; a ordem esperada sai das contagens exatas
+    struct Term {
+        std::function<ExprPtr()> make;
+        double exact;
+    };
+    auto exactOf = [&](const std::function<ExprPtr()>& make) {
+        ExprPtr e = make();
+        size_t count = 0;
+        const auto& binary = static_cast<const BinaryExpr&>(*e);
+        int column = static_cast<const ColumnExpr&>(*binary.left).column_index;
+        const Value& literal = static_cast<const LiteralExpr&>(*binary.right).value;
+        for (const Row& row : rows) {
+            if (row[column].isNull()) continue;
+            int cmp = row[column].compare(literal);
+            switch (binary.op) {
+                case BinaryOp::EQ: count += cmp == 0; break;
+                case BinaryOp::NE: count += cmp != 0; break;
+                case BinaryOp::LT: count += cmp < 0; break;
+                case BinaryOp::GT: count += cmp > 0; break;
+                default: break;
+            }
+        }
+        return double(count) / double(rows.size());
+    };
+    std::vector<Term> terms;
+    for (auto make : std::vector<std::function<ExprPtr()>>{
+             [&] { return term("c", 1, BinaryOp::LT, 9); },          // ~90%
+             [&] { return term("z", 2, BinaryOp::EQ, top); },        // valor mais frequente
+             [&] { return term("a", 0, BinaryOp::EQ, 17); },         // ~0.1%
+             [&] { return term("a", 0, BinaryOp::GT, 499); },        // ~50%
+             [&] { return term("z", 2, BinaryOp::NE, top); }}) {
+        terms.push_back({make, exactOf(make)});
+    }
+
+    std::cout << "\nPredicate ordering (" << row_count << " rows)\n";
+    for (BinaryOp op : {BinaryOp::AND, BinaryOp::OR}) {
+        // Em AND o menos provável primeiro; em OR o mais provável
+        std::vector<size_t> expected(terms.size());
+        for (size_t i = 0; i < terms.size(); i++) expected[i] = i;
+        std::stable_sort(expected.begin(), expected.end(), [&](size_t x, size_t y) {
+            return op == BinaryOp::AND ? terms[x].exact < terms[y].exact : terms[x].exact > terms[y].exact;
+        });
+
+        ExprPtr predicate = terms[0].make();
+        for (size_t i = 1; i < terms.size(); i++) predicate = makeBinary(op, std::move(predicate), terms[i].make());
+        ExprPtr ordered = orderPredicates(std::move(predicate), &stats);
+
+        std::vector<std::string> got;
+        collect(*ordered, op, got);
+        std::cout << "  " << (op == BinaryOp::AND ? "AND" : "OR ") << ":";
+        for (const std::string& t : got) std::cout << "  " << t;
+        std::cout << "\n";
+
+        check(got.size() == terms.size(), "orderPredicates dropped terms");
+        check(!got.empty() && got[0] == expressionToString(*terms[expected[0]].make()),
+              std::string(op == BinaryOp::AND ? "AND" : "OR") + ": most selective term is not first");
+        for (size_t i = 0; i < got.size() && i < expected.size(); i++) {
+            check(got[i] == expressionToString(*terms[expected[i]].make()),
+                  "position " + std::to_string(i) + ": expected " + expressionToString(*terms[expected[i]].make()) +
+                  ", got " + got[i]);
+        }
+    }
+
+    // Um termo mais caro com seletividade parecida vai para depois
+    ExprPtr cheap = term("c", 1, BinaryOp::EQ, 3);
+    ExprPtr costly = makeBinary(BinaryOp::EQ, makeBinary(BinaryOp::MUL, makeColumn("c", 1), makeLiteral(Value::integer(2))),
+                                makeLiteral(Value::integer(6)));
+    std::string cheap_text = expressionToString(*cheap);
+    ExprPtr ordered = orderPredicates(makeBinary(BinaryOp::AND, std::move(costly), std::move(cheap)), &stats);
+    std::vector<std::string> got;
+    collect(*ordered, BinaryOp::AND, got);
+    check(!got.empty() && got[0] == cheap_text, "cheaper term with similar selectivity is not first");
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    size_t row_count = argc > 1 ? std::stoul(argv[1]) : 200000;
+
+    checkJoinOrder();
+    checkHyperLogLog();
+    checkHistogram(row_count);
+    checkNanHistogram();
+    checkPredicateOrder(row_count);
+
+    std::cout << "\n" << (g_ok ? "All optimizer checks passed" : "OPTIMIZER CHECK FAILED") << "\n";
+    return g_ok ? 0 : 1;
+}
@@ -0,0 +1,240 @@
+#include "optimizer/statistics.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace miniql {
+namespace optimizer {
+
+// ============================================================================
+// HYPERLOGLOG
+// ============================================================================
+// Os p bits mais altos do hash escolhem o registrador; o registrador guarda
+// a maior posição do primeiro bit 1 vista nos bits restantes. A estimativa
+// usa o histograma dos registradores (estimador de Ertl, 2017): sem o viés
+// da média harmônica perto de 2.5 * 2^p nem a troca para linear counting.
+
+namespace {
+
+// sigma(x) = x + sum_k x^(2^k) * 2^(k-1)
+double hllSigma(double x) {
+    if (x == 1.0) return std::numeric_limits<double>::infinity();
+    double y = 1.0;
+    double z = x;
+    double previous;
+    do {
+        x *= x;
+        previous = z;
+        z += x * y;
+        y += y;
+    } while (z != previous);
+    return z;
+}
+
+// tau(x) = (1 - x - sum_k (1 - x^(2^-k))^2 * 2^-k) / 3
+double hllTau(double x) {
+    if (x == 0.0 || x == 1.0) return 0.0;
+    double y = 1.0;
+    double z = 1.0 - x;
+    double previous;
+    do {
+        x = std::sqrt(x);
+        previous = z;
+        y *= 0.5;
+        z -= (1.0 - x) * (1.0 - x) * y;
+    } while (z != previous);
+    return z / 3.0;
+}
+
+} // namespace
+
+HyperLogLog::HyperLogLog(unsigned precision)
+    : precision_(std::min(std::max(precision, 4u), 16u)),
+      registers_(size_t(1) << precision_, 0) {}
+
+void HyperLogLog::add(uint64_t hash) {
+    size_t index = static_cast<size_t>(hash >> (64 - precision_));
+    // Sentinela garante que w != 0 e limita o rank a 64 - p + 1
+    uint64_t w = (hash << precision_) | (uint64_t(1) << (precision_ - 1));
+#if defined(__GNUC__) || defined(__clang__)
+    uint8_t rank = static_cast<uint8_t>(__builtin_clzll(w) + 1);
+#else
+    uint8_t rank = 1;
+    while (!(w & (uint64_t(1) << 63))) { w <<= 1; rank++; }
+#endif
+    if (rank > registers_[index]) registers_[index] = rank;
+}
+
+void HyperLogLog::merge(const HyperLogLog& other) {
+    if (other.precision_ != precision_) return;
+    for (size_t i = 0; i < registers_.size(); i++) {
+        registers_[i] = std::max(registers_[i], other.registers_[i]);
+    }
+}
+
+uint64_t HyperLogLog::estimate() const {
+    // Registradores valem de 0 a q + 1, q = 64 - p
+    const unsigned q = 64 - precision_;
+    std::vector<uint32_t> counts(q + 2, 0);
+    for (uint8_t reg : registers_) counts[reg]++;
+
+    double m = static_cast<double>(registers_.size());
+    double z = m * hllTau(1.0 - counts[q + 1] / m);
+    for (unsigned k = q; k >= 1; k--) z = 0.5 * (z + counts[k]);
+    z += m * hllSigma(counts[0] / m);
+
+    const double alpha_infinity = 0.5 / std::log(2.0);
+    return static_cast<uint64_t>(alpha_infinity * m * m / z + 0.5);
+}
+
+// ============================================================================
+// HISTOGRAMA EQUI-DEPTH
+// ============================================================================
+
+EquiDepthHistogram EquiDepthHistogram::build(const std::vector<Value>& sorted, size_t max_buckets) {
+    EquiDepthHistogram histogram;
+    if (sorted.empty() || max_buckets == 0) return histogram;
+
+    histogram.min_ = sorted.front();
+    histogram.total_ = sorted.size();
+    size_t depth = (sorted.size() + max_buckets - 1) / max_buckets;
+
+    HistogramBucket current{sorted.front(), 0, 0};
+    for (size_t i = 0; i < sorted.size();) {
+        size_t run = 1;
+        while (i + run < sorted.size() && sorted[i + run] == sorted[i]) run++;
+
+        // Valor frequente (ocupa um bucket inteiro): bucket só dele, senão a
+        // frequência seria diluída entre os outros valores do bucket
+        if (run >= depth) {
+            if (current.count > 0) histogram.buckets_.push_back(current);
+            histogram.buckets_.push_back(HistogramBucket{sorted[i], run, 1});
+            current = HistogramBucket{sorted[i], 0, 0};
+            i += run;
+            continue;
+        }
+
+        // Fecha o bucket cheio, sem separar valores iguais entre buckets
+        if (current.count >= depth) {
+            histogram.buckets_.push_back(current);
+            current = HistogramBucket{sorted[i], 0, 0};
+        }
+        current.distinct++;
+        current.upper = sorted[i];
+        current.count += run;
+        i += run;
+    }
+    if (current.count > 0) histogram.buckets_.push_back(current);
+    return histogram;
+}
+
+double EquiDepthHistogram::fractionBelow(size_t bucket, const Value& value) const {
+    const Value& lower = bucket == 0 ? min_ : buckets_[bucket - 1].upper;
+    const Value& upper = buckets_[bucket].upper;
+
+    if (lower.isNumeric() && upper.isNumeric() && value.isNumeric()) {
+        double lo = lower.asReal();
+        double hi = upper.asReal();
+        // NaN (maior que todos os números) não tem posição para interpolar
+        if (std::isnan(lo) || std::isnan(hi) || std::isnan(value.asReal())) return 0.5;
+        if (hi <= lo) return 0.0;
+        return std::min(std::max((value.asReal() - lo) / (hi - lo), 0.0), 1.0);
+    }
+    // Sem ordem numérica: assume meio do bucket
+    return 0.5;
+}
+
+double EquiDepthHistogram::selectivityEqual(const Value& value) const {
+    if (buckets_.empty() || value < min_ || value > buckets_.back().upper) return 0.0;
+
+    auto it = std::lower_bound(buckets_.begin(), buckets_.end(), value,
+        [](const HistogramBucket& bucket, const Value& v) { return bucket.upper < v; });
+    double per_value = double(it->count) / double(std::max<uint64_t>(it->distinct, 1));
+    return per_value / double(total_);
+}
+
+double EquiDepthHistogram::selectivityLess(const Value& value, bool inclusive) const {
+    if (buckets_.empty()) return 0.0;
+    if (value < min_ || (value == min_ && !inclusive && buckets_.front().upper != min_)) {
+        return 0.0;
+    }
+
+    auto it = std::lower_bound(buckets_.begin(), buckets_.end(), value,
+        [](const HistogramBucket& bucket, const Value& v) { return bucket.upper < v; });
+    if (it == buckets_.end()) return 1.0;
+
+    size_t index = static_cast<size_t>(it - buckets_.begin());
+    double below = 0.0;
+    for (size_t i = 0; i < index; i++) below += double(buckets_[i].count);
+
+    double count = double(it->count);
+    double per_value = count / double(std::max<uint64_t>(it->distinct, 1));
+    double inside;
+    if (value == it->upper) {
+        inside = inclusive ? count : count - per_value;
+    } else if (it->distinct == 1) {
+        inside = 0.0;       // o único valor do bucket é o limite superior
+    } else {
+        inside = fractionBelow(index, value) * count;
+        if (inclusive) inside = std::min(count, inside + per_value);
+    }
+    return std::min(1.0, (below + inside) / double(total_));
+}
+
+// ============================================================================
+// ANALYZE
+// ============================================================================
+
+TableStats analyzeTable(const catalog::TableSchema& schema,
+                        const std::vector<Row>& rows,
+                        size_t histogram_buckets) {
+    TableStats stats;
+    stats.table_name = schema.name;
+    stats.row_count = rows.size();
+    stats.columns.resize(schema.columns.size());
+
+    std::vector<Value> values;
+    values.reserve(rows.size());
+
+    for (size_t col = 0; col < schema.columns.size(); col++) {
+        ColumnStats& column = stats.columns[col];
+        HyperLogLog sketch;
+        values.clear();
+
+        for (const Row& row : rows) {
+            if (col >= row.size() || row[col].isNull()) {
+                column.null_count++;
+                continue;
+            }
+            sketch.add(row[col]);
+            values.push_back(row[col]);
+        }
+
+        if (values.empty()) continue;
+
+        std::sort(values.begin(), values.end());
+        column.distinct = std::min<uint64_t>(std::max<uint64_t>(sketch.estimate(), 1), values.size());
+        column.min = values.front();
+        column.max = values.back();
+        column.histogram = EquiDepthHistogram::build(values, histogram_buckets);
+    }
+
+    return stats;
+}
+
+void StatisticsCatalog::update(TableStats stats) {
+    std::string name = stats.table_name;
+    tables_[name] = std::move(stats);
+}
+
+const TableStats* StatisticsCatalog::find(const std::string& table_name) const {
+    auto it = tables_.find(table_name);
+    return it == tables_.end() ? nullptr : &it->second;
+}
+
+void StatisticsCatalog::remove(const std::string& table_name) {
+    tables_.erase(table_name);
+}
+
+} // namespace optimizer
+} // namespace miniql
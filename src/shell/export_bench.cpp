@@ -0,0 +1,551 @@
+#include "shell/result_writer.h"
+#include <algorithm>
+#include <cerrno>
+#include <cfloat>
+#include <charconv>
+#include <chrono>
+#include <climits>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <unistd.h>
+
+// Conferência e benchmark do ResultWriter (.mode / .output).
+// Uso: ./export_bench [linhas]
+//
+// Conferência: passa um VectorCursor por cada modo, grava num arquivo e lê
+// de volta com um parser independente:
+//   - CSV (RFC 4180): vírgulas, aspas, CR/LF, texto vazio x NULL
+//   - TSV: escapes \t \n \r \\ e NULL (\N)
+//   - BINARY ("MQLR"): decodifica e compara valor a valor
+//   - REAL e INTEGER: o texto de std::to_chars relê o mesmo valor (bit a bit)
+//   - erros de escrita (/dev/full) viram exceção com o strerror
+// Benchmark: exportação de N linhas em cada modo contra um laço com
+// std::ofstream e operator<<. Sai com 1 se alguma conferência falhar.
+
+using namespace miniql;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+bool g_ok = true;
+
+void check(bool condition, const std::string& what) {
+    if (!condition) {
+        std::cout << "  FAILED: " << what << "\n";
+        g_ok = false;
+    }
+}
+
+std::string g_path;
+
+// Escreve as linhas no modo dado e devolve o conteúdo do arquivo
+std::string render(OutputMode mode, const std::vector<std::string>& columns, std::vector<Row> rows,
+                   size_t batch_size = executor::DEFAULT_BATCH_SIZE) {
+    {
+        ResultWriter writer;
+        writer.setMode(mode);
+        if (!writer.setOutput(g_path)) throw std::runtime_error("Cannot open " + g_path);
+        executor::VectorCursor cursor(columns, std::move(rows));
+        writer.write(cursor, batch_size);
+    }
+    std::ifstream in(g_path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+// Mesmo valor, inclusive o tipo; REAL comparado bit a bit (-0.0, NaN)
+bool sameValue(const Value& a, const Value& b) {
+    if (a.kind() != b.kind()) return false;
+    if (a.kind() == Value::Kind::REAL) {
+        double x = a.realValue(), y = b.realValue();
+        return std::memcmp(&x, &y, sizeof(x)) == 0;
+    }
+    return a.isNull() || a == b;
+}
+
+std::string describe(const Value& value) {
+    if (value.kind() != Value::Kind::REAL) return value.toString();
+    std::ostringstream ss;
+    ss << std::setprecision(17) << value.realValue();
+    return ss.str();
+}
+
+// ============================================================================
+// PARSERS INDEPENDENTES
+// ============================================================================
+
+// Campos de texto do CSV: (valor, estava entre aspas)
+struct CsvField {
+    std::string text;
+    bool quoted = false;
+};
+
+// RFC 4180; aceita \n ou \r\n no fim do registro
+std::vector<std::vector<CsvField>> parseCsv(const std::string& data) {
+    std::vector<std::vector<CsvField>> records;
+    std::vector<CsvField> record;
+    CsvField field;
+    size_t i = 0;
+    bool field_started = false;
+    while (i < data.size()) {
+        char c = data[i];
+        if (!field_started && c == '"') {
+            field.quoted = true;
+            field_started = true;
+            i++;
+            while (true) {
+                if (i >= data.size()) throw std::runtime_error("Unterminated quoted CSV field");
+                if (data[i] == '"') {
+                    if (i + 1 < data.size() && data[i + 1] == '"') {
+                        field.text += '"';
+                        i += 2;
+                        continue;
+                    }
+                    i++;
+                    break;
+                }
+                field.text += data[i++];
+            }
+            if (i < data.size() && data[i] != ',' && data[i] != '\n' && data[i] != '\r') {
+                throw std::runtime_error("Garbage after closing quote in CSV");
+            }
+            continue;
+        }
+        if (c == ',') {
+            record.push_back(field);
+            field = CsvField();
+            field_started = false;
+            i++;
+        } else if (c == '\n' || (c == '\r' && i + 1 < data.size() && data[i + 1] == '\n')) {
+            record.push_back(field);
+            records.push_back(record);
+            record.clear();
+            field = CsvField();
+            field_started = false;
+            i += c == '\r' ? 2 : 1;
+        } else {
+            if (c == '"' || c == '\r' || field.quoted) throw std::runtime_error("Unquoted special character in CSV");
+            field.text += c;
+            field_started = true;
+            i++;
+        }
+    }
+    if (field_started || !record.empty()) throw std::runtime_error("CSV does not end with a newline");
+    return records;
+}
+
+// Campo de TSV: (texto sem escapes, é NULL)
+std::vector<std::vector<std::pair<std::string, bool>>> parseTsv(const std::string& data) {
+    std::vector<std::vector<std::pair<std::string, bool>>> records;
+    std::vector<std::pair<std::string, bool>> record;
+    std::string field;
+    bool is_null = false;
+    for (size_t i = 0; i < data.size(); i++) {
+        char c = data[i];
+        if (c == '\t' || c == '\n') {
+            record.emplace_back(field, is_null);
+            field.clear();
+            is_null = false;
+            if (c == '\n') {
+                records.push_back(record);
+                record.clear();
+            }
+        } else if (c == '\\') {
+            if (++i >= data.size()) throw std::runtime_error("Dangling backslash in TSV");
+            switch (data[i]) {
+                case 't': field += '\t'; break;
+                case 'n': field += '\n'; break;
+                case 'r': field += '\r'; break;
+                case '\\': field += '\\'; break;
+                case 'N':
+                    if (!field.empty()) throw std::runtime_error("\\N inside a TSV field");
+                    is_null = true;
+                    break;
+                default: throw std::runtime_error("Unknown TSV escape");
+            }
+        } else if (c == '\r') {
+            throw std::runtime_error("Raw CR in TSV");
+        } else {
+            field += c;
+        }
+    }
+    if (!field.empty() || !record.empty()) throw std::runtime_error("TSV does not end with a newline");
+    return records;
+}
+
+struct BinaryReader {
+    const std::string& data;
+    size_t pos = 0;
+
+    uint64_t le(size_t bytes) {
+        if (pos + bytes > data.size()) throw std::runtime_error("Truncated binary result");
+        uint64_t value = 0;
+        for (size_t i = 0; i < bytes; i++) value |= uint64_t(static_cast<uint8_t>(data[pos + i])) << (8 * i);
+        pos += bytes;
+        return value;
+    }
+    std::string bytes(size_t n) {
+        if (pos + n > data.size()) throw std::runtime_error("Truncated binary result");
+        std::string out = data.substr(pos, n);
+        pos += n;
+        return out;
+    }
+};
+
+void decodeBinary(const std::string& data, std::vector<std::string>& columns, std::vector<Row>& rows) {
+    BinaryReader in{data};
+    if (in.bytes(4) != "MQLR") throw std::runtime_error("Bad binary magic");
+    if (in.le(1) != 1) throw std::runtime_error("Unknown binary version");
+    uint64_t count = in.le(4);
+    for (uint64_t i = 0; i < count; i++) columns.push_back(in.bytes(in.le(4)));
+    while (true) {
+        uint64_t marker = in.le(1);
+        if (marker == 0) break;
+        if (marker != 1) throw std::runtime_error("Bad row marker");
+        Row row;
+        for (uint64_t c = 0; c < count; c++) {
+            switch (in.le(1)) {
+                case 0: row.push_back(Value::null()); break;
+                case 1: row.push_back(Value::integer(static_cast<int64_t>(in.le(8)))); break;
+                case 2: {
+                    uint64_t bits = in.le(8);
+                    double real;
+                    std::memcpy(&real, &bits, sizeof(real));
+                    row.push_back(Value::real(real));
+                    break;
+                }
+                case 3: row.push_back(Value::text(in.bytes(in.le(4)))); break;
+                default: throw std::runtime_error("Bad value tag");
+            }
+        }
+        rows.push_back(std::move(row));
+    }
+    if (in.pos != data.size()) throw std::runtime_error("Trailing bytes after binary result");
+}
+
+// Texto de um campo numérico de volta a Value (mesma forma que to_chars)
+Value parseNumber(const std::string& text, Value::Kind kind) {
+    const char* end = text.data() + text.size();
+    if (kind == Value::Kind::INTEGER) {
+        int64_t value = 0;
+        auto result = std::from_chars(text.data(), end, value);
+        if (result.ec != std::errc() || result.ptr != end) throw std::runtime_error("Bad integer '" + text + "'");
+        return Value::integer(value);
+    }
+    double value = 0.0;
+    auto result = std::from_chars(text.data(), end, value);
+    if (result.ec != std::errc() || result.ptr != end) throw std::runtime_error("Bad real '" + text + "'");
+    return Value::real(value);
+}
+
+// ============================================================================
+// CONFERÊNCIA
+// ============================================================================
+
+// Textos que exercitam cada regra de escape
+const std::vector<std::string> TRICKY_TEXTS = {
+    "plain", "", " ", "a,b", "say \"hi\"", "\"", "\"\"", "line1\nline2", "cr\rhere", "crlf\r\n",
+    "tab\there", "back\\slash", "\\N", "\\t literal", ",", ",,\"\n", "NULL", "trailing ", "ünïcödé ✓",
+    std::string("nul\0byte", 8),
+};
+
+std::vector<Row> sampleRows(std::mt19937_64& rng) {
+    const std::vector<double> reals = {
+        0.0, -0.0, 0.1, -0.1, 1.0 / 3.0, 2.0 / 3.0, 1e-300, 1e300, DBL_MIN, DBL_MAX, -DBL_MAX, DBL_EPSILON,
+        5e-324, 123456789.125, 9007199254740993.0, std::numeric_limits<double>::infinity(),
+        -std::numeric_limits<double>::infinity(), 3.141592653589793, 2.718281828459045, 1e21, 1e-7,
+    };
+    const std::vector<int64_t> ints = {0, 1, -1, 9, 10, INT64_MAX, INT64_MIN, INT64_MAX - 1, INT64_MIN + 1,
+                                       INT32_MAX, INT32_MIN, 1000000000000000000LL};
+
+    std::vector<Row> rows;
+    for (size_t i = 0; i < std::max({reals.size(), ints.size(), TRICKY_TEXTS.size()}); i++) {
+        rows.push_back({Value::integer(ints[i % ints.size()]), Value::real(reals[i % reals.size()]),
+                        Value::text(TRICKY_TEXTS[i % TRICKY_TEXTS.size()]),
+                        i % 3 == 0 ? Value::null() : Value::text(TRICKY_TEXTS[(i * 7) % TRICKY_TEXTS.size()])});
+    }
+    rows.push_back({Value::null(), Value::null(), Value::null(), Value::null()});
+    rows.push_back({Value::null(), Value::null(), Value::text(""), Value::null()});
+
+    // Reais aleatórios em todas as magnitudes (bits aleatórios, sem NaN)
+    for (int i = 0; i < 20000; i++) {
+        uint64_t bits = rng();
+        double real;
+        std::memcpy(&real, &bits, sizeof(real));
+        if (std::isnan(real)) continue;
+        std::string text(rng() % 12, 'x');
+        for (char& c : text) c = ",\"\n\r\t\\ aZ"[rng() % 11];
+        rows.push_back({Value::integer(static_cast<int64_t>(rng())), Value::real(real), Value::text(text),
+                        rng() % 4 == 0 ? Value::null() : Value::text(text + "|")});
+    }
+    return rows;
+}
+
+const std::vector<std::string> COLUMNS = {"id", "price, usd", "note \"q\"", "tab\tcol"};
+
+void checkCsv(const std::vector<Row>& rows) {
+    std::string out = render(OutputMode::CSV, COLUMNS, rows);
+
+    // Formas exatas dos casos que a RFC define
+    std::string small = render(OutputMode::CSV, {"a", "b"},
+                               {{Value::text("x,y"), Value::text("say \"hi\"")},
+                                {Value::text(""), Value::null()},
+                                {Value::text("l1\r\nl2"), Value::integer(-7)}});
+    check(small == "a,b\n\"x,y\",\"say \"\"hi\"\"\"\n\"\",\n\"l1\r\nl2\",-7\n", "CSV exact form: " + small);
+
+    auto records = parseCsv(out);
+    check(records.size() == rows.size() + 1, "CSV record count " + std::to_string(records.size()));
+    for (size_t c = 0; c < COLUMNS.size() && !records.empty(); c++) {
+        check(records[0][c].text == COLUMNS[c], "CSV header column " + std::to_string(c));
+    }
+    size_t bad = 0;
+    for (size_t r = 0; r < rows.size() && r + 1 < records.size(); r++) {
+        const auto& record = records[r + 1];
+        if (record.size() != rows[r].size()) {
+            bad++;
+            continue;
+        }
+        for (size_t c = 0; c < rows[r].size(); c++) {
+            const Value& expected = rows[r][c];
+            const CsvField& field = record[c];
+            Value got;
+            if (!field.quoted && field.text.empty()) got = Value::null();
+            else if (expected.kind() == Value::Kind::TEXT) got = Value::text(field.text);
+            else got = parseNumber(field.text, expected.kind());
+            if (!sameValue(expected, got)) {
+                if (bad++ < 5) check(false, "CSV row " + std::to_string(r) + " col " + std::to_string(c) + ": " +
+                                            describe(expected) + " came back as " + describe(got));
+            }
+        }
+    }
+    check(bad == 0, "CSV: " + std::to_string(bad) + " mismatched fields");
+}
+
+void checkTsv(const std::vector<Row>& rows) {
+    std::string out = render(OutputMode::TSV, COLUMNS, rows);
+    std::string small = render(OutputMode::TSV, {"a", "b"},
+                               {{Value::text("t\tn\nr\rb\\"), Value::null()}, {Value::text(""), Value::text("\\N")}});
+    check(small == "a\tb\nt\\tn\\nr\\rb\\\\\t\\N\n\t\\\\N\n", "TSV exact form: " + small);
+
+    auto records = parseTsv(out);
+    check(records.size() == rows.size() + 1, "TSV record count " + std::to_string(records.size()));
+    for (size_t c = 0; c < COLUMNS.size() && !records.empty(); c++) {
+        check(records[0][c].first == COLUMNS[c], "TSV header column " + std::to_string(c));
+    }
+    size_t bad = 0;
+    for (size_t r = 0; r < rows.size() && r + 1 < records.size(); r++) {
+        const auto& record = records[r + 1];
+        if (record.size() != rows[r].size()) {
+            bad++;
+            continue;
+        }
+        for (size_t c = 0; c < rows[r].size(); c++) {
+            const Value& expected = rows[r][c];
+            Value got;
+            if (record[c].second) got = Value::null();
+            else if (expected.kind() == Value::Kind::TEXT) got = Value::text(record[c].first);
+            else got = parseNumber(record[c].first, expected.kind());
+            if (!sameValue(expected, got) && bad++ < 5) {
+                check(false, "TSV row " + std::to_string(r) + " col " + std::to_string(c) + ": " + describe(expected) +
+                             " came back as " + describe(got));
+            }
+        }
+    }
+    check(bad == 0, "TSV: " + std::to_string(bad) + " mismatched fields");
+}
+
+void checkBinary(const std::vector<Row>& rows) {
+    // Lotes pequenos: o resultado atravessa várias chamadas a nextBatch
+    std::string out = render(OutputMode::BINARY, COLUMNS, rows, 7);
+    std::vector<std::string> columns;
+    std::vector<Row> decoded;
+    decodeBinary(out, columns, decoded);
+    check(columns == COLUMNS, "binary column names");
+    check(decoded.size() == rows.size(), "binary row count " + std::to_string(decoded.size()));
+    size_t bad = 0;
+    for (size_t r = 0; r < rows.size() && r < decoded.size(); r++) {
+        for (size_t c = 0; c < rows[r].size(); c++) {
+            if (c >= decoded[r].size() || !sameValue(rows[r][c], decoded[r][c])) bad++;
+        }
+    }
+    check(bad == 0, "binary: " + std::to_string(bad) + " mismatched values");
+
+    std::string empty = render(OutputMode::BINARY, {"x"}, {});
+    columns.clear();
+    decoded.clear();
+    decodeBinary(empty, columns, decoded);
+    check(decoded.empty() && columns.size() == 1, "binary empty result");
+}
+
+void checkTable() {
+    std::string out = render(OutputMode::TABLE, {"id", "name"},
+                             {{Value::integer(1), Value::text("ab")}, {Value::integer(-20), Value::null()}});
+    check(out == "id  | name\n----+-----\n1   | ab  \n-20 | NULL\n(2 rows)\n", "table form: " + out);
+}
+
+// ============================================================================
+// BENCHMARK
+// ============================================================================
+
+void appendIostreamCsv(std::ostream& out, const Value& value) {
+    switch (value.kind()) {
+        case Value::Kind::NULL_VALUE: break;
+        case Value::Kind::INTEGER: out << value.intValue(); break;
+        case Value::Kind::REAL: out << value.realValue(); break;
+        default: {
+            const std::string& text = value.asText();
+            if (!text.empty() && text.find_first_of(",\"\r\n") == std::string::npos) {
+                out << text;
+                break;
+            }
+            out << '"';
+            for (char c : text) {
+                if (c == '"') out << '"';
+                out << c;
+            }
+            out << '"';
+        }
+    }
+}
+
+// Disco cheio (/dev/full): write() lança com o strerror, tanto no flush
+// final quanto no meio do resultado, e o writer segue usável em outro destino
+void checkWriteErrors() {
+    if (::access("/dev/full", W_OK) != 0) {
+        std::cout << "  (no /dev/full here, write errors not checked)\n";
+        return;
+    }
+    std::vector<std::string> columns = {"id", "name"};
+    for (size_t count : {size_t(3), size_t(100000)}) {
+        std::vector<Row> rows;
+        for (size_t i = 0; i < count; i++) {
+            rows.push_back({Value::integer(static_cast<int64_t>(i)), Value::text("some text to fill the buffer")});
+        }
+        ResultWriter writer;
+        writer.setMode(OutputMode::CSV);
+        check(writer.setOutput("/dev/full"), "open /dev/full");
+        std::string error;
+        try {
+            executor::VectorCursor cursor(columns, std::move(rows));
+            writer.write(cursor);
+        } catch (const std::runtime_error& e) {
+            error = e.what();
+        }
+        check(error.find(std::strerror(ENOSPC)) != std::string::npos,
+              std::to_string(count) + " rows to /dev/full: " + (error.empty() ? "no error reported" : error));
+
+        check(writer.setOutput(g_path), "switch back from /dev/full");
+        executor::VectorCursor cursor(columns, {{Value::integer(1), Value::text("ok")}});
+        writer.write(cursor);
+    }
+    std::ifstream in(g_path, std::ios::binary);
+    std::string out((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    check(out == "id,name\n1,ok\n", "output after a failed write: " + out);
+}
+
+void benchmark(size_t row_count) {
+    std::mt19937_64 rng(3);
+    const char* words[] = {"alpha", "beta", "gamma, delta", "say \"x\"", "epsilon zeta eta", "theta"};
+    std::vector<Row> rows;
+    rows.reserve(row_count);
+    for (size_t i = 0; i < row_count; i++) {
+        rows.push_back({Value::integer(static_cast<int64_t>(i)),
+                        Value::real(static_cast<double>(rng() % 10000000) / 100.0),
+                        Value::text(words[rng() % 6]),
+                        rng() % 10 == 0 ? Value::null() : Value::integer(static_cast<int64_t>(rng() % 100000))});
+    }
+    std::vector<std::string> columns = {"id", "price", "name", "qty"};
+
+    std::cout << "\nExport: " << row_count << " rows x 4 columns to a file\n";
+    std::cout << std::left << std::setw(30) << "writer" << std::right << std::setw(10) << "ms" << std::setw(12)
+              << "MB" << std::setw(14) << "Mrows/s" << "\n";
+    auto report = [&](const std::string& name, double ms, double bytes) {
+        std::cout << std::left << std::setw(30) << name << std::right << std::fixed << std::setprecision(1)
+                  << std::setw(10) << ms << std::setw(12) << bytes / (1024.0 * 1024.0) << std::setw(14)
+                  << std::setprecision(2) << row_count / ms / 1000.0 << "\n";
+    };
+
+    double baseline_ms = 0.0;
+    {
+        auto start = Clock::now();
+        std::ofstream out(g_path, std::ios::binary);
+        out << std::setprecision(17);
+        out << "id,price,name,qty\n";
+        for (const Row& row : rows) {
+            for (size_t c = 0; c < row.size(); c++) {
+                if (c > 0) out << ',';
+                appendIostreamCsv(out, row[c]);
+            }
+            out << '\n';
+        }
+        out.close();
+        baseline_ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        std::ifstream in(g_path, std::ios::binary | std::ios::ate);
+        report("CSV, std::ofstream <<", baseline_ms, static_cast<double>(in.tellg()));
+    }
+
+    for (OutputMode mode : {OutputMode::CSV, OutputMode::TSV, OutputMode::BINARY, OutputMode::TABLE}) {
+        std::vector<Row> copy = rows;
+        executor::VectorCursor cursor(columns, std::move(copy));
+        auto start = Clock::now();
+        {
+            ResultWriter writer;
+            writer.setMode(mode);
+            writer.setOutput(g_path);
+            writer.write(cursor);
+        }
+        double ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        std::ifstream in(g_path, std::ios::binary | std::ios::ate);
+        std::string name = "ResultWriter " + outputModeToString(mode);
+        if (mode == OutputMode::CSV) {
+            std::ostringstream speedup;
+            speedup << " (" << std::fixed << std::setprecision(1) << baseline_ms / ms << "x)";
+            name += speedup.str();
+        }
+        report(name, ms, static_cast<double>(in.tellg()));
+    }
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    size_t row_count = argc > 1 ? std::stoul(argv[1]) : 2000000;
+
+    char path_template[] = "/tmp/miniql_export_bench_XXXXXX";
+    int fd = ::mkstemp(path_template);
+    if (fd < 0) {
+        std::cerr << "Cannot create temporary file" << std::endl;
+        return 1;
+    }
+    ::close(fd);
+    g_path = path_template;
+
+    try {
+        std::mt19937_64 rng(42);
+        std::vector<Row> rows = sampleRows(rng);
+        std::cout << "Round trips: " << rows.size() << " rows (escapes, NULL vs empty text, extreme INT/REAL)\n";
+        checkCsv(rows);
+        checkTsv(rows);
+        checkBinary(rows);
+        checkTable();
+        std::cout << (g_ok ? "  CSV, TSV, binary and table output verified\n" : "");
+        checkWriteErrors();
+        std::cout << (g_ok ? "  write errors (disk full) reported\n" : "");
+
+        benchmark(row_count);
+    } catch (const std::exception& e) {
+        std::cout << "  FAILED: " << e.what() << "\n";
+        g_ok = false;
+    }
+
+    std::remove(g_path.c_str());
+    std::cout << "\n" << (g_ok ? "All export checks passed" : "EXPORT CHECK FAILED") << "\n";
+    return g_ok ? 0 : 1;
+}
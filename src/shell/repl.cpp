@@ -1,10 +1,63 @@
 #include "shell/repl.h"
+#include "executor/materialized_view.h"
+#include "lexer/scanner.h"
+#include "metrics/metrics.h"
+#include <cctype>
+#include <cstdint>
 #include <iostream>
+#include <iomanip>
 #include <sstream>
 #include <algorithm>
 
 namespace miniql {
 
+namespace {
+
+// Classifica o statement pelo primeiro token para as métricas
+metrics::Counter statementCounter(const std::vector<lexer::Token>& tokens) {
+    if (tokens.empty()) return metrics::Counter::STMT_OTHER;
+    switch (tokens.front().type) {
+        case lexer::TokenType::SELECT: return metrics::Counter::STMT_SELECT;
+        case lexer::TokenType::INSERT: return metrics::Counter::STMT_INSERT;
+        case lexer::TokenType::UPDATE: return metrics::Counter::STMT_UPDATE;
+        case lexer::TokenType::DELETE: return metrics::Counter::STMT_DELETE;
+        case lexer::TokenType::CREATE: return metrics::Counter::STMT_CREATE;
+        case lexer::TokenType::DROP: return metrics::Counter::STMT_DROP;
+        default: return metrics::Counter::STMT_OTHER;
+    }
+}
+
+// "16MB", "512KB", "1048576"; false se não for um tamanho
+bool parseByteSize(const std::string& text, size_t& bytes) {
+    size_t digits = 0;
+    while (digits < text.size() && std::isdigit(static_cast<unsigned char>(text[digits]))) digits++;
+    if (digits == 0 || digits > 12) return false;
+
+    std::string unit = text.substr(digits);
+    std::transform(unit.begin(), unit.end(), unit.begin(), ::toupper);
+    size_t multiplier = 1;
+    if (unit == "KB" || unit == "K") multiplier = 1024;
+    else if (unit == "MB" || unit == "M") multiplier = 1024 * 1024;
+    else if (unit == "GB" || unit == "G") multiplier = 1024 * 1024 * 1024;
+    else if (!unit.empty() && unit != "B") return false;
+
+    uint64_t value = std::stoull(text.substr(0, digits));
+    if (value > SIZE_MAX / multiplier) return false;
+    bytes = static_cast<size_t>(value) * multiplier;
+    return true;
+}
+
+std::string formatBytes(size_t bytes) {
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(1);
+    if (bytes >= (1u << 20)) out << bytes / double(1u << 20) << " MB";
+    else if (bytes >= 1024) out << bytes / 1024.0 << " KB";
+    else out << bytes << " B";
+    return out.str();
+}
+
+} // namespace
+
 REPL::REPL() : running_(true) {}
 
 REPL::~REPL() {}
@@ -74,6 +127,22 @@ bool REPL::processMetaCommand(const std::string& command) {
         std::cout << "Schema command not implemented yet.\n";
         return false;
     }
+    else if (command.length() >= 6 && command.substr(0, 6) == ".stats") {
+        processStatsCommand(command);
+        return false;
+    }
+    else if (command.length() >= 5 && command.substr(0, 5) == ".mode") {
+        processModeCommand(command);
+        return false;
+    }
+    else if (command.length() >= 7 && command.substr(0, 7) == ".output") {
+        processOutputCommand(command);
+        return false;
+    }
+    else if (command.length() >= 6 && command.substr(0, 6) == ".cache") {
+        processCacheCommand(command);
+        return false;
+    }
     else {
         std::cout << "Unknown command: " << command << "\n";
         std::cout << "Type .help for available commands.\n";
@@ -83,7 +152,171 @@ bool REPL::processMetaCommand(const std::string& command) {
     return true;
 }
 
+void REPL::processStatsCommand(const std::string& command) {
+    std::istringstream args(command.substr(6));
+    std::string action;
+    args >> action;
+
+    if (action.empty()) {
+        metrics::printStats(std::cout, metrics::snapshot());
+    }
+    else if (action == "reset") {
+        metrics::reset();
+        std::cout << "Statistics reset.\n";
+    }
+    else if (action == "prometheus") {
+        std::string path;
+        args >> path;
+        if (path.empty()) {
+            std::cout << "Usage: .stats prometheus <file>\n";
+        } else if (metrics::dumpPrometheus(path)) {
+            std::cout << "Metrics written to " << path << "\n";
+        } else {
+            std::cout << "Error: cannot write " << path << "\n";
+        }
+    }
+    else {
+        std::cout << "Usage: .stats [reset | prometheus <file>]\n";
+    }
+}
+
+void REPL::processModeCommand(const std::string& command) {
+    std::istringstream args(command.substr(5));
+    std::string name;
+    args >> name;
+
+    if (name.empty()) {
+        std::cout << "Current mode: " << outputModeToString(writer_.mode()) << "\n";
+        return;
+    }
+
+    OutputMode mode;
+    if (!parseOutputMode(name, mode)) {
+        std::cout << "Usage: .mode table|csv|tsv|binary\n";
+        return;
+    }
+    writer_.setMode(mode);
+}
+
+void REPL::processOutputCommand(const std::string& command) {
+    std::istringstream args(command.substr(7));
+    std::string path;
+    args >> path;
+
+    try {
+        if (!writer_.setOutput(path)) {
+            std::cout << "Error: cannot open " << path << "\n";
+            return;
+        }
+    }
+    catch (const std::runtime_error& e) {
+        // O destino anterior falhou, mas a troca já foi feita
+        std::cout << "Error: " << e.what() << "\n";
+    }
+    if (!writer_.outputPath().empty()) {
+        std::cout << "Output redirected to " << writer_.outputPath() << "\n";
+    }
+}
+
+void REPL::processCacheCommand(const std::string& command) {
+    std::istringstream args(command.substr(6));
+    std::string action;
+    args >> action;
+
+    if (action.empty()) {
+        executor::ResultCacheStats stats = cache_.stats();
+        std::cout << "Result cache: " << (stats.capacity ? "on" : "off") << "\n";
+        std::cout << "  entries        " << stats.entries << "\n";
+        std::cout << "  memory         " << formatBytes(stats.bytes) << " of " << formatBytes(stats.capacity) << "\n";
+        std::cout << "  hit rate       ";
+        if (stats.hits + stats.misses == 0) {
+            std::cout << "n/a (the shell has no executor feeding the cache yet)\n";
+        } else {
+            std::cout << std::fixed << std::setprecision(1) << 100.0 * stats.hitRate() << "% (" << stats.hits
+                      << " hits, " << stats.misses << " misses)\n";
+        }
+        std::cout << "  invalidations  " << stats.invalidations << "\n";
+        std::cout << "  evictions      " << stats.evictions << "\n";
+    }
+    else if (action == "on") {
+        if (!cache_.enabled()) cache_.setCapacity(executor::DEFAULT_RESULT_CACHE_BYTES);
+        std::cout << "Result cache enabled.\n";
+    }
+    else if (action == "off") {
+        cache_.setCapacity(0);
+        std::cout << "Result cache disabled.\n";
+    }
+    else if (action == "size") {
+        std::string size;
+        args >> size;
+        size_t bytes = 0;
+        if (!parseByteSize(size, bytes)) {
+            std::cout << "Usage: .cache size <bytes>[KB|MB|GB]\n";
+            return;
+        }
+        cache_.setCapacity(bytes);
+        std::cout << "Result cache limit set to " << formatBytes(bytes) << ".\n";
+    }
+    else if (action == "clear") {
+        cache_.clear();
+        std::cout << "Result cache cleared.\n";
+    }
+    else if (action == "reset") {
+        cache_.resetStats();
+        std::cout << "Result cache statistics reset.\n";
+    }
+    else {
+        std::cout << "Usage: .cache [on | off | size <bytes> | clear | reset]\n";
+    }
+}
+
+// CREATE MATERIALIZED VIEW liga a view à tabela base no cache; DROP VIEW desfaz
+void REPL::trackView(const std::vector<lexer::Token>& tokens) {
+    if (tokens.size() < 3) return;
+    if (tokens[0].type == lexer::TokenType::DROP &&
+        (tokens[1].type == lexer::TokenType::VIEW || tokens[1].type == lexer::TokenType::MATERIALIZED)) {
+        std::string view = executor::writtenTable(tokens);
+        if (!view.empty()) cache_.removeView(view);
+        return;
+    }
+    if (tokens[0].type != lexer::TokenType::CREATE || tokens[1].type != lexer::TokenType::MATERIALIZED) return;
+    try {
+        executor::ViewDefinition definition = executor::parseMaterializedView(tokens);
+        cache_.addView(definition.name, definition.table);
+    }
+    catch (const std::runtime_error&) {
+        // Definição inválida: não há view para ligar
+    }
+}
+
 void REPL::processSQLCommand(const std::string& sql) {
+    std::vector<lexer::Token> tokens;
+    std::vector<std::string> errors;
+    {
+        metrics::SampledTimer timer(metrics::Histogram::LEX_LATENCY);
+        lexer::Scanner scanner(sql);
+        tokens = scanner.scanTokens();
+        errors = scanner.getErrors();
+    }
+
+    metrics::increment(statementCounter(tokens));
+    metrics::increment(metrics::Counter::TOKENS_SCANNED, tokens.size());
+
+    if (!errors.empty()) {
+        metrics::increment(metrics::Counter::LEX_ERRORS, errors.size());
+        for (const auto& error : errors) {
+            std::cout << "Lexical error: " << error << "\n";
+        }
+        return;
+    }
+
+    // Escritas invalidam o cache da tabela (e das views dela). Sem executor
+    // não há resultado para guardar, então SELECTs ainda não consultam o
+    // cache: lookup() sem store() só contaria misses.
+    std::string written = executor::writtenTable(tokens);
+    if (!written.empty()) cache_.noteWrite(written);
+    trackView(tokens);
+
     std::cout << "SQL Command received: " << sql << "\n";
     std::cout << "(SQL execution not implemented yet)\n";
 }
@@ -122,12 +355,25 @@ void REPL::printHelp() {
     std::cout << "  .quit              Exit the program\n";
     std::cout << "  .tables            List all tables\n";
     std::cout << "  .schema <table>    Show schema of a table\n";
+    std::cout << "  .stats             Show runtime metrics\n";
+    std::cout << "  .stats reset       Reset runtime metrics\n";
+    std::cout << "  .stats prometheus <file>\n";
+    std::cout << "                     Dump metrics in Prometheus text format\n";
+    std::cout << "  .mode [MODE]       Result format: table, csv, tsv or binary\n";
+    std::cout << "  .output [FILE]     Write results to FILE (no argument: stdout)\n";
+    std::cout << "  .cache             Show result cache hit rate and memory use\n";
+    std::cout << "  .cache on|off      Enable or disable the result cache\n";
+    std::cout << "  .cache size N      Result cache limit in bytes (KB/MB suffixes allowed)\n";
+    std::cout << "  .cache clear|reset Drop cached results / reset cache statistics\n";
     std::cout << "\nSQL Commands (in development):\n";
     std::cout << "  CREATE TABLE name (col1 INT, col2 TEXT);\n";
+    std::cout << "  CREATE TABLE name (id INT PRIMARY KEY, ...) ENGINE = MEMORY;\n";
     std::cout << "  INSERT INTO name VALUES (1, 'text');\n";
     std::cout << "  SELECT * FROM name;\n";
     std::cout << "  SELECT col FROM name WHERE col = value;\n";
     std::cout << "  DELETE FROM name WHERE col = value;\n";
+    std::cout << "  ANALYZE name;\n";
+    std::cout << "  CREATE MATERIALIZED VIEW v AS SELECT col, COUNT(*), SUM(x) FROM name GROUP BY col;\n";
     std::cout << "\nNote: SQL commands must end with semicolon (;)\n\n";
 }
 
@@ -0,0 +1,316 @@
+#include "shell/result_writer.h"
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <cstring>
+#include <stdexcept>
+
+namespace miniql {
+
+namespace {
+
+// Bytes acumulados antes de cada fwrite
+constexpr size_t FLUSH_THRESHOLD = 1 << 20;
+
+constexpr char BINARY_MAGIC[] = {'M', 'Q', 'L', 'R'};
+constexpr uint8_t BINARY_VERSION = 1;
+constexpr uint8_t BINARY_ROW = 0x01;
+constexpr uint8_t BINARY_END = 0x00;
+
+void appendInt(std::string& dst, int64_t value) {
+    char buf[24];
+    auto result = std::to_chars(buf, buf + sizeof(buf), value);
+    dst.append(buf, result.ptr);
+}
+
+void appendReal(std::string& dst, double value) {
+    char buf[32];
+    auto result = std::to_chars(buf, buf + sizeof(buf), value);
+    dst.append(buf, result.ptr);
+}
+
+// Representação textual usada por TABLE/CSV/TSV (texto sem aspas)
+void appendDisplay(std::string& dst, const Value& value, const char* null_text) {
+    switch (value.kind()) {
+        case Value::Kind::NULL_VALUE: dst += null_text; break;
+        case Value::Kind::INTEGER: appendInt(dst, value.intValue()); break;
+        case Value::Kind::REAL: appendReal(dst, value.realValue()); break;
+        default: dst += value.asText(); break;
+    }
+}
+
+void appendLittleEndian(std::string& dst, uint64_t value, size_t bytes) {
+    for (size_t i = 0; i < bytes; i++) {
+        dst.push_back(static_cast<char>((value >> (8 * i)) & 0xff));
+    }
+}
+
+} // namespace
+
+bool parseOutputMode(const std::string& name, OutputMode& mode) {
+    if (name == "table") mode = OutputMode::TABLE;
+    else if (name == "csv") mode = OutputMode::CSV;
+    else if (name == "tsv") mode = OutputMode::TSV;
+    else if (name == "binary") mode = OutputMode::BINARY;
+    else return false;
+    return true;
+}
+
+std::string outputModeToString(OutputMode mode) {
+    switch (mode) {
+        case OutputMode::TABLE: return "table";
+        case OutputMode::CSV: return "csv";
+        case OutputMode::TSV: return "tsv";
+        case OutputMode::BINARY: return "binary";
+        default: return "unknown";
+    }
+}
+
+// ============================================================================
+// CONSTRUTOR E DESTINO
+// ============================================================================
+
+ResultWriter::ResultWriter() : mode_(OutputMode::TABLE), out_(stdout) {
+    buffer_.reserve(FLUSH_THRESHOLD + 4096);
+}
+
+ResultWriter::~ResultWriter() {
+    try {
+        flush();
+    } catch (const std::runtime_error&) {
+        // Destrutor não propaga; write() já reportou o erro
+    }
+    if (out_ != stdout) std::fclose(out_);
+}
+
+bool ResultWriter::setOutput(const std::string& path) {
+    std::FILE* file = stdout;
+    if (!path.empty() && path != "stdout") {
+        file = std::fopen(path.c_str(), "wb");
+        if (!file) return false;
+    }
+
+    // Troca de destino mesmo que o anterior falhe (disco cheio não pode
+    // prender o shell nele); o erro é reportado depois da troca
+    std::string error;
+    try {
+        flush();
+    } catch (const std::runtime_error& e) {
+        error = e.what();
+    }
+    if (out_ != stdout && std::fclose(out_) != 0 && error.empty()) error = writeError(errno);
+    out_ = file;
+    path_ = file == stdout ? "" : path;
+    if (!error.empty()) throw std::runtime_error(error);
+    return true;
+}
+
+void ResultWriter::flushIfFull() {
+    if (buffer_.size() >= FLUSH_THRESHOLD) flush();
+}
+
+void ResultWriter::flush() {
+    int error = 0;
+    if (!buffer_.empty()) {
+        if (std::fwrite(buffer_.data(), 1, buffer_.size(), out_) != buffer_.size()) error = errno;
+        buffer_.clear();
+    }
+    if (std::fflush(out_) != 0 && error == 0) error = errno;
+    if (error != 0) {
+        std::clearerr(out_);
+        throw std::runtime_error(writeError(error));
+    }
+}
+
+std::string ResultWriter::writeError(int error) const {
+    return "Cannot write to " + (path_.empty() ? std::string("stdout") : "'" + path_ + "'") + ": " +
+           std::strerror(error);
+}
+
+// ============================================================================
+// ESCRITA EM LOTES
+// ============================================================================
+
+size_t ResultWriter::write(executor::ResultCursor& cursor, size_t batch_size) {
+    std::vector<Row> batch;
+    batch.reserve(batch_size);
+
+    bool has_rows = cursor.nextBatch(batch, batch_size);
+    std::vector<size_t> widths;
+    writeHeader(cursor.columnNames(), widths, batch);
+
+    size_t rows = 0;
+    while (has_rows) {
+        for (const Row& row : batch) {
+            writeRow(row, widths);
+        }
+        rows += batch.size();
+        flushIfFull();
+        has_rows = cursor.nextBatch(batch, batch_size);
+    }
+
+    writeFooter(rows);
+    flush();
+    return rows;
+}
+
+void ResultWriter::writeHeader(const std::vector<std::string>& columns,
+                               std::vector<size_t>& widths,
+                               const std::vector<Row>& first_batch) {
+    switch (mode_) {
+        case OutputMode::TABLE: {
+            // Larguras calculadas só com o primeiro lote: o resultado inteiro
+            // nunca está em memória; valores maiores apenas desalinham
+            widths.assign(columns.size(), 0);
+            std::string scratch;
+            for (size_t i = 0; i < columns.size(); i++) {
+                widths[i] = columns[i].size();
+                for (const Row& row : first_batch) {
+                    if (i >= row.size()) continue;
+                    scratch.clear();
+                    appendDisplay(scratch, row[i], "NULL");
+                    widths[i] = std::max(widths[i], scratch.size());
+                }
+            }
+            for (size_t i = 0; i < columns.size(); i++) {
+                if (i > 0) buffer_ += " | ";
+                appendPadded(columns[i], widths[i]);
+            }
+            buffer_ += '\n';
+            for (size_t i = 0; i < columns.size(); i++) {
+                if (i > 0) buffer_ += "-+-";
+                buffer_.append(widths[i], '-');
+            }
+            buffer_ += '\n';
+            break;
+        }
+        case OutputMode::CSV:
+        case OutputMode::TSV:
+            for (size_t i = 0; i < columns.size(); i++) {
+                if (i > 0) buffer_ += mode_ == OutputMode::CSV ? ',' : '\t';
+                if (mode_ == OutputMode::CSV) appendCsvField(columns[i]);
+                else appendTsvField(columns[i]);
+            }
+            buffer_ += '\n';
+            break;
+        case OutputMode::BINARY:
+            buffer_.append(BINARY_MAGIC, sizeof(BINARY_MAGIC));
+            buffer_.push_back(static_cast<char>(BINARY_VERSION));
+            appendLittleEndian(buffer_, columns.size(), 4);
+            for (const std::string& name : columns) {
+                appendLittleEndian(buffer_, name.size(), 4);
+                buffer_ += name;
+            }
+            break;
+    }
+}
+
+void ResultWriter::writeRow(const Row& row, const std::vector<size_t>& widths) {
+    switch (mode_) {
+        case OutputMode::TABLE: {
+            std::string scratch;
+            for (size_t i = 0; i < row.size(); i++) {
+                if (i > 0) buffer_ += " | ";
+                scratch.clear();
+                appendDisplay(scratch, row[i], "NULL");
+                appendPadded(scratch, i < widths.size() ? widths[i] : 0);
+            }
+            buffer_ += '\n';
+            break;
+        }
+        case OutputMode::CSV:
+            for (size_t i = 0; i < row.size(); i++) {
+                if (i > 0) buffer_ += ',';
+                if (row[i].kind() == Value::Kind::TEXT) appendCsvField(row[i].asText());
+                else appendDisplay(buffer_, row[i], "");
+            }
+            buffer_ += '\n';
+            break;
+        case OutputMode::TSV:
+            for (size_t i = 0; i < row.size(); i++) {
+                if (i > 0) buffer_ += '\t';
+                if (row[i].kind() == Value::Kind::TEXT) appendTsvField(row[i].asText());
+                else appendDisplay(buffer_, row[i], "\\N");
+            }
+            buffer_ += '\n';
+            break;
+        case OutputMode::BINARY:
+            buffer_.push_back(static_cast<char>(BINARY_ROW));
+            for (const Value& value : row) appendBinaryValue(value);
+            break;
+    }
+}
+
+void ResultWriter::writeFooter(size_t rows) {
+    if (mode_ == OutputMode::TABLE) {
+        buffer_ += '(';
+        appendInt(buffer_, static_cast<int64_t>(rows));
+        buffer_ += rows == 1 ? " row)\n" : " rows)\n";
+    } else if (mode_ == OutputMode::BINARY) {
+        buffer_.push_back(static_cast<char>(BINARY_END));
+    }
+}
+
+// ============================================================================
+// FORMATAÇÃO DE CAMPOS
+// ============================================================================
+
+// RFC 4180: aspas só quando necessário, aspas internas duplicadas. Texto
+// vazio sai como "" para não se confundir com NULL (campo vazio)
+void ResultWriter::appendCsvField(const std::string& text) {
+    if (!text.empty() && text.find_first_of(",\"\r\n") == std::string::npos) {
+        buffer_ += text;
+        return;
+    }
+    buffer_ += '"';
+    for (char c : text) {
+        if (c == '"') buffer_ += '"';
+        buffer_ += c;
+    }
+    buffer_ += '"';
+}
+
+// TSV não tem aspas: tab, quebras de linha e barra viram escapes (NULL é \N)
+void ResultWriter::appendTsvField(const std::string& text) {
+    for (char c : text) {
+        switch (c) {
+            case '\t': buffer_ += "\\t"; break;
+            case '\n': buffer_ += "\\n"; break;
+            case '\r': buffer_ += "\\r"; break;
+            case '\\': buffer_ += "\\\\"; break;
+            default: buffer_ += c; break;
+        }
+    }
+}
+
+void ResultWriter::appendBinaryValue(const Value& value) {
+    switch (value.kind()) {
+        case Value::Kind::NULL_VALUE:
+            buffer_.push_back(0);
+            break;
+        case Value::Kind::INTEGER:
+            buffer_.push_back(1);
+            appendLittleEndian(buffer_, static_cast<uint64_t>(value.intValue()), 8);
+            break;
+        case Value::Kind::REAL: {
+            uint64_t bits;
+            double real = value.realValue();
+            std::memcpy(&bits, &real, sizeof(bits));
+            buffer_.push_back(2);
+            appendLittleEndian(buffer_, bits, 8);
+            break;
+        }
+        default:
+            buffer_.push_back(3);
+            appendLittleEndian(buffer_, value.asText().size(), 4);
+            buffer_ += value.asText();
+            break;
+    }
+}
+
+void ResultWriter::appendPadded(const std::string& text, size_t width) {
+    buffer_ += text;
+    if (text.size() < width) buffer_.append(width - text.size(), ' ');
+}
+
+} // namespace miniql
@@ -0,0 +1,355 @@
+#include "storage/buffer_pool.h"
+#include "metrics/metrics.h"
+#include "storage/wal.h"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace miniql {
+namespace storage {
+
+namespace {
+
+constexpr size_t READAHEAD_TRIGGER = 4;
+constexpr size_t WRITEBACK_BATCH = 64;
+constexpr PageId NO_PAGE = UINT32_MAX;
+
+} // namespace
+
+// ============================================================================
+// PAGE HANDLE
+// ============================================================================
+
+BufferPool::PageHandle::PageHandle(PageHandle&& other) noexcept
+    : pool_(other.pool_), frame_(other.frame_) {
+    other.pool_ = nullptr;
+    other.frame_ = nullptr;
+}
+
+BufferPool::PageHandle& BufferPool::PageHandle::operator=(PageHandle&& other) noexcept {
+    if (this != &other) {
+        if (frame_) pool_->unpin(frame_);
+        pool_ = other.pool_;
+        frame_ = other.frame_;
+        other.pool_ = nullptr;
+        other.frame_ = nullptr;
+    }
+    return *this;
+}
+
+BufferPool::PageHandle::~PageHandle() {
+    if (frame_) pool_->unpin(frame_);
+}
+
+Page& BufferPool::PageHandle::page() { return *frame_->page; }
+
+PageId BufferPool::PageHandle::id() const { return frame_->id; }
+
+std::shared_mutex& BufferPool::PageHandle::latch() { return frame_->latch; }
+
+// ============================================================================
+// POOL
+// ============================================================================
+
+BufferPool::BufferPool(PageFile& file, size_t capacity)
+    : file_(file), wal_(nullptr), clock_hand_(0), readahead_(0), last_fetch_(NO_PAGE), sequential_run_(0),
+      readahead_next_(0), prefetch_in_flight_(0) {
+    if (capacity == 0) capacity = 1;
+    frames_.reserve(capacity);
+    for (size_t i = 0; i < capacity; i++) {
+        auto frame = std::make_unique<Frame>();
+        frame->page = std::make_unique<Page>();
+        frames_.push_back(std::move(frame));
+    }
+    table_.reserve(capacity);
+}
+
+BufferPool::~BufferPool() {
+    // Leituras antecipadas ainda em voo escrevem nos frames
+    std::unique_lock<std::mutex> lock(mutex_);
+    io_done_.wait(lock, [this] { return prefetch_in_flight_ == 0; });
+}
+
+void BufferPool::setReadAhead(size_t pages) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    readahead_ = pages;
+}
+
+PageHandle BufferPool::fetch(PageId id) {
+    PageId readahead_from = 0;
+    PageId readahead_to = 0;
+    PageHandle handle = fetchPage(id, readahead_from, readahead_to);
+    if (readahead_from < readahead_to) readAhead(readahead_from, readahead_to);
+    return handle;
+}
+
+// Com o mutex: atualiza a sequência e decide a próxima janela. O pedido
+// sai quando o leitor chega à metade da janela anterior, para que a
+// próxima já esteja em voo antes de ele alcançar o fim.
+void BufferPool::noteAccess(PageId id, PageId& readahead_from, PageId& readahead_to) {
+    if (readahead_ == 0 || id == last_fetch_) return;
+    sequential_run_ = id == last_fetch_ + 1 ? sequential_run_ + 1 : 0;
+    last_fetch_ = id;
+    if (sequential_run_ + 1 < READAHEAD_TRIGGER) return;
+
+    if (readahead_next_ <= id || readahead_next_ > id + readahead_) readahead_next_ = id + 1;
+    if (readahead_next_ - id > readahead_ / 2) return;
+
+    readahead_from = readahead_next_;
+    readahead_to = id + 1 + static_cast<PageId>(readahead_);
+    readahead_next_ = readahead_to;
+}
+
+PageHandle BufferPool::fetchPage(PageId id, PageId& readahead_from, PageId& readahead_to) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    noteAccess(id, readahead_from, readahead_to);
+
+    for (;;) {
+        auto it = table_.find(id);
+        if (it != table_.end()) {
+            Frame* frame = it->second;
+            if (frame->io) {
+                io_done_.wait(lock);
+                continue;
+            }
+            frame->pins++;
+            frame->referenced = true;
+            metrics::increment(metrics::Counter::BUFFER_POOL_HITS);
+            return PageHandle(this, frame);
+        }
+
+        Frame* victim = findVictim();
+        if (!victim) {
+            bool io_pending = false;
+            for (const auto& frame : frames_) io_pending = io_pending || frame->io;
+            if (io_pending) {
+                io_done_.wait(lock);
+                continue;
+            }
+            throw std::runtime_error("Buffer pool exhausted: all " + std::to_string(frames_.size()) +
+                                     " pages are pinned");
+        }
+
+        if (victim->dirty) {
+            // Sem pin ninguém escreve na página, e io impede novos pins:
+            // dá para gravar direto do frame, fora do mutex
+            victim->io = true;
+            lock.unlock();
+            try {
+                writeBack(victim->id, *victim->page);
+            } catch (...) {
+                lock.lock();
+                victim->io = false;
+                io_done_.notify_all();
+                throw;
+            }
+            lock.lock();
+            victim->dirty = false;
+            victim->rec_lsn = INVALID_LSN;
+            victim->io = false;
+            io_done_.notify_all();
+            continue;   // outra thread pode ter carregado id enquanto isso
+        }
+
+        if (victim->valid) table_.erase(victim->id);
+        victim->id = id;
+        victim->valid = true;
+        victim->io = true;
+        victim->referenced = true;
+        victim->pins = 1;
+        table_[id] = victim;
+        metrics::increment(metrics::Counter::BUFFER_POOL_MISSES);
+
+        lock.unlock();
+        try {
+            file_.read(id, *victim->page);
+        } catch (...) {
+            lock.lock();
+            table_.erase(id);
+            victim->valid = false;
+            victim->io = false;
+            victim->pins = 0;
+            io_done_.notify_all();
+            throw;
+        }
+        lock.lock();
+        victim->io = false;
+        io_done_.notify_all();
+        return PageHandle(this, victim);
+    }
+}
+
+// Submete a leitura de [from, to) sem esperar. Usa só frames limpos: o
+// read-ahead nunca provoca gravação.
+void BufferPool::readAhead(PageId from, PageId to) {
+    to = std::min(to, file_.pageCount());
+    if (from >= to) return;
+
+    std::vector<IoRequest> batch;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        size_t limit = std::max<size_t>(1, frames_.size() / 4);
+        for (PageId id = from; id < to && prefetch_in_flight_ < limit; id++) {
+            if (table_.count(id)) continue;
+            Frame* victim = findVictim(true);
+            if (!victim) break;
+
+            if (victim->valid) table_.erase(victim->id);
+            victim->id = id;
+            victim->valid = true;
+            victim->io = true;
+            victim->referenced = true;
+            victim->pins = 0;
+            table_[id] = victim;
+            prefetch_in_flight_++;
+            batch.push_back(file_.readRequest(id, *victim->page, [this, victim](bool ok) {
+                finishPrefetch(victim, ok);
+            }));
+        }
+    }
+    if (batch.empty()) return;
+
+    metrics::increment(metrics::Counter::PAGES_PREFETCHED, batch.size());
+    file_.io().submit(batch);
+}
+
+void BufferPool::finishPrefetch(Frame* frame, bool ok) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!ok) {
+        // Quem precisar da página lê de novo pelo caminho normal
+        table_.erase(frame->id);
+        frame->valid = false;
+    }
+    frame->io = false;
+    prefetch_in_flight_--;
+    io_done_.notify_all();
+}
+
+// Clock: a primeira passada limpa os bits de referência, a segunda acha a
+// vítima. nullptr se tudo estiver fixado ou em I/O.
+BufferPool::Frame* BufferPool::findVictim(bool clean_only) {
+    for (size_t step = 0; step < 2 * frames_.size(); step++) {
+        Frame* frame = frames_[clock_hand_].get();
+        clock_hand_ = (clock_hand_ + 1) % frames_.size();
+
+        if (!frame->valid) return frame;
+        if (frame->pins > 0 || frame->io || (clean_only && frame->dirty)) continue;
+        if (frame->referenced) {
+            frame->referenced = false;
+            continue;
+        }
+        return frame;
+    }
+    return nullptr;
+}
+
+void BufferPool::unpin(Frame* frame) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    frame->pins--;
+}
+
+void BufferPool::markDirty(PageHandle& handle) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Frame* frame = handle.frame_;
+    if (!frame->dirty) {
+        frame->dirty = true;
+        frame->rec_lsn = wal_ ? wal_->endLsn() : INVALID_LSN;
+    }
+}
+
+std::vector<std::pair<PageId, Lsn>> BufferPool::dirtyPages(Lsn& wal_end) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    wal_end = wal_ ? wal_->endLsn() : INVALID_LSN;
+
+    std::vector<std::pair<PageId, Lsn>> pages;
+    for (const auto& frame : frames_) {
+        if (frame->valid && frame->dirty) pages.emplace_back(frame->id, frame->rec_lsn);
+    }
+    return pages;
+}
+
+void BufferPool::flushPage(PageId id) {
+    flushPages({id});
+}
+
+void BufferPool::flushAll() {
+    Lsn wal_end;
+    std::vector<PageId> ids;
+    for (const auto& entry : dirtyPages(wal_end)) ids.push_back(entry.first);
+    std::sort(ids.begin(), ids.end());
+    flushPages(ids);
+}
+
+void BufferPool::flushPages(const std::vector<PageId>& ids) {
+    std::vector<std::unique_ptr<Page>> copies;
+
+    for (size_t first = 0; first < ids.size(); first += WRITEBACK_BATCH) {
+        size_t last = std::min(ids.size(), first + WRITEBACK_BATCH);
+
+        // Fixa as páginas ainda sujas e residentes do lote
+        std::vector<PageHandle> handles;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            for (size_t i = first; i < last; i++) {
+                for (;;) {
+                    auto it = table_.find(ids[i]);
+                    if (it == table_.end()) break;      // despejada: já foi gravada
+                    Frame* frame = it->second;
+                    if (frame->io) {
+                        io_done_.wait(lock);
+                        continue;
+                    }
+                    if (frame->dirty) {
+                        frame->pins++;
+                        handles.push_back(PageHandle(this, frame));
+                    }
+                    break;
+                }
+            }
+        }
+        if (handles.empty()) continue;
+
+        // Cópias sob latch compartilhado: escritores esperam só pelo
+        // memcpy, não pelo I/O
+        while (copies.size() < handles.size()) copies.push_back(std::make_unique<Page>());
+        std::vector<std::pair<PageId, const Page*>> batch;
+        std::vector<Lsn> copied(handles.size());
+        Lsn max_lsn = INVALID_LSN;
+        for (size_t i = 0; i < handles.size(); i++) {
+            {
+                std::shared_lock<std::shared_mutex> latch(handles[i].latch());
+                std::memcpy(copies[i]->data, handles[i].page().data, PAGE_SIZE);
+            }
+            copied[i] = copies[i]->lsn();
+            max_lsn = std::max(max_lsn, copied[i]);
+            batch.emplace_back(handles[i].id(), copies[i].get());
+        }
+
+        if (wal_ && max_lsn != INVALID_LSN) wal_->flush(max_lsn);
+        file_.writeBatch(batch);
+
+        // Com o latch compartilhado nenhum escritor está no meio do
+        // protocolo, então o LSN da página diz se houve modificação
+        // depois da cópia
+        for (size_t i = 0; i < handles.size(); i++) {
+            std::shared_lock<std::shared_mutex> latch(handles[i].latch());
+            std::lock_guard<std::mutex> lock(mutex_);
+            Frame* frame = handles[i].frame_;
+            if (frame->page->lsn() == copied[i]) {
+                frame->dirty = false;
+                frame->rec_lsn = INVALID_LSN;
+            } else {
+                frame->rec_lsn = copied[i] + 1;
+            }
+        }
+    }
+}
+
+void BufferPool::writeBack(PageId id, const Page& page) {
+    if (wal_ && page.lsn() != INVALID_LSN) wal_->flush(page.lsn());
+    file_.write(id, page);
+}
+
+} // namespace storage
+} // namespace miniql
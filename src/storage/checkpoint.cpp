@@ -0,0 +1,114 @@
+#include "storage/checkpoint.h"
+#include "common/crc32.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <stdexcept>
+#include <unistd.h>
+
+namespace miniql {
+namespace storage {
+
+namespace {
+
+constexpr char CHECKPOINT_MAGIC[8] = {'M', 'Q', 'L', 'C', 'K', 'P', 'T', '1'};
+
+// magic | redo_lsn u64 | checkpoint_lsn u64 | crc32 u32
+constexpr size_t CHECKPOINT_FILE_SIZE = 8 + 8 + 8 + 4;
+
+std::runtime_error ioError(const std::string& what, const std::string& path) {
+    return std::runtime_error(what + " '" + path + "': " + std::strerror(errno));
+}
+
+std::string masterPath(const std::string& dir) { return dir + "/checkpoint"; }
+
+void syncDirectory(const std::string& dir) {
+    int fd = ::open(dir.c_str(), O_RDONLY | O_DIRECTORY);
+    if (fd < 0) throw ioError("Cannot open directory", dir);
+    int rc = ::fsync(fd);
+    ::close(fd);
+    if (rc != 0) throw ioError("Cannot sync directory", dir);
+}
+
+} // namespace
+
+bool readCheckpoint(const std::string& dir, CheckpointInfo& info) {
+    std::string path = masterPath(dir);
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        if (errno == ENOENT) return false;
+        throw ioError("Cannot open checkpoint file", path);
+    }
+
+    char data[CHECKPOINT_FILE_SIZE];
+    ssize_t n = ::pread(fd, data, sizeof(data), 0);
+    ::close(fd);
+    if (n != static_cast<ssize_t>(sizeof(data))) return false;
+    if (std::memcmp(data, CHECKPOINT_MAGIC, sizeof(CHECKPOINT_MAGIC)) != 0) return false;
+
+    uint32_t crc;
+    std::memcpy(&crc, data + 24, sizeof(crc));
+    if (crc32(data, 24) != crc) return false;
+
+    std::memcpy(&info.redo_lsn, data + 8, sizeof(info.redo_lsn));
+    std::memcpy(&info.checkpoint_lsn, data + 16, sizeof(info.checkpoint_lsn));
+    return true;
+}
+
+void writeCheckpoint(const std::string& dir, const CheckpointInfo& info) {
+    char data[CHECKPOINT_FILE_SIZE];
+    std::memcpy(data, CHECKPOINT_MAGIC, sizeof(CHECKPOINT_MAGIC));
+    std::memcpy(data + 8, &info.redo_lsn, sizeof(info.redo_lsn));
+    std::memcpy(data + 16, &info.checkpoint_lsn, sizeof(info.checkpoint_lsn));
+    uint32_t crc = crc32(data, 24);
+    std::memcpy(data + 24, &crc, sizeof(crc));
+
+    std::string path = masterPath(dir);
+    std::string tmp = path + ".tmp";
+    int fd = ::open(tmp.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) throw ioError("Cannot create checkpoint file", tmp);
+    bool ok = ::write(fd, data, sizeof(data)) == static_cast<ssize_t>(sizeof(data)) && ::fsync(fd) == 0;
+    ::close(fd);
+    if (!ok) throw ioError("Cannot write checkpoint file", tmp);
+
+    if (::rename(tmp.c_str(), path.c_str()) != 0) throw ioError("Cannot install checkpoint file", path);
+    syncDirectory(dir);
+}
+
+CheckpointInfo runCheckpoint(BufferPool& pool, Wal& wal, PageFile& file, const std::string& dir,
+                             const std::function<void()>& log_tables) {
+    Lsn wal_end;
+    auto dirty = pool.dirtyPages(wal_end);
+
+    CheckpointInfo info;
+    info.redo_lsn = wal_end;
+    for (const auto& [page, rec_lsn] : dirty) {
+        if (rec_lsn != INVALID_LSN) info.redo_lsn = std::min(info.redo_lsn, rec_lsn);
+    }
+
+    if (log_tables) log_tables();
+
+    // Ordem de página = escrita quase sequencial no arquivo de dados,
+    // submetida em lotes
+    std::sort(dirty.begin(), dirty.end());
+    std::vector<PageId> pages;
+    pages.reserve(dirty.size());
+    for (const auto& entry : dirty) pages.push_back(entry.first);
+    pool.flushPages(pages);
+
+    // Páginas despejadas antes do retrato também podem estar só no cache
+    // do sistema operacional
+    file.sync();
+
+    info.checkpoint_lsn = wal.appendCheckpoint(info.redo_lsn);
+    wal.flush(info.checkpoint_lsn);
+    writeCheckpoint(dir, info);
+
+    // Com o arquivo mestre no lugar, o log antes de redo_lsn não é mais lido
+    if (wal.truncateBefore(info.redo_lsn) > 0) syncDirectory(dir);
+    return info;
+}
+
+} // namespace storage
+} // namespace miniql
@@ -0,0 +1,117 @@
+#include "storage/hash_index.h"
+
+namespace miniql {
+namespace storage {
+
+namespace {
+
+constexpr size_t MIN_CAPACITY = 16;
+
+} // namespace
+
+HashIndex::HashIndex(const std::vector<Row>& rows, size_t column)
+    : rows_(rows), column_(column), mask_(0), used_(0), tombstones_(0), dead_text_(0) {
+    rehash(MIN_CAPACITY);
+}
+
+bool HashIndex::insert(RowId row) {
+    const Value& key = rows_[row][column_];
+    if (key.isNull()) return true;
+
+    // Carga máxima de 70% contando tombstones: sempre sobra slot vazio
+    if ((used_ + tombstones_ + 1) * 10 > slots_.size() * 7) {
+        size_t capacity = slots_.size();
+        while ((used_ + 1) * 10 > capacity * 5) capacity *= 2;
+        rehash(capacity);
+    }
+
+    uint64_t hash = key.hash();
+    size_t target = SIZE_MAX;
+    for (size_t i = hash & mask_;; i = (i + 1) & mask_) {
+        Slot& slot = slots_[i];
+        if (slot.state == EMPTY) {
+            if (target == SIZE_MAX) target = i;
+            break;
+        }
+        if (slot.state == TOMBSTONE) {
+            if (target == SIZE_MAX) target = i;
+        } else if (slot.hash == hash && rows_[slot.row][column_] == key) {
+            return false;
+        }
+    }
+
+    Slot& slot = slots_[target];
+    if (slot.state == TOMBSTONE) tombstones_--;
+    slot.hash = hash;
+    slot.row = row;
+    slot.state = fullState(key);
+    slot.text_offset = 0;
+    slot.text_length = 0;
+    if (slot.state == FULL_TEXT) {
+        const std::string& text = key.asText();
+        slot.text_offset = static_cast<uint32_t>(text_.size());
+        slot.text_length = static_cast<uint32_t>(text.size());
+        text_.insert(text_.end(), text.begin(), text.end());
+    }
+    used_++;
+    return true;
+}
+
+void HashIndex::erase(RowId row) {
+    const Value& key = rows_[row][column_];
+    if (key.isNull()) return;
+
+    uint64_t hash = key.hash();
+    for (size_t i = hash & mask_;; i = (i + 1) & mask_) {
+        Slot& slot = slots_[i];
+        if (slot.state == EMPTY) return;
+        if (slot.state >= FULL && slot.row == row) {
+            dead_text_ += slot.text_length;
+            slot.state = TOMBSTONE;
+            used_--;
+            tombstones_++;
+            return;
+        }
+    }
+}
+
+void HashIndex::clear() {
+    used_ = 0;
+    tombstones_ = 0;
+    slots_.clear();
+    rehash(MIN_CAPACITY);
+}
+
+void HashIndex::reserve(size_t keys) {
+    size_t capacity = slots_.size();
+    while (keys * 10 > capacity * 5) capacity *= 2;
+    if (capacity != slots_.size()) rehash(capacity);
+}
+
+void HashIndex::rehash(size_t capacity) {
+    std::vector<Slot> old;
+    old.swap(slots_);
+    std::vector<char> old_text;
+    old_text.swap(text_);
+    text_.reserve(old_text.size() - dead_text_);
+
+    slots_.assign(capacity, Slot{0, INVALID_ROW, EMPTY, 0, 0});
+    mask_ = capacity - 1;
+    tombstones_ = 0;
+    dead_text_ = 0;
+
+    for (Slot slot : old) {
+        if (slot.state < FULL) continue;
+        if (slot.state == FULL_TEXT) {
+            const char* text = old_text.data() + slot.text_offset;
+            slot.text_offset = static_cast<uint32_t>(text_.size());
+            text_.insert(text_.end(), text, text + slot.text_length);
+        }
+        size_t i = slot.hash & mask_;
+        while (slots_[i].state != EMPTY) i = (i + 1) & mask_;
+        slots_[i] = slot;
+    }
+}
+
+} // namespace storage
+} // namespace miniql
@@ -0,0 +1,496 @@
+#include "storage/io_engine.h"
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cerrno>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <fcntl.h>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <unordered_set>
+#include <unistd.h>
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#define MINIQL_HAVE_IO_URING 1
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
+
+namespace miniql {
+namespace storage {
+
+namespace {
+
+constexpr unsigned MAX_POOL_THREADS = 32;
+
+// Operação bloqueante completa: repete em EINTR e em transferências curtas,
+// começando de already bytes já transferidos
+int64_t performBlocking(const IoRequest& request, size_t already = 0) {
+    if (request.op == IoOp::DATASYNC) return ::fdatasync(request.fd) == 0 ? 0 : -errno;
+
+    char* buffer = static_cast<char*>(request.buffer);
+    size_t done = already;
+    while (done < request.length) {
+        off_t offset = static_cast<off_t>(request.offset + done);
+        ssize_t n = request.op == IoOp::READ ? ::pread(request.fd, buffer + done, request.length - done, offset)
+                                             : ::pwrite(request.fd, buffer + done, request.length - done, offset);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return -errno;
+        }
+        if (n == 0) break;      // fim do arquivo
+        done += static_cast<size_t>(n);
+    }
+    return static_cast<int64_t>(done);
+}
+
+// ============================================================================
+// THREAD POOL (fallback)
+// ============================================================================
+
+class ThreadPoolEngine : public IoEngine {
+public:
+    explicit ThreadPoolEngine(unsigned threads) : stop_(false) {
+        for (unsigned i = 0; i < threads; i++) workers_.emplace_back(&ThreadPoolEngine::run, this);
+    }
+
+    ~ThreadPoolEngine() override {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        ready_.notify_all();
+        for (auto& worker : workers_) worker.join();
+    }
+
+    void submit(std::vector<IoRequest>& batch) override {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (auto& request : batch) queue_.push_back(std::move(request));
+        }
+        if (batch.size() == 1) {
+            ready_.notify_one();
+        } else {
+            ready_.notify_all();
+        }
+        batch.clear();
+    }
+
+    const char* name() const override { return "threads"; }
+    unsigned queueDepth() const override { return static_cast<unsigned>(workers_.size()); }
+
+private:
+    std::vector<std::thread> workers_;
+    std::mutex mutex_;
+    std::condition_variable ready_;
+    std::deque<IoRequest> queue_;
+    bool stop_;
+
+    void run() {
+        for (;;) {
+            IoRequest request;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                ready_.wait(lock, [this] { return stop_ || !queue_.empty(); });
+                if (queue_.empty()) return;     // stop_ e fila vazia
+                request = std::move(queue_.front());
+                queue_.pop_front();
+            }
+            int64_t result = performBlocking(request);
+            if (request.done) request.done(result);
+        }
+    }
+};
+
+// ============================================================================
+// IO_URING (syscalls diretas, sem liburing)
+// ============================================================================
+
+#ifdef MINIQL_HAVE_IO_URING
+
+class UringEngine : public IoEngine {
+public:
+    // nullptr (e error preenchido) se o kernel recusar
+    static std::unique_ptr<UringEngine> open(unsigned entries, std::string& error) {
+        std::unique_ptr<UringEngine> engine(new UringEngine());
+        if (!engine->setup(entries, error)) return nullptr;
+        return engine;
+    }
+
+    ~UringEngine() override {
+        if (reaper_.joinable()) {
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                stopping_ = true;
+                try {
+                    waitForSpace(lock, 0);
+                    pushSqe(nullptr);      // NOP acorda o reaper
+                    enter(1);
+                } catch (const std::exception&) {
+                    // Anel falhou: o reaper já saiu (failPending)
+                }
+            }
+            reaper_.join();
+        }
+        if (sqes_) ::munmap(sqes_, sqes_size_);
+        if (cq_ptr_ && cq_ptr_ != sq_ptr_) ::munmap(cq_ptr_, cq_size_);
+        if (sq_ptr_) ::munmap(sq_ptr_, sq_size_);
+        if (ring_fd_ >= 0) ::close(ring_fd_);
+    }
+
+    // Depois que o reaper falha, lança em vez de enfileirar (ninguém mais
+    // colheria as completions)
+    void submit(std::vector<IoRequest>& batch) override {
+        std::unique_lock<std::mutex> lock(mutex_);
+        checkFailedLocked();
+        unsigned pending = 0;
+        for (auto& request : batch) {
+            pending = waitForSpace(lock, pending);
+            pushSqe(new IoRequest(std::move(request)));
+            pending++;
+        }
+        if (pending > 0) enter(pending);
+        batch.clear();
+    }
+
+    const char* name() const override { return "io_uring"; }
+    unsigned queueDepth() const override { return sq_entries_; }
+
+private:
+    int ring_fd_ = -1;
+    void* sq_ptr_ = nullptr;
+    void* cq_ptr_ = nullptr;
+    size_t sq_size_ = 0;
+    size_t cq_size_ = 0;
+    io_uring_sqe* sqes_ = nullptr;
+    size_t sqes_size_ = 0;
+
+    unsigned* sq_head_ = nullptr;
+    unsigned* sq_tail_ = nullptr;
+    unsigned* sq_mask_ = nullptr;
+    unsigned* sq_array_ = nullptr;
+    unsigned* cq_head_ = nullptr;
+    unsigned* cq_tail_ = nullptr;
+    unsigned* cq_mask_ = nullptr;
+    io_uring_cqe* cqes_ = nullptr;
+    unsigned sq_entries_ = 0;
+    unsigned cq_entries_ = 0;
+
+    std::mutex mutex_;                  // SQ, in_flight_, pending_ e failed_
+    std::condition_variable space_;
+    unsigned in_flight_ = 0;            // <= cq_entries_: a CQ nunca transborda
+    std::unordered_set<IoRequest*> pending_;    // em voo, para failPending
+    int failed_ = 0;                    // errno que derrubou o reaper
+    bool stopping_ = false;
+    std::thread reaper_;
+
+    // Colhidas pelo reaper, completadas fora do lock
+    std::vector<std::pair<IoRequest*, int64_t>> completions_;
+
+    UringEngine() = default;
+
+    bool setup(unsigned entries, std::string& error) {
+        io_uring_params params;
+        std::memset(&params, 0, sizeof(params));
+        ring_fd_ = static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+        if (ring_fd_ < 0) {
+            error = std::strerror(errno);
+            return false;
+        }
+
+        sq_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        cq_size_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+        if (single_mmap) sq_size_ = cq_size_ = std::max(sq_size_, cq_size_);
+
+        sq_ptr_ = ::mmap(nullptr, sq_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_,
+                         IORING_OFF_SQ_RING);
+        if (sq_ptr_ == MAP_FAILED) {
+            sq_ptr_ = nullptr;
+            error = std::strerror(errno);
+            return false;
+        }
+        if (single_mmap) {
+            cq_ptr_ = sq_ptr_;
+        } else {
+            cq_ptr_ = ::mmap(nullptr, cq_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_,
+                             IORING_OFF_CQ_RING);
+            if (cq_ptr_ == MAP_FAILED) {
+                cq_ptr_ = nullptr;
+                error = std::strerror(errno);
+                return false;
+            }
+        }
+        sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+        void* sqes = ::mmap(nullptr, sqes_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_,
+                            IORING_OFF_SQES);
+        if (sqes == MAP_FAILED) {
+            error = std::strerror(errno);
+            return false;
+        }
+        sqes_ = static_cast<io_uring_sqe*>(sqes);
+
+        char* sq = static_cast<char*>(sq_ptr_);
+        char* cq = static_cast<char*>(cq_ptr_);
+        sq_head_ = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+        sq_tail_ = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+        sq_mask_ = reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+        sq_array_ = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+        cq_head_ = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+        cq_tail_ = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+        cq_mask_ = reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+        cqes_ = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+        sq_entries_ = params.sq_entries;
+        cq_entries_ = params.cq_entries;
+
+        reaper_ = std::thread(&UringEngine::reap, this);
+
+        // Kernels anteriores ao 5.6 têm io_uring mas não IORING_OP_READ
+        int null_fd = ::open("/dev/null", O_RDONLY);
+        char byte;
+        IoRequest probe;
+        probe.fd = null_fd;
+        probe.buffer = &byte;
+        probe.length = 1;
+        int64_t result = null_fd >= 0 ? execute(probe) : -EBADF;
+        if (null_fd >= 0) ::close(null_fd);
+        if (result < 0) {
+            error = "IORING_OP_READ not supported (" + ioErrorMessage(result) + ")";
+            return false;
+        }
+        return true;
+    }
+
+    // Espera vaga na SQ e na CQ; submete o que já estiver pendente antes
+    unsigned waitForSpace(std::unique_lock<std::mutex>& lock, unsigned pending) {
+        for (;;) {
+            checkFailedLocked();
+            unsigned head = __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+            bool sq_full = *sq_tail_ - head >= sq_entries_;
+            if (!sq_full && in_flight_ < cq_entries_) return pending;
+            if (pending > 0) {
+                enter(pending);
+                pending = 0;
+                continue;
+            }
+            space_.wait(lock);
+        }
+    }
+
+    // request == nullptr: NOP de parada
+    void pushSqe(IoRequest* request) {
+        unsigned tail = *sq_tail_;
+        unsigned index = tail & *sq_mask_;
+        io_uring_sqe* sqe = &sqes_[index];
+        std::memset(sqe, 0, sizeof(*sqe));
+
+        if (!request) {
+            sqe->opcode = IORING_OP_NOP;
+        } else {
+            sqe->fd = request->fd;
+            switch (request->op) {
+                case IoOp::READ:
+                    sqe->opcode = IORING_OP_READ;
+                    break;
+                case IoOp::WRITE:
+                    sqe->opcode = IORING_OP_WRITE;
+                    break;
+                case IoOp::DATASYNC:
+                    sqe->opcode = IORING_OP_FSYNC;
+                    sqe->fsync_flags = IORING_FSYNC_DATASYNC;
+                    break;
+            }
+            if (request->op != IoOp::DATASYNC) {
+                sqe->addr = reinterpret_cast<uint64_t>(request->buffer);
+                sqe->len = static_cast<uint32_t>(request->length);
+                sqe->off = request->offset;
+            }
+        }
+        sqe->user_data = reinterpret_cast<uint64_t>(request);
+
+        sq_array_[index] = index;
+        __atomic_store_n(sq_tail_, tail + 1, __ATOMIC_RELEASE);
+        in_flight_++;
+        if (request) pending_.insert(request);
+    }
+
+    void checkFailedLocked() const {
+        if (failed_) {
+            throw std::runtime_error(std::string("io_uring engine failed: ") + std::strerror(failed_));
+        }
+    }
+
+    void enter(unsigned count) {
+        while (count > 0) {
+            long submitted = ::syscall(__NR_io_uring_enter, ring_fd_, count, 0, 0, nullptr, 0);
+            if (submitted < 0) {
+                if (errno == EINTR || errno == EAGAIN || errno == EBUSY) continue;
+                throw std::runtime_error(std::string("io_uring_enter failed: ") + std::strerror(errno));
+            }
+            count -= static_cast<unsigned>(submitted);
+        }
+    }
+
+    void reap() {
+        for (;;) {
+            long rc = ::syscall(__NR_io_uring_enter, ring_fd_, 0, 1, IORING_ENTER_GETEVENTS, nullptr, 0);
+            if (rc < 0 && errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+                failPending(errno);
+                return;
+            }
+
+            completions_.clear();
+            unsigned head = *cq_head_;
+            unsigned tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+            while (head != tail) {
+                const io_uring_cqe* cqe = &cqes_[head & *cq_mask_];
+                completions_.emplace_back(reinterpret_cast<IoRequest*>(cqe->user_data), cqe->res);
+                head++;
+            }
+            __atomic_store_n(cq_head_, head, __ATOMIC_RELEASE);
+            if (completions_.empty()) continue;
+
+            bool stop;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                in_flight_ -= static_cast<unsigned>(completions_.size());
+                for (const auto& completion : completions_) {
+                    if (completion.first) pending_.erase(completion.first);
+                }
+                space_.notify_all();
+                stop = stopping_ && in_flight_ == 0;
+            }
+
+            for (auto& [request, result] : completions_) {
+                if (!request) continue;
+                // Transferência curta fora do fim do arquivo: completa na mão
+                if (request->op != IoOp::DATASYNC && result > 0 && static_cast<size_t>(result) < request->length) {
+                    result = performBlocking(*request, static_cast<size_t>(result));
+                }
+                if (request->done) request->done(result);
+                delete request;
+            }
+            if (stop) return;
+        }
+    }
+
+    // io_uring_enter falhou de vez no reaper: sem ele nenhuma completion
+    // seria colhida, então tudo que está em voo completa com -error (quem
+    // espera em execute() recebe o erro em vez de travar) e a engine fica
+    // falha: submit() lança daí em diante.
+    void failPending(int error) {
+        std::vector<IoRequest*> orphans;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            failed_ = error;
+            orphans.assign(pending_.begin(), pending_.end());
+            pending_.clear();
+            in_flight_ = 0;
+            space_.notify_all();
+        }
+        for (IoRequest* request : orphans) {
+            if (request->done) request->done(-error);
+            delete request;
+        }
+    }
+};
+
+#endif // MINIQL_HAVE_IO_URING
+
+} // namespace
+
+// ============================================================================
+// INTERFACE COMUM
+// ============================================================================
+
+std::string ioEngineKindToString(IoEngineKind kind) {
+    switch (kind) {
+        case IoEngineKind::AUTO: return "auto";
+        case IoEngineKind::URING: return "uring";
+        case IoEngineKind::THREAD_POOL: return "threads";
+    }
+    return "unknown";
+}
+
+bool parseIoEngineKind(const std::string& name, IoEngineKind& kind) {
+    std::string lower;
+    for (char c : name) lower += static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+
+    if (lower == "auto") {
+        kind = IoEngineKind::AUTO;
+    } else if (lower == "uring" || lower == "io_uring") {
+        kind = IoEngineKind::URING;
+    } else if (lower == "threads") {
+        kind = IoEngineKind::THREAD_POOL;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+std::string ioErrorMessage(int64_t result) {
+    return result < 0 ? std::strerror(static_cast<int>(-result)) : "short transfer";
+}
+
+int64_t IoEngine::execute(IoRequest request) {
+    std::mutex mutex;
+    std::condition_variable finished;
+    bool done = false;
+    int64_t result = 0;
+
+    request.done = [&](int64_t value) {
+        std::lock_guard<std::mutex> lock(mutex);
+        result = value;
+        done = true;
+        finished.notify_one();
+    };
+    std::vector<IoRequest> batch;
+    batch.push_back(std::move(request));
+    submit(batch);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    finished.wait(lock, [&] { return done; });
+    return result;
+}
+
+std::vector<int64_t> IoEngine::executeBatch(std::vector<IoRequest>& batch) {
+    std::mutex mutex;
+    std::condition_variable finished;
+    size_t remaining = batch.size();
+    std::vector<int64_t> results(batch.size(), 0);
+
+    for (size_t i = 0; i < batch.size(); i++) {
+        batch[i].done = [&, i](int64_t value) {
+            std::lock_guard<std::mutex> lock(mutex);
+            results[i] = value;
+            if (--remaining == 0) finished.notify_one();
+        };
+    }
+    submit(batch);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    finished.wait(lock, [&] { return remaining == 0; });
+    return results;
+}
+
+std::unique_ptr<IoEngine> IoEngine::create(IoEngineKind kind, unsigned queue_depth) {
+    queue_depth = std::max(1u, queue_depth);
+
+    if (kind != IoEngineKind::THREAD_POOL) {
+#ifdef MINIQL_HAVE_IO_URING
+        std::string error;
+        if (auto engine = UringEngine::open(queue_depth, error)) return engine;
+        if (kind == IoEngineKind::URING) throw std::runtime_error("io_uring is not available: " + error);
+#else
+        if (kind == IoEngineKind::URING) throw std::runtime_error("io_uring is not available on this platform");
+#endif
+    }
+    return std::make_unique<ThreadPoolEngine>(std::min(queue_depth, MAX_POOL_THREADS));
+}
+
+} // namespace storage
+} // namespace miniql
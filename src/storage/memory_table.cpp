@@ -0,0 +1,371 @@
+#include "storage/memory_table.h"
+#include <cctype>
+#include <cstring>
+#include <stdexcept>
+
+namespace miniql {
+namespace storage {
+
+namespace {
+
+enum ColumnFlag : uint8_t { FLAG_PRIMARY_KEY = 1, FLAG_UNIQUE = 2, FLAG_NOT_NULL = 4 };
+
+// ============================================================================
+// CODIFICAÇÃO DOS REGISTROS LÓGICOS
+// ============================================================================
+
+template <typename T>
+void put(std::string& out, T value) {
+    out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void putString(std::string& out, const std::string& text) {
+    put<uint32_t>(out, static_cast<uint32_t>(text.size()));
+    out += text;
+}
+
+// Leitura com checagem de limites; registro truncado lança exceção
+class RecordReader {
+public:
+    RecordReader(const char* data, size_t length) : data_(data), end_(data + length) {}
+
+    template <typename T>
+    T get() {
+        need(sizeof(T));
+        T value;
+        std::memcpy(&value, data_, sizeof(T));
+        data_ += sizeof(T);
+        return value;
+    }
+
+    std::string getString() {
+        uint32_t length = get<uint32_t>();
+        need(length);
+        std::string text(data_, length);
+        data_ += length;
+        return text;
+    }
+
+    // Bytes ainda não lidos (a linha, no fim de um ROW_INSERT)
+    const char* position() const { return data_; }
+    size_t remaining() const { return static_cast<size_t>(end_ - data_); }
+
+private:
+    const char* data_;
+    const char* end_;
+
+    void need(size_t length) {
+        if (static_cast<size_t>(end_ - data_) < length) {
+            throw std::runtime_error("Truncated WAL table record");
+        }
+    }
+};
+
+std::string encodeInsert(const std::string& table, RowId id, const RowCodec& codec, const Row& row) {
+    std::string payload;
+    putString(payload, table);
+    put<uint32_t>(payload, id);
+    codec.encode(row, payload);
+    return payload;
+}
+
+std::string encodeDelete(const std::string& table, RowId id) {
+    std::string payload;
+    putString(payload, table);
+    put<uint32_t>(payload, id);
+    return payload;
+}
+
+catalog::TableSchema decodeTableCreate(RecordReader& in, const std::string& name) {
+    catalog::TableSchema schema;
+    schema.name = name;
+    schema.engine = static_cast<catalog::TableEngine>(in.get<uint8_t>());
+
+    uint16_t count = in.get<uint16_t>();
+    for (uint16_t i = 0; i < count; i++) {
+        catalog::Column column;
+        column.name = in.getString();
+        column.type = static_cast<DataType>(in.get<uint8_t>());
+        uint8_t flags = in.get<uint8_t>();
+        column.primary_key = flags & FLAG_PRIMARY_KEY;
+        column.unique = flags & FLAG_UNIQUE;
+        column.not_null = flags & FLAG_NOT_NULL;
+        schema.columns.push_back(column);
+    }
+    return schema;
+}
+
+} // namespace
+
+std::string encodeTableCreate(const catalog::TableSchema& schema) {
+    std::string payload;
+    putString(payload, schema.name);
+    put<uint8_t>(payload, static_cast<uint8_t>(schema.engine));
+    put<uint16_t>(payload, static_cast<uint16_t>(schema.columns.size()));
+    for (const auto& column : schema.columns) {
+        putString(payload, column.name);
+        put<uint8_t>(payload, static_cast<uint8_t>(column.type));
+        put<uint8_t>(payload, static_cast<uint8_t>((column.primary_key ? FLAG_PRIMARY_KEY : 0) |
+                                                   (column.unique ? FLAG_UNIQUE : 0) |
+                                                   (column.not_null ? FLAG_NOT_NULL : 0)));
+    }
+    return payload;
+}
+
+std::string memoryTableKey(const std::string& name) {
+    std::string key;
+    for (char c : name) key += static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    return key;
+}
+
+void redoTableRecord(const WalRecord& record, MemoryTableSet& tables) {
+    RecordReader in(record.bytes, record.length);
+    std::string name = in.getString();
+    std::string key = memoryTableKey(name);
+
+    if (record.type == WalRecordType::TABLE_CREATE) {
+        auto table = std::make_unique<MemoryTable>(decodeTableCreate(in, name), nullptr);
+        table->deferIndexes();
+        tables[key] = std::move(table);
+        return;
+    }
+
+    auto it = tables.find(key);
+    if (it == tables.end()) return;
+
+    RowId id = in.get<uint32_t>();
+    if (record.type == WalRecordType::ROW_INSERT) {
+        it->second->redoInsert(id, it->second->codec().decode(in.position(), in.remaining()));
+    } else if (record.type == WalRecordType::ROW_DELETE) {
+        it->second->redoErase(id);
+    }
+}
+
+// ============================================================================
+// TABELA
+// ============================================================================
+
+MemoryTable::MemoryTable(catalog::TableSchema schema, Wal* wal)
+    : schema_(std::move(schema)), codec_(schema_), wal_(wal), zones_(schema_) {
+    schema_.engine = catalog::TableEngine::MEMORY;
+    indexes_.resize(schema_.columns.size());
+    for (size_t i = 0; i < schema_.columns.size(); i++) {
+        const auto& column = schema_.columns[i];
+        if (column.primary_key || column.unique) indexes_[i] = std::make_unique<HashIndex>(rows_, i);
+    }
+}
+
+RowId MemoryTable::insert(Row row) {
+    if (row.size() != schema_.columns.size()) {
+        throw std::runtime_error("Table " + schema_.name + " has " + std::to_string(schema_.columns.size()) +
+                                 " columns but " + std::to_string(row.size()) + " values were supplied");
+    }
+    codec_.conform(row);
+    for (size_t i = 0; i < row.size(); i++) {
+        const auto& column = schema_.columns[i];
+        if ((column.not_null || column.primary_key) && row[i].isNull()) {
+            throw std::runtime_error("NOT NULL constraint failed: " + schema_.name + "." + column.name);
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    for (const auto& index : indexes_) {
+        if (index && index->find(row[index->column()]) != INVALID_ROW) {
+            throw std::runtime_error("UNIQUE constraint failed: " + schema_.name + "." +
+                                     schema_.columns[index->column()].name);
+        }
+    }
+
+    RowId id = allocate();
+    if (wal_) {
+        try {
+            wal_->appendTableRecord(WalRecordType::ROW_INSERT, encodeInsert(schema_.name, id, codec_, row));
+        } catch (...) {
+            if (id < rows_.size()) free_.push_back(id);
+            throw;
+        }
+    }
+    place(id, std::move(row));
+    return id;
+}
+
+bool MemoryTable::erase(RowId id) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    if (id >= rows_.size() || !live_[id]) return false;
+
+    if (wal_) wal_->appendTableRecord(WalRecordType::ROW_DELETE, encodeDelete(schema_.name, id));
+    remove(id);
+    if (!free_stale_) free_.push_back(id);
+    return true;
+}
+
+bool MemoryTable::read(RowId id, Row& out) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    if (id >= rows_.size() || !live_[id]) return false;
+    out = rows_[id];
+    return true;
+}
+
+bool MemoryTable::lookup(size_t column, const Value& key, Row& out) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    const HashIndex* index = column < indexes_.size() ? indexes_[column].get() : nullptr;
+    RowId id = index ? index->find(key) : INVALID_ROW;
+    if (id == INVALID_ROW) return false;
+    out = rows_[id];
+    return true;
+}
+
+size_t MemoryTable::size() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return count_;
+}
+
+size_t MemoryTable::memoryBytes() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    size_t bytes = rows_.capacity() * sizeof(Row) + live_.capacity() + free_.capacity() * sizeof(RowId);
+    for (const Row& row : rows_) {
+        bytes += row.capacity() * sizeof(Value);
+        for (const Value& value : row) {
+            if (value.kind() == Value::Kind::TEXT) bytes += value.asText().capacity();
+        }
+    }
+    for (const auto& index : indexes_) {
+        if (index) bytes += index->memoryBytes();
+    }
+    return bytes + zones_.memoryBytes();
+}
+
+bool MemoryTable::zoneSummary(size_t block, size_t column, ZoneSummary& out) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    const ZoneSummary* zone = zones_.summary(block, column);
+    if (!zone) return false;
+    out = *zone;
+    return true;
+}
+
+size_t MemoryTable::zoneBlocks() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return zones_.blockCount();
+}
+
+void MemoryTable::addObserver(RowObserver* observer, bool replay) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    for (size_t id = 0; replay && id < rows_.size(); id++) {
+        if (live_[id]) observer->rowInserted(rows_[id]);
+    }
+    observers_.push_back(observer);
+}
+
+void MemoryTable::removeObserver(RowObserver* observer) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    observers_.erase(std::remove(observers_.begin(), observers_.end(), observer), observers_.end());
+}
+
+void MemoryTable::logSnapshot() const {
+    if (!wal_) return;
+
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    wal_->appendTableRecord(WalRecordType::TABLE_CREATE, encodeTableCreate(schema_));
+    for (size_t id = 0; id < rows_.size(); id++) {
+        if (!live_[id]) continue;
+        wal_->appendTableRecord(WalRecordType::ROW_INSERT,
+                                encodeInsert(schema_.name, static_cast<RowId>(id), codec_, rows_[id]));
+    }
+}
+
+void MemoryTable::redoInsert(RowId id, Row row) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    if (id < rows_.size() && live_[id]) remove(id);
+    place(id, std::move(row));
+    free_stale_ = true;
+}
+
+void MemoryTable::redoErase(RowId id) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    if (id < rows_.size() && live_[id]) remove(id);
+    free_stale_ = true;
+}
+
+void MemoryTable::clear() {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    for (RowObserver* observer : observers_) {
+        for (size_t id = 0; id < rows_.size(); id++) {
+            if (live_[id]) observer->rowErased(rows_[id]);
+        }
+    }
+    for (auto& index : indexes_) {
+        if (index) index->clear();
+    }
+    zones_.clear();
+    rows_.clear();
+    live_.clear();
+    free_.clear();
+    free_stale_ = false;
+    count_ = 0;
+}
+
+void MemoryTable::deferIndexes() {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    indexes_deferred_ = true;
+}
+
+void MemoryTable::buildIndexes() {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    if (!indexes_deferred_) return;
+    for (auto& index : indexes_) {
+        if (!index) continue;
+        index->clear();
+        index->reserve(count_);
+        for (size_t id = 0; id < rows_.size(); id++) {
+            if (live_[id]) index->insert(static_cast<RowId>(id));
+        }
+    }
+    indexes_deferred_ = false;
+}
+
+RowId MemoryTable::allocate() {
+    if (free_stale_) {
+        free_.clear();
+        for (size_t id = rows_.size(); id-- > 0;) {
+            if (!live_[id]) free_.push_back(static_cast<RowId>(id));
+        }
+        free_stale_ = false;
+    }
+    if (!free_.empty()) {
+        RowId id = free_.back();
+        free_.pop_back();
+        return id;
+    }
+    if (rows_.size() >= INVALID_ROW) throw std::runtime_error("Table " + schema_.name + " is full");
+    return static_cast<RowId>(rows_.size());
+}
+
+void MemoryTable::place(RowId id, Row row) {
+    if (id >= rows_.size()) {
+        rows_.resize(static_cast<size_t>(id) + 1);
+        live_.resize(static_cast<size_t>(id) + 1, 0);
+    }
+    rows_[id] = std::move(row);
+    live_[id] = 1;
+    count_++;
+    for (auto& index : indexes_) {
+        if (index && !indexes_deferred_) index->insert(id);
+    }
+    zones_.insert(id, rows_[id]);
+    for (RowObserver* observer : observers_) observer->rowInserted(rows_[id]);
+}
+
+void MemoryTable::remove(RowId id) {
+    for (RowObserver* observer : observers_) observer->rowErased(rows_[id]);
+    for (auto& index : indexes_) {
+        if (index && !indexes_deferred_) index->erase(id);
+    }
+    Row removed = std::move(rows_[id]);
+    rows_[id] = Row();
+    live_[id] = 0;
+    count_--;
+    zones_.erase(id, removed, rows_, live_);
+}
+
+} // namespace storage
+} // namespace miniql
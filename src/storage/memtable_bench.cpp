@@ -0,0 +1,300 @@
+#include "lexer/scanner.h"
+#include "metrics/metrics.h"
+#include "storage/storage_manager.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <random>
+#include <thread>
+#include <vector>
+
+// Benchmark de busca pontual nas tabelas ENGINE = MEMORY.
+// Uso: ./memtable_bench [linhas] [buscas]
+//
+// Compara o HashIndex com uma árvore ordenada em memória (std::map, o
+// custo de descer uma árvore sem I/O) e com a leitura de uma página já
+// residente no buffer pool. Depois fecha e reabre o diretório para
+// conferir que a tabela volta inteira só a partir do WAL.
+//
+// Também mede o custo das métricas de runtime: os mesmos laços com o
+// registro ligado e desligado (metrics::setEnabled). Com
+// `make run-memtable-bench TRACK_ALLOCATIONS=1` inclui a contagem no
+// operator new, exercitada pela cópia de linhas com TEXT.
+
+using namespace miniql;
+using namespace miniql::storage;
+namespace fs = std::filesystem;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Percentis por lote: ler o relógio a cada busca custaria mais que a busca
+constexpr size_t SAMPLE_BATCH = 32;
+constexpr size_t SAMPLED_BATCHES = 20000;
+
+std::string tokenFor(int64_t id) {
+    return "tok-" + std::to_string(mixHash(static_cast<uint64_t>(id)) % 1000000007ull) + "-" + std::to_string(id);
+}
+
+struct Result {
+    double avg_ns;
+    double p50_ns;
+    double p99_ns;
+};
+
+// Média por todas as buscas; percentis da média de lotes de SAMPLE_BATCH
+template <typename Fn>
+Result measure(size_t lookups, Fn&& fn, uint64_t& sink) {
+    auto start = Clock::now();
+    for (size_t i = 0; i < lookups; i++) sink += fn(i);
+    double total = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+
+    std::vector<double> samples;
+    samples.reserve(SAMPLED_BATCHES);
+    for (size_t b = 0; b < SAMPLED_BATCHES; b++) {
+        size_t first = b * 7919 % lookups;
+        auto t0 = Clock::now();
+        for (size_t i = 0; i < SAMPLE_BATCH; i++) sink += fn((first + i) % lookups);
+        samples.push_back(std::chrono::duration<double, std::nano>(Clock::now() - t0).count() / SAMPLE_BATCH);
+    }
+    std::sort(samples.begin(), samples.end());
+    return {total / lookups, samples[samples.size() / 2], samples[samples.size() * 99 / 100]};
+}
+
+void report(const std::string& name, const Result& r) {
+    std::cout << std::left << std::setw(40) << name << std::right << std::fixed << std::setprecision(1)
+              << std::setw(10) << r.avg_ns << std::setw(10) << r.p50_ns << std::setw(10) << r.p99_ns << "\n";
+}
+
+// Pares de rodadas com métricas desligadas e ligadas, em ordem ABBA (nenhum
+// lado roda sempre primeiro); o delta é a mediana dos deltas dos pares, que
+// descarta os pares atingidos por interferência do sistema. Os tempos são o
+// menor de cada lado.
+constexpr int OVERHEAD_ROUNDS = 31;
+constexpr size_t OVERHEAD_KEYS = 1024;     // conjunto pequeno: laço no cache, pouco ruído
+
+template <typename Fn>
+double reportOverhead(const std::string& name, size_t ops, Fn&& fn, uint64_t& sink) {
+    double best[2] = {1e300, 1e300};     // [0] desligado, [1] ligado
+    std::vector<double> deltas;
+    for (int pair = 0; pair < OVERHEAD_ROUNDS; pair++) {
+        double ns[2];
+        for (int half = 0; half < 2; half++) {
+            bool on = (half == 1) != (pair % 2 == 1);
+            metrics::setEnabled(on);
+            auto start = Clock::now();
+            for (size_t i = 0; i < ops; i++) sink += fn(i);
+            ns[on] = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / ops;
+            best[on] = std::min(best[on], ns[on]);
+        }
+        deltas.push_back((ns[1] - ns[0]) / ns[0]);
+    }
+    metrics::setEnabled(true);
+    std::nth_element(deltas.begin(), deltas.begin() + deltas.size() / 2, deltas.end());
+    std::cout << std::left << std::setw(40) << name << std::right << std::fixed << std::setprecision(1)
+              << std::setw(10) << best[0] << std::setw(10) << best[1] << std::setw(9) << std::showpos
+              << std::setprecision(2) << 100.0 * deltas[deltas.size() / 2] << std::noshowpos << "%\n";
+    return best[0];
+}
+
+// Mesmo registro que o REPL faz por statement (REPL::processSQLCommand)
+size_t lexStatement(const std::string& sql) {
+    metrics::SampledTimer timer(metrics::Histogram::LEX_LATENCY);
+    lexer::Scanner scanner(sql);
+    std::vector<lexer::Token> tokens = scanner.scanTokens();
+    metrics::increment(metrics::Counter::STMT_SELECT);
+    metrics::increment(metrics::Counter::TOKENS_SCANNED, tokens.size());
+    return tokens.size();
+}
+
+catalog::TableSchema sessionsSchema() {
+    catalog::TableSchema schema;
+    schema.name = "sessions";
+    schema.engine = catalog::TableEngine::MEMORY;
+    schema.columns = {
+        {"id", DataType::INT},
+        {"token", DataType::TEXT},
+        {"user_id", DataType::INT},
+        {"score", DataType::REAL},
+    };
+    schema.columns[0].primary_key = true;
+    schema.columns[1].unique = true;
+    schema.columns[1].not_null = true;
+    return schema;
+}
+
+StorageOptions benchOptions() {
+    StorageOptions options;
+    options.background_checkpoints = false;
+    return options;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    size_t row_count = argc > 1 ? std::stoul(argv[1]) : 100000;
+    size_t lookups = argc > 2 ? std::stoul(argv[2]) : 1000000;
+
+    char dir_template[] = "/tmp/miniql_memtable_bench_XXXXXX";
+    if (!::mkdtemp(dir_template)) {
+        std::cerr << "Cannot create temporary directory" << std::endl;
+        return 1;
+    }
+    std::string dir = dir_template;
+
+    std::mt19937_64 rng(42);
+    std::vector<int64_t> ids(row_count);
+    for (size_t i = 0; i < row_count; i++) ids[i] = static_cast<int64_t>(i) * 3 + 1;
+
+    std::vector<Value> int_keys(lookups);
+    std::vector<Value> text_keys(lookups);
+    std::vector<Value> missing_keys(lookups);
+    for (size_t i = 0; i < lookups; i++) {
+        int64_t id = ids[rng() % row_count];
+        int_keys[i] = Value::integer(id);
+        text_keys[i] = Value::text(tokenFor(id));
+        missing_keys[i] = Value::integer(id + 1);      // ids são 1 mod 3
+    }
+
+    uint64_t sink = 0;
+    bool ok = true;
+    {
+        StorageManager storage(dir, benchOptions());
+        MemoryTable& table = storage.createMemoryTable(sessionsSchema());
+
+        auto start = Clock::now();
+        for (int64_t id : ids) {
+            table.insert({Value::integer(id), Value::text(tokenFor(id)), Value::integer(id % 1000),
+                          Value::real(static_cast<double>(id) / 7.0)});
+        }
+        storage.commit();
+        double insert_ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+        std::cout << "Point lookups: " << row_count << " rows, " << lookups << " lookups, table "
+                  << table.memoryBytes() / 1024 << " KB\n";
+        std::cout << "Inserts (WAL + hash indexes): " << std::fixed << std::setprecision(1) << insert_ms
+                  << " ms, " << (insert_ms * 1e6 / row_count) << " ns/row\n\n";
+        std::cout << std::left << std::setw(40) << "lookup" << std::right << std::setw(10) << "avg ns"
+                  << std::setw(10) << "p50 ns" << std::setw(10) << "p99 ns" << "\n";
+
+        report("hash index, INT primary key", measure(lookups, [&](size_t i) {
+            return table.find(0, int_keys[i]);
+        }, sink));
+        report("hash index, TEXT unique", measure(lookups, [&](size_t i) {
+            return table.find(1, text_keys[i]);
+        }, sink));
+        report("hash index, INT miss", measure(lookups, [&](size_t i) {
+            return table.find(0, missing_keys[i]);
+        }, sink));
+        Row row;
+        report("hash index + row copy", measure(lookups, [&](size_t i) {
+            return table.lookup(0, int_keys[i], row) ? row.size() : 0;
+        }, sink));
+
+        std::map<int64_t, RowId> tree;
+        for (size_t i = 0; i < row_count; i++) tree.emplace(ids[i], static_cast<RowId>(i));
+        report("ordered tree (std::map), INT", measure(lookups, [&](size_t i) {
+            auto it = tree.find(int_keys[i].intValue());
+            return it == tree.end() ? INVALID_ROW : it->second;
+        }, sink));
+
+        // Uma página por chave, todas já no buffer pool
+        PageId pages = static_cast<PageId>(std::min<size_t>(row_count, storage.bufferPool().capacity() / 2));
+        char probe[16];
+        for (PageId p = 0; p < pages; p++) storage.read(p, 0, probe, sizeof(probe));
+        report("buffer pool page read (hit)", measure(lookups, [&](size_t i) {
+            storage.read(static_cast<PageId>(int_keys[i].intValue() % pages), 0, probe, sizeof(probe));
+            return static_cast<uint64_t>(probe[0]);
+        }, sink));
+
+        // Custo das métricas: mesmos laços com o registro desligado e ligado
+        const std::string statements[] = {
+            "SELECT id, token FROM sessions WHERE id = 42;",
+            "SELECT user_id, COUNT(*) FROM sessions WHERE score > 10.5 GROUP BY user_id ORDER BY user_id;",
+            "INSERT INTO sessions VALUES (7, 'tok-7', 3, 1.25);",
+            "UPDATE sessions SET score = score * 2 WHERE token = 'tok-123' AND user_id <> 0;",
+        };
+#ifdef MINIQL_TRACK_ALLOCATIONS
+        const char* tracking = "on";
+#else
+        const char* tracking = "off (TRACK_ALLOCATIONS=1 to include)";
+#endif
+        std::cout << "\nMetrics overhead (allocation tracking " << tracking << ")\n";
+#ifdef MINIQL_TRACK_ALLOCATIONS
+        // Uma thread que só aloca (nunca incrementa um contador) também conta
+        {
+            uint64_t before = metrics::snapshot().counter(metrics::Counter::ALLOCATIONS);
+            std::thread([&sink] {
+                std::vector<std::string> strings;
+                for (int i = 0; i < 1000; i++) strings.emplace_back(64, 'x');
+                sink += strings.size();
+            }).join();
+            uint64_t counted = metrics::snapshot().counter(metrics::Counter::ALLOCATIONS) - before;
+            ok = ok && counted >= 1000;
+            std::cout << "allocation-only thread: " << counted << " allocations counted (>= 1000 expected)\n";
+        }
+#endif
+        std::cout << std::left << std::setw(40) << "operation" << std::right << std::setw(10) << "off ns"
+                  << std::setw(10) << "on ns" << std::setw(10) << "delta" << "\n";
+        reportOverhead("buffer pool page read (hit)", lookups / 4, [&](size_t i) {
+            storage.read(static_cast<PageId>(int_keys[i % OVERHEAD_KEYS].intValue() % pages), 0, probe,
+                         sizeof(probe));
+            return static_cast<uint64_t>(probe[0]);
+        }, sink);
+        reportOverhead("hash index + row copy (allocates)", lookups / 4, [&](size_t i) {
+            return table.lookup(1, text_keys[i % OVERHEAD_KEYS], row) ? row[1].asText().size() : 0;
+        }, sink);
+        double lex_ns = reportOverhead("lex statement + REPL metrics", lookups / 40, [&](size_t i) {
+            return lexStatement(statements[i % 4]);
+        }, sink);
+
+        // O delta do lexer fica dentro do ruído desta medida; o registro
+        // sozinho (o que o REPL faz por statement, sem o lexer) é estável
+        double metrics_ns = 1e300;
+        for (int round = 0; round < OVERHEAD_ROUNDS; round++) {
+            size_t ops = lookups / 4;
+            auto start = Clock::now();
+            for (size_t i = 0; i < ops; i++) {
+                metrics::SampledTimer timer(metrics::Histogram::LEX_LATENCY);
+                metrics::increment(metrics::Counter::STMT_SELECT);
+                metrics::increment(metrics::Counter::TOKENS_SCANNED, i & 15);
+            }
+            metrics_ns = std::min(metrics_ns, std::chrono::duration<double, std::nano>(Clock::now() - start).count() /
+                                                  static_cast<double>(ops));
+        }
+        std::cout << "REPL metrics alone: " << std::fixed << std::setprecision(1) << metrics_ns
+                  << " ns per statement = " << std::setprecision(2) << 100.0 * metrics_ns / lex_ns
+                  << "% of lexing (budget 1%)\n";
+
+        for (size_t i = 0; i < lookups; i += lookups / 1000 + 1) {
+            ok = ok && table.find(0, int_keys[i]) == table.find(1, text_keys[i]);
+            ok = ok && table.find(0, missing_keys[i]) == INVALID_ROW;
+        }
+    }
+
+    // Reabre: a tabela volta do WAL (snapshot do checkpoint ao fechar)
+    {
+        auto start = Clock::now();
+        StorageManager storage(dir, benchOptions());
+        double open_ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+        MemoryTable* table = storage.memoryTable("sessions");
+        ok = ok && table && table->size() == row_count;
+        for (size_t i = 0; ok && i < lookups; i += lookups / 1000 + 1) {
+            Row row;
+            ok = table->lookup(1, text_keys[i], row) && row[0] == int_keys[i];
+        }
+        std::cout << "\nReopen: " << (table ? table->size() : 0) << " rows rebuilt from "
+                  << storage.recoveryStats().table_records << " WAL records in " << std::fixed
+                  << std::setprecision(1) << open_ms << " ms\n";
+    }
+
+    fs::remove_all(dir);
+    std::cout << (ok ? "Lookups verified" : "MISMATCH") << " (checksum " << sink % 1000 << ")\n";
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,110 @@
+#include "storage/page_file.h"
+#include "metrics/metrics.h"
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <stdexcept>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace miniql {
+namespace storage {
+
+namespace {
+
+std::runtime_error ioError(const std::string& what, const std::string& path) {
+    return std::runtime_error(what + " '" + path + "': " + std::strerror(errno));
+}
+
+std::runtime_error ioError(const std::string& what, const std::string& path, int64_t result) {
+    return std::runtime_error(what + " '" + path + "': " + ioErrorMessage(result));
+}
+
+IoRequest pageRequest(IoOp op, int fd, PageId id, const Page& page) {
+    IoRequest request;
+    request.op = op;
+    request.fd = fd;
+    request.buffer = const_cast<char*>(page.data);
+    request.length = PAGE_SIZE;
+    request.offset = static_cast<uint64_t>(id) * PAGE_SIZE;
+    return request;
+}
+
+// Leitura curta = fim do arquivo: completa com zeros
+bool finishRead(Page& page, int64_t result) {
+    if (result < 0) return false;
+    if (result < static_cast<int64_t>(PAGE_SIZE)) {
+        std::memset(page.data + result, 0, PAGE_SIZE - static_cast<size_t>(result));
+    }
+    return true;
+}
+
+} // namespace
+
+PageFile::PageFile(const std::string& path, IoEngine& io, bool direct)
+    : path_(path), io_(io), fd_(-1), direct_(false) {
+#ifdef O_DIRECT
+    if (direct) {
+        fd_ = ::open(path.c_str(), O_RDWR | O_CREAT | O_DIRECT, 0644);
+        direct_ = fd_ >= 0;
+        if (fd_ < 0 && errno != EINVAL) throw ioError("Cannot open data file", path);
+    }
+#else
+    (void)direct;
+#endif
+    if (fd_ < 0) fd_ = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (fd_ < 0) throw ioError("Cannot open data file", path);
+}
+
+PageFile::~PageFile() {
+    if (fd_ >= 0) ::close(fd_);
+}
+
+void PageFile::read(PageId id, Page& page) {
+    int64_t result = io_.execute(pageRequest(IoOp::READ, fd_, id, page));
+    if (!finishRead(page, result)) throw ioError("Cannot read page from", path_, result);
+}
+
+void PageFile::write(PageId id, const Page& page) {
+    int64_t result = io_.execute(pageRequest(IoOp::WRITE, fd_, id, page));
+    if (result != static_cast<int64_t>(PAGE_SIZE)) throw ioError("Cannot write page to", path_, result);
+    metrics::increment(metrics::Counter::PAGES_WRITTEN);
+}
+
+IoRequest PageFile::readRequest(PageId id, Page& page, std::function<void(bool ok)> done) {
+    IoRequest request = pageRequest(IoOp::READ, fd_, id, page);
+    Page* target = &page;
+    request.done = [target, done = std::move(done)](int64_t result) { done(finishRead(*target, result)); };
+    return request;
+}
+
+void PageFile::writeBatch(const std::vector<std::pair<PageId, const Page*>>& pages) {
+    if (pages.empty()) return;
+
+    std::vector<IoRequest> batch;
+    batch.reserve(pages.size());
+    for (const auto& [id, page] : pages) batch.push_back(pageRequest(IoOp::WRITE, fd_, id, *page));
+
+    std::vector<int64_t> results = io_.executeBatch(batch);
+    for (int64_t result : results) {
+        if (result != static_cast<int64_t>(PAGE_SIZE)) throw ioError("Cannot write page to", path_, result);
+    }
+    metrics::increment(metrics::Counter::PAGES_WRITTEN, pages.size());
+}
+
+void PageFile::sync() {
+    IoRequest request;
+    request.op = IoOp::DATASYNC;
+    request.fd = fd_;
+    int64_t result = io_.execute(std::move(request));
+    if (result != 0) throw ioError("Cannot sync", path_, result);
+}
+
+PageId PageFile::pageCount() const {
+    struct stat st;
+    if (::fstat(fd_, &st) != 0) return 0;
+    return static_cast<PageId>((static_cast<uint64_t>(st.st_size) + PAGE_SIZE - 1) / PAGE_SIZE);
+}
+
+} // namespace storage
+} // namespace miniql
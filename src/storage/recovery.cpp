@@ -0,0 +1,156 @@
+#include "storage/recovery.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <exception>
+#include <memory>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace miniql {
+namespace storage {
+
+namespace {
+
+constexpr size_t RECOVERY_BATCH_BYTES = 8 << 20;
+
+// Páginas em memória durante o redo (64 MB), divididas entre as threads;
+// quando o cache de uma thread enche, ela grava tudo de volta
+constexpr size_t REDO_CACHE_PAGES = 16384;
+
+// Cache privado de uma thread de redo: só ela toca nas suas páginas
+struct RedoWorker {
+    std::unordered_map<PageId, std::unique_ptr<Page>> pages;
+    size_t capacity = REDO_CACHE_PAGES;
+    uint64_t applied = 0;
+    uint64_t skipped = 0;
+
+    Page& get(PageFile& file, PageId id) {
+        auto it = pages.find(id);
+        if (it != pages.end()) return *it->second;
+
+        if (pages.size() >= capacity) writeAll(file);
+        auto page = std::make_unique<Page>();
+        file.read(id, *page);
+        return *pages.emplace(id, std::move(page)).first->second;
+    }
+
+    // Um lote só: com io_uring as gravações ficam todas em voo ao mesmo tempo
+    void writeAll(PageFile& file) {
+        std::vector<std::pair<PageId, const Page*>> batch;
+        batch.reserve(pages.size());
+        for (const auto& [id, page] : pages) batch.emplace_back(id, page.get());
+        std::sort(batch.begin(), batch.end());
+        file.writeBatch(batch);
+        pages.clear();
+    }
+};
+
+// Executa fn(0..threads-1) em paralelo e repassa a primeira exceção
+template <typename Fn>
+void parallelFor(size_t threads, Fn fn) {
+    if (threads == 1) {
+        fn(0);
+        return;
+    }
+
+    std::vector<std::exception_ptr> errors(threads);
+    std::vector<std::thread> pool;
+    pool.reserve(threads);
+    for (size_t t = 0; t < threads; t++) {
+        pool.emplace_back([&, t] {
+            try {
+                fn(t);
+            } catch (...) {
+                errors[t] = std::current_exception();
+            }
+        });
+    }
+    for (auto& thread : pool) thread.join();
+    for (const auto& error : errors) {
+        if (error) std::rethrow_exception(error);
+    }
+}
+
+} // namespace
+
+RecoveryStats recover(const std::string& wal_path, PageFile& file, Lsn redo_lsn, size_t threads,
+                      const TableRedoFn& table_redo) {
+    auto start = std::chrono::steady_clock::now();
+
+    if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+
+    RecoveryStats stats;
+    stats.redo_lsn = std::max(redo_lsn, WAL_START_LSN);
+    stats.threads = threads;
+
+    WalReader reader(wal_path, stats.redo_lsn);
+    WalBatch batch;
+    std::vector<WalRecord> records;
+    std::vector<RedoWorker> workers(threads);
+    for (auto& worker : workers) worker.capacity = std::max<size_t>(1, REDO_CACHE_PAGES / threads);
+    Lsn end = reader.position();
+
+    while (reader.nextBatch(batch, RECOVERY_BATCH_BYTES)) {
+        size_t count = batch.size();
+        records.resize(count);
+
+        // Fase 1: CRC
+        std::vector<size_t> first_invalid(threads, count);
+        parallelFor(threads, [&](size_t t) {
+            size_t begin = count * t / threads;
+            size_t limit = count * (t + 1) / threads;
+            for (size_t i = begin; i < limit; i++) {
+                if (!decodeWalRecord(batch.recordAt(i), batch.lengthAt(i), batch.lsnAt(i), records[i])) {
+                    first_invalid[t] = i;
+                    break;
+                }
+            }
+        });
+        size_t valid = *std::min_element(first_invalid.begin(), first_invalid.end());
+
+        for (size_t i = 0; i < valid; i++) {
+            if (!isTableRecord(records[i].type)) continue;
+            stats.table_records++;
+            if (table_redo) table_redo(records[i]);
+        }
+
+        // Fase 2: redo particionado por página
+        parallelFor(threads, [&](size_t t) {
+            RedoWorker& worker = workers[t];
+            for (size_t i = 0; i < valid; i++) {
+                const WalRecord& record = records[i];
+                if (record.type != WalRecordType::PAGE_WRITE || record.page % threads != t) continue;
+
+                Page& page = worker.get(file, record.page);
+                if (page.lsn() < record.lsn) {
+                    std::memcpy(page.payload() + record.offset, record.bytes, record.length);
+                    page.setLsn(record.lsn);
+                    worker.applied++;
+                } else {
+                    worker.skipped++;
+                }
+            }
+        });
+
+        stats.records += valid;
+        end = batch.lsnAt(valid);
+        if (valid < count) break;   // cauda corrompida: o log termina aqui
+    }
+
+    parallelFor(threads, [&](size_t t) { workers[t].writeAll(file); });
+    file.sync();
+
+    for (const auto& worker : workers) {
+        stats.applied += worker.applied;
+        stats.skipped += worker.skipped;
+    }
+    stats.end_lsn = end;
+    stats.log_bytes = end - stats.redo_lsn;
+    stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return stats;
+}
+
+} // namespace storage
+} // namespace miniql
@@ -0,0 +1,405 @@
+#include "storage/storage_manager.h"
+#include <algorithm>
+#include <csignal>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+// Benchmark de recovery com injeção de crash.
+// Uso: ./recovery_bench [tamanhos do log em MB, ex. 16,64,256] [threads, ex. 1,4]
+//
+// Para cada tamanho um processo filho executa uma carga determinística até o
+// WAL atingir o tamanho pedido, faz commit, escreve lixo no fim do log (um
+// registro rasgado), faz mais algumas escritas sem commit e se mata com
+// SIGKILL. O pai copia o diretório para cada número de threads, mede o
+// recovery e confere o conteúdo: tem que ser o estado do commit mais algum
+// prefixo das escritas sem commit.
+//
+// Cada tamanho roda sem checkpoint (redo do log inteiro) e com um checkpoint
+// fuzzy disparado em paralelo com as escritas a 3/4 da carga.
+//
+// Antes disso, injeção de falhas de I/O no WAL: uma escrita que falha ou sai
+// curta não pode deixar buraco no log (o commit seguinte tem que ser
+// recuperável por inteiro) e um fsync que falha inutiliza o WAL. E
+// checkpoints sucessivos têm que manter o wal.log limitado.
+
+using namespace miniql::storage;
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr PageId DATA_PAGES = 8192;         // 32 MB de dados
+constexpr size_t POOL_PAGES = 512;
+constexpr uint64_t UNCOMMITTED_OPS = 32;
+
+uint64_t mix(uint64_t x) {
+    x += 0x9e3779b97f4a7c15ull;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+    return x ^ (x >> 31);
+}
+
+struct Op {
+    PageId page;
+    uint16_t offset;
+    uint16_t length;
+    char bytes[128];
+};
+
+Op makeOp(uint64_t i) {
+    Op op;
+    uint64_t h = mix(i);
+    op.page = static_cast<PageId>(h % DATA_PAGES);
+    op.length = static_cast<uint16_t>(16 + (h >> 20) % 113);
+    op.offset = static_cast<uint16_t>((h >> 32) % (PAGE_PAYLOAD_SIZE - op.length));
+    uint64_t fill = mix(h);
+    for (uint16_t j = 0; j < op.length; j++) {
+        op.bytes[j] = static_cast<char>((fill >> ((j % 8) * 8)) ^ j);
+    }
+    return op;
+}
+
+void applyOp(std::vector<char>& image, const Op& op) {
+    std::memcpy(image.data() + static_cast<size_t>(op.page) * PAGE_PAYLOAD_SIZE + op.offset, op.bytes, op.length);
+}
+
+std::vector<size_t> parseList(const std::string& text) {
+    std::vector<size_t> values;
+    std::stringstream ss(text);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        if (!item.empty()) values.push_back(std::stoul(item));
+    }
+    return values;
+}
+
+StorageOptions benchOptions(size_t recovery_threads) {
+    StorageOptions options;
+    options.buffer_pool_pages = POOL_PAGES;
+    options.recovery_threads = recovery_threads;
+    options.background_checkpoints = false;
+    return options;
+}
+
+// Engine que falha a próxima escrita (-EIO ou curta) ou o próximo fsync
+class FaultyEngine : public IoEngine {
+public:
+    enum class Fault { NONE, WRITE_ERROR, SHORT_WRITE, SYNC_ERROR };
+
+    explicit FaultyEngine(IoEngine& inner) : inner_(inner) {}
+
+    void inject(Fault fault) { fault_ = fault; }
+
+    void submit(std::vector<IoRequest>& batch) override {
+        for (IoRequest& request : batch) {
+            if (fault_ == Fault::WRITE_ERROR && request.op == IoOp::WRITE) {
+                fault_ = Fault::NONE;
+                request.done(-EIO);
+                request.done = nullptr;
+            } else if (fault_ == Fault::SHORT_WRITE && request.op == IoOp::WRITE && request.length > 1) {
+                // Metade chega ao arquivo, como num disco cheio
+                fault_ = Fault::NONE;
+                request.length /= 2;
+            } else if (fault_ == Fault::SYNC_ERROR && request.op == IoOp::DATASYNC) {
+                fault_ = Fault::NONE;
+                request.done(-EIO);
+                request.done = nullptr;
+            }
+        }
+        std::vector<IoRequest> rest;
+        for (IoRequest& request : batch) {
+            if (request.done) rest.push_back(std::move(request));
+        }
+        if (!rest.empty()) inner_.submit(rest);
+    }
+
+    const char* name() const override { return "faulty"; }
+    unsigned queueDepth() const override { return inner_.queueDepth(); }
+
+private:
+    IoEngine& inner_;
+    Fault fault_ = Fault::NONE;
+};
+
+// Registros de tabela com payload "record <i>"; cada falha injetada lança e
+// o commit seguinte tem que deixar o log inteiro legível
+bool checkWalFaults(const fs::path& dir) {
+    using Fault = FaultyEngine::Fault;
+    fs::create_directories(dir);
+    std::string path = (dir / "wal.log").string();
+    std::unique_ptr<IoEngine> real = IoEngine::create(IoEngineKind::AUTO);
+    FaultyEngine engine(*real);
+
+    uint64_t written = 0;
+    bool ok = true;
+    {
+        Wal wal(path, WAL_START_LSN, engine);
+        auto appendSome = [&](int count) {
+            for (int i = 0; i < count; i++) {
+                wal.appendTableRecord(WalRecordType::ROW_INSERT, "record " + std::to_string(written++));
+            }
+        };
+        auto expectThrow = [&](Fault fault, const char* what) {
+            engine.inject(fault);
+            try {
+                wal.flushAll();
+                std::cerr << "FAILED: " << what << " was not reported\n";
+                ok = false;
+            } catch (const std::runtime_error&) {
+            }
+        };
+
+        appendSome(10);
+        wal.flushAll();
+        appendSome(10);
+        expectThrow(Fault::WRITE_ERROR, "failed WAL write");
+        appendSome(10);
+        wal.flushAll();
+        appendSome(10);
+        expectThrow(Fault::SHORT_WRITE, "short WAL write");
+        appendSome(10);
+        wal.flushAll();
+        if (wal.durableLsn() != wal.endLsn()) {
+            std::cerr << "FAILED: commit after a failed write is not durable\n";
+            ok = false;
+        }
+
+        appendSome(1);
+        expectThrow(Fault::SYNC_ERROR, "failed WAL fsync");
+        written--;                  // o registro do fsync que falhou não conta
+        try {
+            wal.appendTableRecord(WalRecordType::ROW_INSERT, "after fsync failure");
+            std::cerr << "FAILED: append after a failed fsync did not throw\n";
+            ok = false;
+        } catch (const std::runtime_error&) {
+        }
+    }
+
+    // Tudo até o último commit bem-sucedido, em ordem e sem buraco
+    WalReader reader(path, WAL_START_LSN);
+    WalBatch batch;
+    uint64_t found = 0;
+    while (reader.nextBatch(batch, 1 << 20)) {
+        for (size_t i = 0; i < batch.size(); i++) {
+            WalRecord record;
+            if (!decodeWalRecord(batch.recordAt(i), batch.lengthAt(i), batch.lsnAt(i), record)) break;
+            std::string payload(record.bytes, record.length);
+            if (found < written && payload != "record " + std::to_string(found)) {
+                std::cerr << "FAILED: WAL record " << found << " is '" << payload << "'\n";
+                ok = false;
+            }
+            found++;
+        }
+    }
+    if (found < written) {
+        std::cerr << "FAILED: only " << found << " of " << written << " committed WAL records are readable\n";
+        ok = false;
+    }
+    std::cout << "WAL fault injection: write error, short write and fsync error; " << found
+              << " records readable after " << written << " committed: " << (ok ? "ok" : "FAILED") << "\n\n";
+    fs::remove_all(dir);
+    return ok;
+}
+
+// Processo filho: carga, commit, cauda rasgada, escritas sem commit, SIGKILL
+[[noreturn]] void runWorkload(const std::string& dir, uint64_t log_bytes, bool fuzzy_checkpoint, int report_fd) {
+    StorageManager storage(dir, benchOptions(1));
+
+    uint64_t ops = 0;
+    std::thread checkpointer;
+    while (storage.wal().endLsn() < log_bytes) {
+        if (fuzzy_checkpoint && !checkpointer.joinable() && storage.wal().endLsn() >= log_bytes / 4 * 3) {
+            checkpointer = std::thread([&storage] { storage.checkpoint(); });
+        }
+        Op op = makeOp(ops++);
+        storage.write(op.page, op.offset, op.bytes, op.length);
+    }
+    if (checkpointer.joinable()) checkpointer.join();
+    storage.commit();
+
+    if (::write(report_fd, &ops, sizeof(ops)) != static_cast<ssize_t>(sizeof(ops))) std::_Exit(2);
+
+    // Registro rasgado: cabeçalho dizendo 200 bytes, só metade escrita
+    char torn[100];
+    std::memset(torn, 0x5a, sizeof(torn));
+    uint32_t length = 200;
+    std::memcpy(torn + 4, &length, sizeof(length));
+    // Depois do commit o fim do arquivo é o fim do log (o offset não é o
+    // LSN se um checkpoint truncou o início)
+    int fd = ::open((dir + "/wal.log").c_str(), O_WRONLY);
+    off_t end = fd < 0 ? -1 : ::lseek(fd, 0, SEEK_END);
+    if (end < 0 || ::pwrite(fd, torn, sizeof(torn), end) < 0) std::_Exit(2);
+    ::fsync(fd);
+    ::close(fd);
+
+    for (uint64_t i = 0; i < UNCOMMITTED_OPS; i++) {
+        Op op = makeOp(ops + i);
+        storage.write(op.page, op.offset, op.bytes, op.length);
+    }
+
+    ::kill(::getpid(), SIGKILL);
+    std::_Exit(3);
+}
+
+// Conteúdo recuperado == commit + prefixo das escritas sem commit?
+bool verify(StorageManager& storage, std::vector<char> expected, uint64_t committed_ops) {
+    std::vector<char> actual(static_cast<size_t>(DATA_PAGES) * PAGE_PAYLOAD_SIZE);
+    for (PageId page = 0; page < DATA_PAGES; page++) {
+        storage.read(page, 0, actual.data() + static_cast<size_t>(page) * PAGE_PAYLOAD_SIZE,
+                     static_cast<uint16_t>(PAGE_PAYLOAD_SIZE));
+    }
+
+    for (uint64_t extra = 0;; extra++) {
+        if (actual == expected) return true;
+        if (extra == UNCOMMITTED_OPS) return false;
+        applyOp(expected, makeOp(committed_ops + extra));
+    }
+}
+
+// Abre (e recupera) a cópia; o StorageManager fecha antes da cópia ser apagada
+bool recoverCopy(const fs::path& dir, size_t threads, const std::vector<char>& expected, uint64_t committed_ops,
+                 RecoveryStats& stats) {
+    StorageManager storage(dir.string(), benchOptions(threads));
+    stats = storage.recoveryStats();
+    return verify(storage, expected, committed_ops);
+}
+
+// Checkpoints sucessivos truncam o WAL: o arquivo fica perto do que o redo
+// lê, não do total escrito, e o recovery a partir do log truncado confere
+bool checkWalTruncation(const fs::path& dir) {
+    constexpr uint64_t ROUND_BYTES = 4 << 20;
+    constexpr int ROUNDS = 8;
+    std::vector<char> expected(static_cast<size_t>(DATA_PAGES) * PAGE_PAYLOAD_SIZE, 0);
+    uint64_t ops = 0;
+    uint64_t written = 0;
+    uint64_t wal_bytes = 0;
+    {
+        StorageOptions options = benchOptions(1);
+        options.checkpoint_on_close = false;
+        StorageManager storage(dir.string(), options);
+        for (int round = 0; round < ROUNDS; round++) {
+            Lsn target = storage.wal().endLsn() + ROUND_BYTES;
+            while (storage.wal().endLsn() < target) {
+                Op op = makeOp(ops++);
+                applyOp(expected, op);
+                storage.write(op.page, op.offset, op.bytes, op.length);
+            }
+            storage.checkpoint();
+        }
+        // Mais uma rodada sem checkpoint: o recovery refaz a partir do log truncado
+        Lsn target = storage.wal().endLsn() + ROUND_BYTES;
+        while (storage.wal().endLsn() < target) {
+            Op op = makeOp(ops++);
+            applyOp(expected, op);
+            storage.write(op.page, op.offset, op.bytes, op.length);
+        }
+        storage.commit();
+        written = storage.wal().endLsn();
+        wal_bytes = fs::file_size(dir / "wal.log");
+    }
+
+    bool bounded = wal_bytes <= 3 * ROUND_BYTES + WAL_TRUNCATE_MIN_BYTES;
+    if (!bounded) {
+        std::cerr << "FAILED: wal.log has " << wal_bytes << " bytes after " << ROUNDS << " checkpoints\n";
+    }
+    RecoveryStats stats;
+    bool recovered = recoverCopy(dir, 1, expected, ops, stats);
+    if (!recovered) std::cerr << "FAILED: recovery from a truncated WAL does not match\n";
+
+    std::cout << "WAL truncation: " << (written >> 20) << " MB logged, wal.log " << std::fixed
+              << std::setprecision(1) << wal_bytes / (1024.0 * 1024.0) << " MB after " << ROUNDS
+              << " checkpoints, redo " << stats.log_bytes / (1024.0 * 1024.0) << " MB: "
+              << (bounded && recovered ? "ok" : "FAILED") << "\n\n";
+    fs::remove_all(dir);
+    return bounded && recovered;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::vector<size_t> sizes_mb = parseList(argc > 1 ? argv[1] : "16,64,256");
+    size_t hardware = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<size_t> thread_counts =
+        parseList(argc > 2 ? argv[2] : "1," + std::to_string(std::max<size_t>(hardware, 4)));
+
+    char base_template[] = "/tmp/miniql_recovery_bench_XXXXXX";
+    if (!::mkdtemp(base_template)) {
+        std::cerr << "Cannot create temporary directory" << std::endl;
+        return 1;
+    }
+    fs::path base(base_template);
+
+    bool all_ok = checkWalFaults(base / "faults");
+    all_ok = checkWalTruncation(base / "truncation") && all_ok;
+
+    std::cout << "Recovery benchmark: " << DATA_PAGES << " pages, buffer pool " << POOL_PAGES
+              << " pages, " << hardware << " hardware threads\n";
+    std::cout << std::left << std::setw(10) << "log MB" << std::setw(12) << "checkpoint" << std::right
+              << std::setw(12) << "redo MB" << std::setw(12) << "records" << std::setw(10) << "threads"
+              << std::setw(14) << "recovery ms" << std::setw(10) << "MB/s" << "  state\n";
+
+    for (size_t size_mb : sizes_mb) {
+        for (bool fuzzy : {false, true}) {
+            fs::path crashed = base / "crashed";
+            fs::remove_all(crashed);
+
+            int report[2];
+            if (::pipe(report) != 0) {
+                std::cerr << "pipe() failed" << std::endl;
+                return 1;
+            }
+            pid_t child = ::fork();
+            if (child == 0) {
+                ::close(report[0]);
+                runWorkload(crashed.string(), static_cast<uint64_t>(size_mb) << 20, fuzzy, report[1]);
+            }
+            ::close(report[1]);
+
+            uint64_t committed_ops = 0;
+            bool reported = ::read(report[0], &committed_ops, sizeof(committed_ops)) ==
+                            static_cast<ssize_t>(sizeof(committed_ops));
+            ::close(report[0]);
+            int status = 0;
+            ::waitpid(child, &status, 0);
+            if (!reported || !WIFSIGNALED(status) || WTERMSIG(status) != SIGKILL) {
+                std::cerr << "Workload process did not crash as expected" << std::endl;
+                return 1;
+            }
+
+            std::vector<char> expected(static_cast<size_t>(DATA_PAGES) * PAGE_PAYLOAD_SIZE, 0);
+            for (uint64_t i = 0; i < committed_ops; i++) applyOp(expected, makeOp(i));
+
+            for (size_t threads : thread_counts) {
+                fs::path copy = base / ("recover_" + std::to_string(threads));
+                fs::remove_all(copy);
+                fs::copy(crashed, copy);
+
+                RecoveryStats stats;
+                bool ok = recoverCopy(copy, threads, expected, committed_ops, stats);
+                all_ok = all_ok && ok;
+
+                double redo_mb = stats.log_bytes / (1024.0 * 1024.0);
+                std::cout << std::left << std::setw(10) << size_mb << std::setw(12) << (fuzzy ? "fuzzy@75%" : "none")
+                          << std::right << std::fixed << std::setprecision(1) << std::setw(12) << redo_mb
+                          << std::setw(12) << stats.records << std::setw(10) << stats.threads
+                          << std::setw(14) << stats.seconds * 1000.0 << std::setw(10)
+                          << (stats.seconds > 0 ? redo_mb / stats.seconds : 0.0) << "  "
+                          << (ok ? "ok" : "MISMATCH") << "\n";
+
+                fs::remove_all(copy);
+            }
+        }
+    }
+
+    fs::remove_all(base);
+    return all_ok ? 0 : 1;
+}
@@ -0,0 +1,267 @@
+#include "storage/row_codec.h"
+#include <cstring>
+#include <stdexcept>
+
+namespace miniql {
+namespace storage {
+
+namespace {
+
+unsigned offsetWidth(size_t var_bytes) {
+    if (var_bytes <= UINT8_MAX) return 1;
+    if (var_bytes <= UINT16_MAX) return 2;
+    return 4;
+}
+
+uint8_t widthCode(unsigned width) { return width == 1 ? 0 : width == 2 ? 1 : 2; }
+
+void putOffset(char* out, size_t offset, unsigned width) {
+    if (width == 1) {
+        *out = static_cast<char>(offset);
+    } else if (width == 2) {
+        uint16_t value = static_cast<uint16_t>(offset);
+        std::memcpy(out, &value, sizeof(value));
+    } else {
+        uint32_t value = static_cast<uint32_t>(offset);
+        std::memcpy(out, &value, sizeof(value));
+    }
+}
+
+const std::string& kindName(const Value& value) {
+    static const std::string NAMES[] = {"NULL", "INTEGER", "REAL", "TEXT"};
+    return NAMES[static_cast<size_t>(value.kind())];
+}
+
+} // namespace
+
+// ============================================================================
+// VARINT
+// ============================================================================
+
+void putVarint(std::string& out, uint64_t value) {
+    while (value >= 0x80) {
+        out += static_cast<char>((value & 0x7f) | 0x80);
+        value >>= 7;
+    }
+    out += static_cast<char>(value);
+}
+
+bool getVarint(const char*& data, const char* end, uint64_t& value) {
+    value = 0;
+    for (unsigned shift = 0; shift < 70 && data < end; shift += 7) {
+        uint8_t byte = static_cast<uint8_t>(*data++);
+        value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+        if (!(byte & 0x80)) return true;
+    }
+    return false;
+}
+
+bool conformValue(DataType type, Value& value) {
+    switch (value.kind()) {
+        case Value::Kind::NULL_VALUE: return true;
+        case Value::Kind::INTEGER:
+            if (type == DataType::REAL) value = Value::real(static_cast<double>(value.intValue()));
+            return type != DataType::TEXT && type != DataType::BLOB;
+        case Value::Kind::REAL: return type == DataType::REAL;
+        case Value::Kind::TEXT: return type == DataType::TEXT || type == DataType::BLOB;
+    }
+    return false;
+}
+
+// ============================================================================
+// CODEC
+// ============================================================================
+
+RowCodec::RowCodec(const catalog::TableSchema& schema) : table_(schema.name) {
+    size_t fixed = 0;
+    for (size_t i = 0; i < schema.columns.size(); i++) {
+        const auto& column = schema.columns[i];
+        Slot slot;
+        slot.type = column.type;
+        if (column.type == DataType::TEXT || column.type == DataType::BLOB) {
+            slot.kind = SlotKind::VAR;
+            slot.index = static_cast<uint32_t>(var_columns_.size());
+            var_columns_.push_back(static_cast<uint32_t>(i));
+        } else {
+            slot.kind = column.type == DataType::REAL ? SlotKind::REAL : SlotKind::INT;
+            slot.index = static_cast<uint32_t>(fixed);
+            fixed += 8;
+            fixed_columns_.push_back(static_cast<uint32_t>(i));
+        }
+        slots_.push_back(slot);
+        names_.push_back(column.name);
+    }
+    bitmap_bytes_ = (slots_.size() + 7) / 8;
+    fixed_bytes_ = fixed;
+    header_bytes_ = 1 + bitmap_bytes_ + fixed_bytes_;
+}
+
+void RowCodec::corrupt(const char* what) {
+    throw std::runtime_error(std::string("Corrupt row: ") + what);
+}
+
+void RowCodec::typeMismatch(size_t column, const Value& value) const {
+    throw std::runtime_error("Type mismatch: " + table_ + "." + names_[column] + " is " +
+                             dataTypeToString(slots_[column].type) + " but got " + kindName(value));
+}
+
+void RowCodec::conform(Row& row) const {
+    for (size_t i = 0; i < row.size() && i < slots_.size(); i++) {
+        if (!conformValue(slots_[i].type, row[i])) typeMismatch(i, row[i]);
+    }
+}
+
+size_t RowCodec::encodedSize(const Row& row) const {
+    size_t var_bytes = 0;
+    for (uint32_t column : var_columns_) {
+        if (row[column].kind() == Value::Kind::TEXT) var_bytes += row[column].asText().size();
+    }
+    return 1 + bitmap_bytes_ + fixed_bytes_ + var_columns_.size() * offsetWidth(var_bytes) + var_bytes;
+}
+
+void RowCodec::encode(const Row& row, std::string& out) const {
+    if (row.size() != slots_.size()) {
+        throw std::runtime_error("Table " + table_ + " has " + std::to_string(slots_.size()) + " columns but " +
+                                 std::to_string(row.size()) + " values were supplied");
+    }
+
+    size_t var_bytes = 0;
+    for (uint32_t column : var_columns_) {
+        const Value& value = row[column];
+        if (value.kind() == Value::Kind::TEXT) var_bytes += value.asText().size();
+        else if (!value.isNull()) typeMismatch(column, value);
+    }
+    if (var_bytes > UINT32_MAX) throw std::runtime_error("Row too large for table " + table_);
+    unsigned width = offsetWidth(var_bytes);
+
+    size_t start = out.size();
+    size_t fixed_at = start + 1 + bitmap_bytes_;
+    size_t offsets_at = fixed_at + fixed_bytes_;
+    out.resize(offsets_at + var_columns_.size() * width, '\0');
+    out[start] = static_cast<char>(widthCode(width));
+
+    for (size_t i = 0; i < row.size(); i++) {
+        if (row[i].isNull()) out[start + 1 + (i >> 3)] |= static_cast<char>(1u << (i & 7));
+    }
+
+    for (uint32_t column : fixed_columns_) {
+        const Value& value = row[column];
+        char* at = &out[fixed_at + slots_[column].index];
+        switch (value.kind()) {
+            case Value::Kind::NULL_VALUE: break;
+            case Value::Kind::INTEGER:
+                if (slots_[column].kind == SlotKind::REAL) {
+                    double real = static_cast<double>(value.intValue());
+                    std::memcpy(at, &real, sizeof(real));
+                } else {
+                    int64_t integer = value.intValue();
+                    std::memcpy(at, &integer, sizeof(integer));
+                }
+                break;
+            case Value::Kind::REAL: {
+                if (slots_[column].kind != SlotKind::REAL) typeMismatch(column, value);
+                double real = value.realValue();
+                std::memcpy(at, &real, sizeof(real));
+                break;
+            }
+            case Value::Kind::TEXT: typeMismatch(column, value);
+        }
+    }
+
+    size_t end = 0;
+    for (size_t slot = 0; slot < var_columns_.size(); slot++) {
+        const Value& value = row[var_columns_[slot]];
+        if (!value.isNull()) {
+            out += value.asText();
+            end += value.asText().size();
+        }
+        putOffset(&out[offsets_at + slot * width], end, width);
+    }
+}
+
+std::string RowCodec::encode(const Row& row) const {
+    std::string out;
+    out.reserve(encodedSize(row));
+    encode(row, out);
+    return out;
+}
+
+void RowCodec::decode(const char* data, size_t length, Row& out) const {
+    RowView row = view(data, length);
+    out.resize(slots_.size());
+    for (size_t i = 0; i < slots_.size(); i++) out[i] = row.value(i);
+}
+
+Row RowCodec::decode(const char* data, size_t length) const {
+    Row row;
+    decode(data, length, row);
+    return row;
+}
+
+Row RowCodec::project(const char* data, size_t length, const std::vector<size_t>& columns) const {
+    RowView row = view(data, length);
+    Row out;
+    out.reserve(columns.size());
+    for (size_t column : columns) {
+        if (column >= slots_.size()) {
+            throw std::runtime_error("Column " + std::to_string(column) + " out of range for table " + table_);
+        }
+        out.push_back(row.value(column));
+    }
+    return out;
+}
+
+void RowCodec::encodeFramed(const Row& row, std::string& out) const {
+    putVarint(out, encodedSize(row));
+    encode(row, out);
+}
+
+// ============================================================================
+// ACESSO POR COLUNA
+// ============================================================================
+
+size_t RowView::offsetAt(size_t slot) const {
+    const char* at = offsets_ + slot * width_;
+    if (width_ == 1) return static_cast<uint8_t>(*at);
+    if (width_ == 2) {
+        uint16_t value;
+        std::memcpy(&value, at, sizeof(value));
+        return value;
+    }
+    uint32_t value;
+    std::memcpy(&value, at, sizeof(value));
+    return value;
+}
+
+int64_t RowView::intAt(size_t column) const {
+    int64_t value;
+    std::memcpy(&value, fixed_ + codec_->slots_[column].index, sizeof(value));
+    return value;
+}
+
+double RowView::realAt(size_t column) const {
+    double value;
+    std::memcpy(&value, fixed_ + codec_->slots_[column].index, sizeof(value));
+    return value;
+}
+
+std::string_view RowView::textAt(size_t column) const {
+    size_t slot = codec_->slots_[column].index;
+    size_t begin = slot == 0 ? 0 : offsetAt(slot - 1);
+    size_t end = offsetAt(slot);
+    if (begin > end || end > var_size_) RowCodec::corrupt("offset out of bounds");
+    return std::string_view(var_ + begin, end - begin);
+}
+
+Value RowView::value(size_t column) const {
+    if (isNull(column)) return Value::null();
+    switch (codec_->slots_[column].kind) {
+        case RowCodec::SlotKind::INT: return Value::integer(intAt(column));
+        case RowCodec::SlotKind::REAL: return Value::real(realAt(column));
+        case RowCodec::SlotKind::VAR: return Value::text(std::string(textAt(column)));
+    }
+    return Value::null();
+}
+
+} // namespace storage
+} // namespace miniql
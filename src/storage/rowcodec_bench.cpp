@@ -0,0 +1,413 @@
+#include "storage/row_codec.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <stdexcept>
+
+// Benchmark e conferência do formato compacto de linha.
+// Uso: ./rowcodec_bench [linhas]
+//
+// Para alguns schemas (misto, só fixas, só texto) gera linhas com NULLs,
+// textos vazios, longos (offsets de 2 e 4 bytes) e inteiros extremos e
+// confere: decode == linha, cada coluna lida pela RowView, projeções,
+// sequência com prefixo varint e que todo prefixo truncado de uma linha é
+// rejeitado com exceção. Qualquer diferença termina com código 1.
+//
+// Depois compara tamanho e velocidade com o formato anterior do WAL (tag
+// u8 por valor, u32 de tamanho por texto, RowSize u32 na frente): encode,
+// decode completo e leitura de uma coluna só.
+
+using namespace miniql;
+using namespace miniql::storage;
+
+namespace {
+
+// ============================================================================
+// FORMATO ANTERIOR (tag por valor), para comparação
+// ============================================================================
+
+enum LegacyTag : uint8_t { TAG_NULL = 0, TAG_INT = 1, TAG_REAL = 2, TAG_TEXT = 3 };
+
+template <typename T>
+void put(std::string& out, T value) {
+    out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+template <typename T>
+T get(const char*& data) {
+    T value;
+    std::memcpy(&value, data, sizeof(T));
+    data += sizeof(T);
+    return value;
+}
+
+void legacyEncode(const Row& row, std::string& out) {
+    size_t start = out.size();
+    put<uint32_t>(out, 0);
+    put<uint16_t>(out, static_cast<uint16_t>(row.size()));
+    for (const Value& value : row) {
+        switch (value.kind()) {
+            case Value::Kind::NULL_VALUE: put<uint8_t>(out, TAG_NULL); break;
+            case Value::Kind::INTEGER: put<uint8_t>(out, TAG_INT); put<int64_t>(out, value.intValue()); break;
+            case Value::Kind::REAL: put<uint8_t>(out, TAG_REAL); put<double>(out, value.realValue()); break;
+            case Value::Kind::TEXT:
+                put<uint8_t>(out, TAG_TEXT);
+                put<uint32_t>(out, static_cast<uint32_t>(value.asText().size()));
+                out += value.asText();
+                break;
+        }
+    }
+    uint32_t size = static_cast<uint32_t>(out.size() - start);
+    std::memcpy(&out[start], &size, sizeof(size));
+}
+
+Value legacyValue(const char*& data) {
+    switch (get<uint8_t>(data)) {
+        case TAG_INT: return Value::integer(get<int64_t>(data));
+        case TAG_REAL: return Value::real(get<double>(data));
+        case TAG_TEXT: {
+            uint32_t length = get<uint32_t>(data);
+            std::string text(data, length);
+            data += length;
+            return Value::text(std::move(text));
+        }
+        default: return Value::null();
+    }
+}
+
+// Coluna k: os k valores anteriores precisam ser percorridos. Devolve o
+// dado cru (inteiro, bits do double ou tamanho do texto), sem alocar.
+uint64_t legacyColumnRaw(const char* data, size_t column) {
+    data += sizeof(uint32_t) + sizeof(uint16_t);
+    for (size_t i = 0; i < column; i++) {
+        switch (get<uint8_t>(data)) {
+            case TAG_INT:
+            case TAG_REAL: data += 8; break;
+            case TAG_TEXT: data += get<uint32_t>(data); break;
+            default: break;
+        }
+    }
+    switch (get<uint8_t>(data)) {
+        case TAG_INT:
+        case TAG_REAL: return get<uint64_t>(data);
+        case TAG_TEXT: return get<uint32_t>(data);
+        default: return 0;
+    }
+}
+
+Row legacyDecode(const char* data) {
+    data += sizeof(uint32_t);
+    uint16_t count = get<uint16_t>(data);
+    Row row;
+    row.reserve(count);
+    for (uint16_t i = 0; i < count; i++) row.push_back(legacyValue(data));
+    return row;
+}
+
+// ============================================================================
+// DADOS
+// ============================================================================
+
+catalog::TableSchema makeSchema(const std::string& name, const std::vector<catalog::Column>& columns) {
+    catalog::TableSchema schema;
+    schema.name = name;
+    schema.columns = columns;
+    return schema;
+}
+
+std::vector<catalog::TableSchema> schemas() {
+    return {
+        makeSchema("orders", {{"id", DataType::INT}, {"customer", DataType::TEXT}, {"placed", DataType::TIMESTAMP},
+                              {"total", DataType::REAL}, {"status", DataType::TEXT}, {"payload", DataType::BLOB},
+                              {"due", DataType::DATE}, {"qty", DataType::INT}, {"discount", DataType::REAL},
+                              {"note", DataType::TEXT}}),
+        makeSchema("ticks", {{"ts", DataType::TIMESTAMP}, {"symbol_id", DataType::INT}, {"bid", DataType::REAL},
+                             {"ask", DataType::REAL}, {"volume", DataType::INT}}),
+        makeSchema("tags", {{"name", DataType::TEXT}, {"label", DataType::TEXT}, {"color", DataType::TEXT}}),
+        makeSchema("empty", {}),
+    };
+}
+
+class RowGenerator {
+public:
+    explicit RowGenerator(uint64_t seed) : rng_(seed) {}
+
+    Row next(const catalog::TableSchema& schema) {
+        Row row;
+        for (const auto& column : schema.columns) row.push_back(value(column.type));
+        return row;
+    }
+
+private:
+    std::mt19937_64 rng_;
+
+    Value value(DataType type) {
+        if (rng_() % 10 == 0) return Value::null();
+        switch (type) {
+            case DataType::REAL:
+                switch (rng_() % 40) {
+                    case 0: return Value::real(std::numeric_limits<double>::infinity());
+                    case 1: return Value::real(-0.0);
+                    case 2: return Value::real(std::numeric_limits<double>::denorm_min());
+                    default: return Value::real(static_cast<double>(rng_() % 10000000) / 100.0 - 5000.0);
+                }
+            case DataType::TEXT:
+            case DataType::BLOB: return Value::text(text(type == DataType::BLOB));
+            default:
+                switch (rng_() % 40) {
+                    case 0: return Value::integer(std::numeric_limits<int64_t>::min());
+                    case 1: return Value::integer(std::numeric_limits<int64_t>::max());
+                    default: return Value::integer(static_cast<int64_t>(rng_() % 2000000) - 1000000);
+                }
+        }
+    }
+
+    // Quase sempre curto; às vezes > 255 (offsets de 2 bytes) ou > 65535 (4)
+    std::string text(bool binary) {
+        uint64_t roll = rng_() % 20000;
+        size_t length = roll == 0 ? 70000 + rng_() % 1000 : roll < 200 ? 300 + rng_() % 1000 : rng_() % 24;
+        std::string text(length, '\0');
+        for (char& c : text) c = binary ? static_cast<char>(rng_()) : static_cast<char>('a' + rng_() % 26);
+        return text;
+    }
+};
+
+bool identical(const Value& a, const Value& b) {
+    if (a.kind() != b.kind()) return false;
+    if (a.kind() == Value::Kind::REAL) {
+        double x = a.realValue();
+        double y = b.realValue();
+        return std::memcmp(&x, &y, sizeof(x)) == 0;
+    }
+    return a.isNull() || a == b;
+}
+
+bool identical(const Row& a, const Row& b) {
+    if (a.size() != b.size()) return false;
+    for (size_t i = 0; i < a.size(); i++) {
+        if (!identical(a[i], b[i])) return false;
+    }
+    return true;
+}
+
+void require(bool condition, const std::string& what) {
+    if (!condition) throw std::logic_error(what);
+}
+
+// ============================================================================
+// CONFERÊNCIA
+// ============================================================================
+
+void verifySchema(const catalog::TableSchema& schema, size_t rows) {
+    RowCodec codec(schema);
+    RowGenerator generator(std::hash<std::string>()(schema.name));
+    std::mt19937_64 rng(5);
+    std::vector<Row> expected;
+    std::string stream;
+    size_t truncations = 0;
+
+    for (size_t n = 0; n < rows; n++) {
+        Row row = generator.next(schema);
+        std::string bytes = codec.encode(row);
+        std::string where = schema.name + " row " + std::to_string(n);
+        require(bytes.size() == codec.encodedSize(row), where + ": encodedSize differs from encode");
+        require(identical(codec.decode(bytes.data(), bytes.size()), row), where + ": decode differs");
+
+        RowView view = codec.view(bytes.data(), bytes.size());
+        for (size_t i = 0; i < row.size(); i++) {
+            require(view.isNull(i) == row[i].isNull(), where + ": NULL bit of column " + std::to_string(i));
+            require(identical(view.value(i), row[i]), where + ": column " + std::to_string(i));
+        }
+
+        if (!row.empty()) {
+            std::vector<size_t> columns;
+            for (size_t k = 0; k < 3; k++) columns.push_back(rng() % row.size());
+            Row projected = codec.project(bytes.data(), bytes.size(), columns);
+            for (size_t k = 0; k < columns.size(); k++) {
+                require(identical(projected[k], row[columns[k]]), where + ": projection");
+            }
+        }
+
+        // Todo prefixo estrito é rejeitado (e nunca lido fora do buffer)
+        if (n % 64 == 0 && bytes.size() < 4096) {
+            for (size_t length = 0; length < bytes.size(); length++) {
+                std::string prefix = bytes.substr(0, length);
+                bool rejected = false;
+                try {
+                    codec.decode(prefix.data(), prefix.size());
+                } catch (const std::runtime_error&) {
+                    rejected = true;
+                }
+                require(rejected, where + ": truncation to " + std::to_string(length) + " bytes was accepted");
+                truncations++;
+            }
+        }
+
+        codec.encodeFramed(row, stream);
+        expected.push_back(std::move(row));
+    }
+
+    const char* data = stream.data();
+    const char* end = data + stream.size();
+    RowView view;
+    size_t read = 0;
+    while (codec.readFramed(data, end, view)) {
+        require(read < expected.size(), schema.name + ": framed stream has extra rows");
+        for (size_t i = 0; i < codec.columnCount(); i++) {
+            require(identical(view.value(i), expected[read][i]), schema.name + ": framed row " + std::to_string(read));
+        }
+        read++;
+    }
+    require(read == expected.size(), schema.name + ": framed stream lost rows");
+
+    bool rejected = false;
+    try {
+        std::string bad = codec.encode(expected.front());
+        bad[0] = 3;
+        codec.decode(bad.data(), bad.size());
+    } catch (const std::runtime_error&) {
+        rejected = true;
+    }
+    require(rejected, schema.name + ": unknown header byte was accepted");
+
+    std::cout << "  " << std::left << std::setw(8) << schema.name << std::right << rows << " rows round-tripped, "
+              << truncations << " truncated encodings rejected\n";
+}
+
+void verifyTypes() {
+    catalog::TableSchema schema = makeSchema("typed", {{"n", DataType::INT}, {"x", DataType::REAL},
+                                                       {"s", DataType::TEXT}});
+    RowCodec codec(schema);
+
+    Row widened = {Value::integer(1), Value::integer(2), Value::text("a")};
+    codec.conform(widened);
+    require(widened[1].kind() == Value::Kind::REAL, "INTEGER in a REAL column is not widened");
+
+    const Row rejected[] = {
+        {Value::real(1.5), Value::null(), Value::null()},
+        {Value::text("1"), Value::null(), Value::null()},
+        {Value::null(), Value::text("2"), Value::null()},
+        {Value::null(), Value::null(), Value::integer(3)},
+    };
+    for (const Row& row : rejected) {
+        bool threw = false;
+        try {
+            codec.encode(row);
+        } catch (const std::runtime_error&) {
+            threw = true;
+        }
+        require(threw, "value of the wrong type was encoded");
+    }
+}
+
+// ============================================================================
+// MEDIÇÃO
+// ============================================================================
+
+template <typename Fn>
+double nsPerRow(size_t rows, Fn&& fn) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() /
+           static_cast<double>(rows);
+}
+
+void measure(const catalog::TableSchema& schema, size_t rows) {
+    RowCodec codec(schema);
+    RowGenerator generator(17);
+    std::vector<Row> input;
+    for (size_t i = 0; i < rows; i++) input.push_back(generator.next(schema));
+
+    std::string compact;
+    std::string legacy;
+    double encode_ns = nsPerRow(rows, [&] {
+        for (const Row& row : input) codec.encodeFramed(row, compact);
+    });
+    double legacy_encode_ns = nsPerRow(rows, [&] {
+        for (const Row& row : input) legacyEncode(row, legacy);
+    });
+
+    // Os dois formatos são lidos como sequência: RowSize u32 x varint
+    auto forEachLegacy = [&](auto&& fn) {
+        for (const char* data = legacy.data(); data < legacy.data() + legacy.size();) {
+            uint32_t size;
+            std::memcpy(&size, data, sizeof(size));
+            fn(data);
+            data += size;
+        }
+    };
+
+    size_t checksum = 0;
+    double decode_ns = nsPerRow(rows, [&] {
+        const char* data = compact.data();
+        const char* end = data + compact.size();
+        RowView view;
+        while (codec.readFramed(data, end, view)) {
+            for (size_t i = 0; i < codec.columnCount(); i++) checksum += view.value(i).isNull();
+        }
+    });
+    double legacy_decode_ns = nsPerRow(rows, [&] {
+        forEachLegacy([&](const char* row) { checksum += legacyDecode(row).size(); });
+    });
+
+    // Última coluna (o pior caso do formato anterior), lida sem alocar
+    size_t column = schema.columns.size() - 1;
+    DataType type = schema.columns[column].type;
+    double project_ns = nsPerRow(rows, [&] {
+        const char* data = compact.data();
+        const char* end = data + compact.size();
+        RowView view;
+        while (codec.readFramed(data, end, view)) {
+            if (view.isNull(column)) continue;
+            if (type == DataType::TEXT || type == DataType::BLOB) checksum += view.textAt(column).size();
+            else checksum += static_cast<uint64_t>(view.intAt(column));
+        }
+    });
+    double legacy_project_ns = nsPerRow(rows, [&] {
+        forEachLegacy([&](const char* row) { checksum += legacyColumnRaw(row, column); });
+    });
+    volatile size_t sink = checksum;
+    (void)sink;
+
+    std::cout << std::left << std::setw(8) << schema.name << std::right << std::fixed << std::setprecision(1)
+              << std::setw(9) << static_cast<double>(legacy.size()) / rows << std::setw(9)
+              << static_cast<double>(compact.size()) / rows << std::setw(7) << std::setprecision(0)
+              << 100.0 * (1.0 - static_cast<double>(compact.size()) / static_cast<double>(legacy.size())) << "%"
+              << std::setprecision(1) << std::setw(9) << legacy_encode_ns << std::setw(8) << encode_ns
+              << std::setw(9) << legacy_decode_ns << std::setw(8) << decode_ns << std::setw(9) << legacy_project_ns
+              << std::setw(8) << project_ns << "\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t rows = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 200000;
+
+    try {
+        std::cout << "Round-trip checks:\n";
+        for (const auto& schema : schemas()) verifySchema(schema, std::max<size_t>(1, rows / 10));
+        verifyTypes();
+        std::cout << "  type checks passed (INTEGER widened to REAL, mismatches rejected)\n\n";
+    } catch (const std::logic_error& e) {
+        std::cerr << "MISMATCH: " << e.what() << "\n";
+        return 1;
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << "\n";
+        return 1;
+    }
+
+    std::cout << "Bytes per row and ns per row, previous WAL format (old) vs compact (new):\n";
+    std::cout << std::left << std::setw(8) << "schema" << std::right << std::setw(9) << "old B" << std::setw(9)
+              << "new B" << std::setw(8) << "saved" << std::setw(9) << "enc old" << std::setw(8) << "new"
+              << std::setw(9) << "dec old" << std::setw(8) << "new" << std::setw(9) << "col old" << std::setw(8)
+              << "new" << "\n";
+    for (const auto& schema : schemas()) {
+        if (!schema.columns.empty()) measure(schema, rows);
+    }
+    return 0;
+}
@@ -0,0 +1,336 @@
+#include "storage/startup_profile.h"
+#include <algorithm>
+#include <chrono>
+#include <fcntl.h>
+#include <filesystem>
+#include <iomanip>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <unistd.h>
+
+namespace miniql {
+namespace storage {
+
+namespace {
+
+namespace fs = std::filesystem;
+using Clock = std::chrono::steady_clock;
+
+double microsecondsSince(Clock::time_point start) {
+    return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+}
+
+uint64_t fileBytes(const std::string& path) {
+    std::error_code error;
+    uint64_t size = fs::file_size(path, error);
+    return error ? 0 : size;
+}
+
+std::string megabytes(uint64_t bytes) {
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(1) << static_cast<double>(bytes) / (1024.0 * 1024.0) << " MB";
+    return out.str();
+}
+
+// ============================================================================
+// BANCO SINTÉTICO
+// ============================================================================
+
+// Três formatos de tabela se alternam: chave INT + TEXT UNIQUE, chave INT
+// com texto livre, chave TEXT
+catalog::TableSchema syntheticSchema(size_t index) {
+    catalog::TableSchema schema;
+    std::string number = std::to_string(index);
+    schema.name = "synth_" + std::string(number.size() < 4 ? 4 - number.size() : 0, '0') + number;
+    schema.engine = catalog::TableEngine::MEMORY;
+    switch (index % 3) {
+        case 0:
+            schema.columns = {{"id", DataType::INT}, {"email", DataType::TEXT}, {"score", DataType::REAL},
+                              {"created", DataType::TIMESTAMP}};
+            schema.columns[1].unique = true;
+            break;
+        case 1:
+            schema.columns = {{"id", DataType::INT}, {"account", DataType::INT}, {"amount", DataType::REAL},
+                              {"memo", DataType::TEXT}};
+            break;
+        default:
+            schema.columns = {{"code", DataType::TEXT}, {"label", DataType::TEXT}, {"qty", DataType::INT},
+                              {"price", DataType::REAL}, {"updated", DataType::DATE}};
+            break;
+    }
+    schema.columns[0].primary_key = true;
+    return schema;
+}
+
+std::string randomWord(std::mt19937_64& rng, size_t min_length, size_t max_length) {
+    std::string word(min_length + rng() % (max_length - min_length + 1), ' ');
+    for (char& c : word) c = static_cast<char>('a' + rng() % 26);
+    return word;
+}
+
+Row syntheticRow(size_t table, int64_t key, std::mt19937_64& rng) {
+    double real = static_cast<double>(rng() % 1000000) / 100.0;
+    switch (table % 3) {
+        case 0:
+            return {Value::integer(key), Value::text("user" + std::to_string(key) + "@example.com"), Value::real(real),
+                    Value::integer(1700000000000000 + static_cast<int64_t>(rng() % 31536000000000ull))};
+        case 1:
+            return {Value::integer(key), Value::integer(static_cast<int64_t>(rng() % 100000)), Value::real(real),
+                    Value::text(randomWord(rng, 8, 40))};
+        default:
+            return {Value::text("SKU-" + std::to_string(key)), Value::text(randomWord(rng, 4, 16)),
+                    Value::integer(static_cast<int64_t>(rng() % 1000)), Value::real(real),
+                    Value::integer(19000 + static_cast<int64_t>(rng() % 2000))};
+    }
+}
+
+// ============================================================================
+// MEDIÇÃO
+// ============================================================================
+
+// fdatasync + POSIX_FADV_DONTNEED em cada arquivo; páginas sujas da cópia
+// vão para o disco antes de sair do cache
+size_t dropFromPageCache(const std::string& dir) {
+    size_t dropped = 0;
+    for (const auto& entry : fs::directory_iterator(dir)) {
+        if (!entry.is_regular_file()) continue;
+        int fd = ::open(entry.path().c_str(), O_RDONLY);
+        if (fd < 0) continue;
+        ::fdatasync(fd);
+        if (::posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED) == 0) dropped++;
+        ::close(fd);
+    }
+    return dropped;
+}
+
+void measureFirstLookup(StorageManager& storage, OpenProfile& profile, std::mt19937_64& rng) {
+    MemoryTable* table = nullptr;
+    size_t key_column = 0;
+    for (const std::string& name : storage.memoryTableNames()) {
+        MemoryTable* candidate = storage.memoryTable(name);
+        const auto& columns = candidate->schema().columns;
+        auto pk = std::find_if(columns.begin(), columns.end(), [](const catalog::Column& c) { return c.primary_key; });
+        if (pk == columns.end() || (table && table->size() >= candidate->size())) continue;
+        table = candidate;
+        key_column = static_cast<size_t>(pk - columns.begin());
+    }
+    if (!table || table->size() == 0) return;
+    profile.lookup_table = table->schema().name;
+
+    // Chaves de linhas vivas sorteadas (RowIds são densos, com buracos
+    // deixados por deletes)
+    std::vector<Value> keys;
+    Row row;
+    for (size_t attempt = 0; keys.size() < 1001 && attempt < 100000; attempt++) {
+        if (table->read(static_cast<RowId>(rng() % (table->size() * 2)), row)) keys.push_back(row[key_column]);
+    }
+    if (keys.empty()) return;
+
+    Clock::time_point start = Clock::now();
+    bool found = table->lookup(key_column, keys[0], row);
+    profile.first_lookup_us = microsecondsSince(start);
+    if (!found) throw std::runtime_error("Key of a live row not found in " + profile.lookup_table);
+
+    if (keys.size() > 1) {
+        start = Clock::now();
+        for (size_t i = 1; i < keys.size(); i++) table->lookup(key_column, keys[i], row);
+        profile.next_lookup_us = microsecondsSince(start) / static_cast<double>(keys.size() - 1);
+    }
+}
+
+void measureFirstPage(StorageManager& storage, OpenProfile& profile, std::mt19937_64& rng) {
+    PageId pages = storage.pageCount();
+    if (pages == 0) return;
+    PageId page = static_cast<PageId>(rng() % pages);
+    char buffer[64];
+
+    Clock::time_point start = Clock::now();
+    storage.read(page, 0, buffer, sizeof(buffer));
+    profile.first_page_us = microsecondsSince(start);
+
+    start = Clock::now();
+    storage.read(page, 0, buffer, sizeof(buffer));
+    profile.next_page_us = microsecondsSince(start);
+}
+
+} // namespace
+
+SyntheticDbInfo generateSyntheticDatabase(const std::string& dir, const SyntheticDbSpec& spec) {
+    if (fs::exists(dir) && !fs::is_empty(dir)) throw std::runtime_error("Directory is not empty: '" + dir + "'");
+    if (spec.tables == 0) throw std::runtime_error("A synthetic database needs at least one table");
+
+    Clock::time_point start = Clock::now();
+    std::mt19937_64 rng(spec.seed);
+
+    // Zipf: a tabela i recebe rows / (i + 1) / H; o arredondamento vai para a primeira
+    std::vector<double> weights;
+    double harmonic = 0.0;
+    for (size_t i = 0; i < spec.tables; i++) {
+        weights.push_back(1.0 / static_cast<double>(i + 1));
+        harmonic += weights.back();
+    }
+    std::vector<size_t> sizes;
+    size_t assigned = 0;
+    for (double weight : weights) {
+        sizes.push_back(static_cast<size_t>(static_cast<double>(spec.rows) * weight / harmonic));
+        assigned += sizes.back();
+    }
+    sizes[0] += spec.rows - assigned;
+
+    StorageOptions options;
+    options.background_checkpoints = false;
+    options.checkpoint_on_close = false;
+
+    SyntheticDbInfo info;
+    info.tables = spec.tables;
+    info.pages = spec.pages;
+    {
+        StorageManager storage(dir, options);
+        std::vector<MemoryTable*> tables;
+        std::vector<int64_t> next_key(spec.tables, 0);
+        std::vector<std::vector<RowId>> live(spec.tables);
+
+        for (size_t t = 0; t < spec.tables; t++) {
+            tables.push_back(&storage.createMemoryTable(syntheticSchema(t)));
+            live[t].reserve(sizes[t]);
+            for (size_t r = 0; r < sizes[t]; r++) {
+                live[t].push_back(tables[t]->insert(syntheticRow(t, next_key[t]++, rng)));
+            }
+        }
+
+        std::vector<char> payload(PAGE_PAYLOAD_SIZE);
+        for (size_t page = 0; page < spec.pages; page++) {
+            for (char& byte : payload) byte = static_cast<char>(rng());
+            storage.write(static_cast<PageId>(page), 0, payload.data(), static_cast<uint16_t>(payload.size()));
+        }
+        storage.commit();
+
+        // Estado "limpo": dados no arquivo, snapshot das tabelas no log
+        storage.checkpoint();
+
+        // Cauda que o próximo recovery refaz: 80% inserts, 10% deletes e
+        // 10% escritas de 256 bytes, nas tabelas proporcionalmente ao tamanho
+        std::discrete_distribution<size_t> pick(weights.begin(), weights.end());
+        constexpr uint16_t TAIL_WRITE = 256;
+        for (size_t op = 0; op < spec.wal_tail_ops; op++) {
+            size_t t = pick(rng);
+            uint64_t roll = rng() % 10;
+            if (roll < 8 || (roll == 8 && live[t].empty()) || (roll == 9 && spec.pages == 0)) {
+                live[t].push_back(tables[t]->insert(syntheticRow(t, next_key[t]++, rng)));
+            } else if (roll == 8) {
+                size_t victim = rng() % live[t].size();
+                tables[t]->erase(live[t][victim]);
+                live[t][victim] = live[t].back();
+                live[t].pop_back();
+            } else {
+                PageId page = static_cast<PageId>(rng() % spec.pages);
+                uint16_t offset = static_cast<uint16_t>(rng() % (PAGE_PAYLOAD_SIZE - TAIL_WRITE));
+                storage.write(page, offset, payload.data(), TAIL_WRITE);
+            }
+        }
+        storage.commit();
+
+        for (const auto& rows : live) info.rows += rows.size();
+    } // fecha sem checkpoint: a cauda fica para o recovery
+
+    info.data_bytes = fileBytes(dir + "/data.db");
+    info.wal_bytes = fileBytes(dir + "/wal.log");
+    info.seconds = microsecondsSince(start) / 1e6;
+    return info;
+}
+
+OpenProfile profileOpen(const std::string& dir, bool cold) {
+    if (!fs::exists(dir + "/wal.log")) throw std::runtime_error("Not a MiniQL database directory: '" + dir + "'");
+
+    OpenProfile profile;
+    profile.dir = dir;
+    profile.cold = cold;
+
+    std::string copy = fs::path(dir).lexically_normal().string();
+    while (copy.size() > 1 && copy.back() == '/') copy.pop_back();
+    copy += ".bench-open";
+    fs::remove_all(copy);
+    fs::copy(dir, copy, fs::copy_options::recursive);
+    profile.data_bytes = fileBytes(copy + "/data.db");
+    profile.wal_bytes = fileBytes(copy + "/wal.log");
+    if (cold) profile.dropped_files = dropFromPageCache(copy);
+
+    try {
+        StorageOptions options;
+        options.background_checkpoints = false;
+        options.checkpoint_on_close = false;
+        StorageManager storage(copy, options);
+        profile.open = storage.openStats();
+        profile.recovery = storage.recoveryStats();
+
+        std::mt19937_64 rng(7);
+        measureFirstLookup(storage, profile, rng);
+        measureFirstPage(storage, profile, rng);
+    } catch (...) {
+        fs::remove_all(copy);
+        throw;
+    }
+    fs::remove_all(copy);
+    return profile;
+}
+
+void printOpenProfile(std::ostream& out, const OpenProfile& profile) {
+    const OpenStats& open = profile.open;
+    out << "Opening " << profile.dir << " ("
+        << (profile.cold ? "cold page cache, " + std::to_string(profile.dropped_files) + " files dropped"
+                         : std::string("warm page cache"))
+        << ")\n";
+    out << "  data " << megabytes(profile.data_bytes) << ", WAL " << megabytes(profile.wal_bytes) << ", "
+        << megabytes(profile.recovery.log_bytes) << " replayed (" << profile.recovery.records << " records, "
+        << profile.recovery.table_records << " of them table records, " << profile.recovery.threads
+        << " threads)\n";
+    out << "  " << open.tables << " memory tables, " << open.rows << " rows\n\n";
+
+    double total_ms = open.total_seconds * 1000.0;
+    double other = open.total_seconds - open.catalog_seconds - open.replay_seconds - open.index_seconds -
+                   open.checkpoint_seconds;
+    struct Phase {
+        const char* name;
+        double seconds;
+    };
+    const Phase phases[] = {
+        {"catalog load", open.catalog_seconds},
+        {"WAL replay", open.replay_seconds},
+        {"index build", open.index_seconds},
+        {"checkpoint", open.checkpoint_seconds},
+        {"other (files, buffer pool)", std::max(0.0, other)},
+    };
+
+    out << std::left << std::setw(28) << "phase" << std::right << std::setw(12) << "ms" << std::setw(9) << "share"
+        << "\n";
+    out << std::fixed;
+    for (const Phase& phase : phases) {
+        out << std::left << std::setw(28) << phase.name << std::right << std::setprecision(3) << std::setw(12)
+            << phase.seconds * 1000.0 << std::setprecision(1) << std::setw(8)
+            << (total_ms > 0 ? 100.0 * phase.seconds * 1000.0 / total_ms : 0.0) << "%\n";
+    }
+    out << std::left << std::setw(28) << "open total" << std::right << std::setprecision(3) << std::setw(12)
+        << total_ms << "\n\n";
+
+    out << "First query:\n" << std::setprecision(1);
+    double first_query_us = 0.0;
+    if (profile.first_lookup_us >= 0) {
+        out << "  point lookup on " << profile.lookup_table << ": " << profile.first_lookup_us << " us (then "
+            << std::setprecision(2) << profile.next_lookup_us << " us per lookup)\n" << std::setprecision(1);
+        first_query_us = profile.first_lookup_us;
+    } else {
+        out << "  point lookup: no memory table with a primary key\n";
+    }
+    if (profile.first_page_us >= 0) {
+        out << "  page read from the data file: " << profile.first_page_us << " us (then " << std::setprecision(2)
+            << profile.next_page_us << " us from the buffer pool)\n" << std::setprecision(1);
+        first_query_us = std::max(first_query_us, profile.first_page_us);
+    } else {
+        out << "  page read: empty data file\n";
+    }
+    out << "Time to first query: " << std::setprecision(3) << total_ms + first_query_us / 1000.0 << " ms\n";
+}
+
+} // namespace storage
+} // namespace miniql
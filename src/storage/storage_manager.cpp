@@ -0,0 +1,186 @@
+#include "storage/storage_manager.h"
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <stdexcept>
+
+namespace miniql {
+namespace storage {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double secondsSince(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+} // namespace
+
+StorageManager::StorageManager(const std::string& dir, StorageOptions options)
+    : dir_(dir), options_(options) {
+    Clock::time_point start = Clock::now();
+    std::filesystem::create_directories(dir_);
+
+    CheckpointInfo master;
+    readCheckpoint(dir_, master);
+    open_.catalog_seconds = secondsSince(start);
+
+    io_ = IoEngine::create(options_.io_engine, options_.io_queue_depth);
+    file_ = std::make_unique<PageFile>(dir_ + "/data.db", *io_, options_.direct_io);
+
+    // Os schemas das tabelas em memória vêm dos TABLE_CREATE do log; o
+    // tempo deles (inclusive descartar a versão anterior da tabela quando o
+    // registro abre um snapshot) conta como catálogo, não como redo
+    double table_create_seconds = 0.0;
+    recovery_ = recover(dir_ + "/wal.log", *file_, master.redo_lsn, options_.recovery_threads,
+                        [this, &table_create_seconds](const WalRecord& record) {
+                            if (record.type != WalRecordType::TABLE_CREATE) {
+                                redoTableRecord(record, memory_tables_);
+                                return;
+                            }
+                            Clock::time_point create = Clock::now();
+                            redoTableRecord(record, memory_tables_);
+                            table_create_seconds += secondsSince(create);
+                        });
+    open_.catalog_seconds += table_create_seconds;
+    open_.replay_seconds = recovery_.seconds - table_create_seconds;
+
+    Clock::time_point indexes = Clock::now();
+    for (auto& entry : memory_tables_) {
+        entry.second->buildIndexes();
+        open_.rows += entry.second->size();
+    }
+    open_.index_seconds = secondsSince(indexes);
+    open_.tables = memory_tables_.size();
+
+    wal_ = std::make_unique<Wal>(dir_ + "/wal.log", recovery_.end_lsn, *io_);
+    for (auto& entry : memory_tables_) entry.second->setWal(wal_.get());
+    pool_ = std::make_unique<BufferPool>(*file_, options_.buffer_pool_pages);
+    pool_->setWal(wal_.get());
+    pool_->setReadAhead(options_.readahead_pages);
+
+    // Depois do redo o arquivo de dados está em dia: o próximo recovery
+    // começa do fim do log atual
+    Clock::time_point checkpoint_start = Clock::now();
+    checkpoint();
+    open_.checkpoint_seconds = secondsSince(checkpoint_start);
+
+    if (options_.background_checkpoints) {
+        checkpointer_ = std::thread(&StorageManager::checkpointerLoop, this);
+    }
+    open_.total_seconds = secondsSince(start);
+}
+
+StorageManager::~StorageManager() {
+    if (checkpointer_.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(checkpointer_mutex_);
+            stop_ = true;
+        }
+        checkpointer_wake_.notify_one();
+        checkpointer_.join();
+    }
+
+    try {
+        if (options_.checkpoint_on_close) checkpoint();
+        else commit();
+    } catch (const std::exception& e) {
+        std::cerr << "Checkpoint on close failed: " << e.what() << std::endl;
+    }
+}
+
+Lsn StorageManager::write(PageId page, uint16_t offset, const void* data, uint16_t length) {
+    if (static_cast<size_t>(offset) + length > PAGE_PAYLOAD_SIZE) {
+        throw std::runtime_error("Write past the end of page " + std::to_string(page));
+    }
+
+    PageHandle handle = pool_->fetch(page);
+    Lsn lsn;
+    {
+        std::unique_lock<std::shared_mutex> latch(handle.latch());
+        pool_->markDirty(handle);
+        lsn = wal_->appendPageWrite(page, offset, data, length);
+        std::memcpy(handle.page().payload() + offset, data, length);
+        handle.page().setLsn(lsn);
+    }
+
+    if (options_.background_checkpoints &&
+        lsn - last_checkpoint_.load(std::memory_order_relaxed) >= options_.checkpoint_wal_bytes) {
+        std::lock_guard<std::mutex> lock(checkpointer_mutex_);
+        if (!checkpoint_requested_) {
+            checkpoint_requested_ = true;
+            checkpointer_wake_.notify_one();
+        }
+    }
+    return lsn;
+}
+
+void StorageManager::read(PageId page, uint16_t offset, void* out, uint16_t length) {
+    if (static_cast<size_t>(offset) + length > PAGE_PAYLOAD_SIZE) {
+        throw std::runtime_error("Read past the end of page " + std::to_string(page));
+    }
+
+    PageHandle handle = pool_->fetch(page);
+    std::shared_lock<std::shared_mutex> latch(handle.latch());
+    std::memcpy(out, handle.page().payload() + offset, length);
+}
+
+void StorageManager::commit() {
+    wal_->flushAll();
+}
+
+CheckpointInfo StorageManager::checkpoint() {
+    std::lock_guard<std::mutex> lock(checkpoint_mutex_);
+    CheckpointInfo info = runCheckpoint(*pool_, *wal_, *file_, dir_, [this] {
+        std::lock_guard<std::mutex> tables_lock(tables_mutex_);
+        for (const auto& entry : memory_tables_) entry.second->logSnapshot();
+    });
+    last_checkpoint_.store(info.checkpoint_lsn, std::memory_order_relaxed);
+    return info;
+}
+
+MemoryTable& StorageManager::createMemoryTable(const catalog::TableSchema& schema) {
+    std::lock_guard<std::mutex> lock(tables_mutex_);
+    std::string key = memoryTableKey(schema.name);
+    if (memory_tables_.count(key)) throw std::runtime_error("Table already exists: " + schema.name);
+
+    auto table = std::make_unique<MemoryTable>(schema, wal_.get());
+    wal_->appendTableRecord(WalRecordType::TABLE_CREATE, encodeTableCreate(table->schema()));
+    return *(memory_tables_[key] = std::move(table));
+}
+
+MemoryTable* StorageManager::memoryTable(const std::string& name) {
+    std::lock_guard<std::mutex> lock(tables_mutex_);
+    auto it = memory_tables_.find(memoryTableKey(name));
+    return it == memory_tables_.end() ? nullptr : it->second.get();
+}
+
+std::vector<std::string> StorageManager::memoryTableNames() {
+    std::lock_guard<std::mutex> lock(tables_mutex_);
+    std::vector<std::string> names;
+    for (const auto& entry : memory_tables_) names.push_back(entry.second->schema().name);
+    return names;
+}
+
+void StorageManager::checkpointerLoop() {
+    std::unique_lock<std::mutex> lock(checkpointer_mutex_);
+    while (!stop_) {
+        checkpointer_wake_.wait_for(lock, options_.checkpoint_interval,
+                                    [this] { return stop_ || checkpoint_requested_; });
+        if (stop_) break;
+
+        lock.unlock();
+        try {
+            checkpoint();
+        } catch (const std::exception& e) {
+            // Tenta de novo na próxima rodada; o WAL continua garantindo os dados
+            std::cerr << "Background checkpoint failed: " << e.what() << std::endl;
+        }
+        lock.lock();
+        checkpoint_requested_ = false;
+    }
+}
+
+} // namespace storage
+} // namespace miniql
@@ -0,0 +1,398 @@
+#include "storage/wal.h"
+#include "common/crc32.h"
+#include "metrics/metrics.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <stdexcept>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace miniql {
+namespace storage {
+
+namespace {
+
+constexpr char WAL_MAGIC[8] = {'M', 'Q', 'L', 'W', 'A', 'L', '0', '2'};
+constexpr size_t RECORD_HEADER_SIZE = 4 + 4 + 8 + 1;
+constexpr size_t MAX_RECORD_SIZE = RECORD_HEADER_SIZE + WAL_MAX_PAYLOAD;
+
+// Acima disso o buffer é escrito (sem fsync) para não crescer sem limite
+constexpr size_t WAL_BUFFER_LIMIT = 4 << 20;
+
+std::runtime_error ioError(const std::string& what, const std::string& path) {
+    return std::runtime_error(what + " '" + path + "': " + std::strerror(errno));
+}
+
+template <typename T>
+void put(std::string& out, T value) {
+    out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+template <typename T>
+T get(const char* in) {
+    T value;
+    std::memcpy(&value, in, sizeof(value));
+    return value;
+}
+
+void writeFully(int fd, const char* data, size_t length, off_t offset, const std::string& path) {
+    size_t done = 0;
+    while (done < length) {
+        ssize_t n = ::pwrite(fd, data + done, length - done, offset + static_cast<off_t>(done));
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            throw ioError("Cannot write WAL", path);
+        }
+        done += static_cast<size_t>(n);
+    }
+}
+
+// Cabeçalho: magic + LSN do offset 0
+void writeHeader(int fd, Lsn base, const std::string& path) {
+    char header[WAL_START_LSN];
+    std::memcpy(header, WAL_MAGIC, sizeof(WAL_MAGIC));
+    std::memcpy(header + sizeof(WAL_MAGIC), &base, sizeof(base));
+    writeFully(fd, header, sizeof(header), 0, path);
+}
+
+// Logs sem truncamento (e os anteriores a ele) têm 0 nos bytes da base
+Lsn readBase(int fd) {
+    Lsn base = 0;
+    if (::pread(fd, &base, sizeof(base), sizeof(WAL_MAGIC)) != static_cast<ssize_t>(sizeof(base))) return 0;
+    return base;
+}
+
+} // namespace
+
+// ============================================================================
+// ESCRITA
+// ============================================================================
+
+Wal::Wal(const std::string& path, Lsn end_lsn, IoEngine& io)
+    : path_(path), io_(io), fd_(-1), base_(0), buffer_start_(0), next_lsn_(0), durable_(0) {
+    fd_ = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (fd_ < 0) throw ioError("Cannot open WAL", path);
+
+    struct stat st;
+    if (::fstat(fd_, &st) != 0) throw ioError("Cannot stat WAL", path);
+
+    if (static_cast<uint64_t>(st.st_size) < WAL_START_LSN) {
+        // Log novo começa em end_lsn (que só passa do início se o arquivo
+        // sumiu depois de um checkpoint)
+        base_ = std::max(end_lsn, WAL_START_LSN) - WAL_START_LSN;
+        writeHeader(fd_, base_, path_);
+        if (::fdatasync(fd_) != 0) throw ioError("Cannot sync WAL", path);
+    } else {
+        char magic[sizeof(WAL_MAGIC)];
+        if (::pread(fd_, magic, sizeof(magic), 0) != static_cast<ssize_t>(sizeof(magic)) ||
+            std::memcmp(magic, WAL_MAGIC, sizeof(magic)) != 0) {
+            // "MQLWAL01": linhas das tabelas em memória no formato antigo (tags)
+            if (std::memcmp(magic, WAL_MAGIC, 6) == 0) {
+                throw std::runtime_error("Unsupported WAL version '" + std::string(magic, sizeof(magic)) + "' in '" +
+                                         path + "' (expected " + std::string(WAL_MAGIC, sizeof(WAL_MAGIC)) + ")");
+            }
+            throw std::runtime_error("Not a MiniQL WAL file: '" + path + "'");
+        }
+        base_ = readBase(fd_);
+    }
+
+    // Descarta a cauda inválida (registro escrito pela metade)
+    Lsn end = std::max(end_lsn, base_ + WAL_START_LSN);
+    if (static_cast<uint64_t>(st.st_size) > end - base_) {
+        if (::ftruncate(fd_, static_cast<off_t>(end - base_)) != 0) throw ioError("Cannot truncate WAL", path);
+    }
+
+    buffer_start_ = next_lsn_ = durable_ = end;
+}
+
+Wal::~Wal() {
+    try {
+        flushAll();
+    } catch (const std::exception&) {
+        // Destrutor não propaga; o recovery cuida do que não chegou ao disco
+    }
+    if (fd_ >= 0) ::close(fd_);
+}
+
+Lsn Wal::append(WalRecordType type, const std::string& payload) {
+    uint32_t length = static_cast<uint32_t>(RECORD_HEADER_SIZE + payload.size());
+    Lsn lsn;
+    bool over_limit;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        checkFailedLocked();
+        lsn = next_lsn_;
+
+        size_t start = buffer_.size();
+        put<uint32_t>(buffer_, 0);              // crc, preenchido abaixo
+        put<uint32_t>(buffer_, length);
+        put<uint64_t>(buffer_, lsn);
+        put<uint8_t>(buffer_, static_cast<uint8_t>(type));
+        buffer_ += payload;
+
+        uint32_t crc = crc32(buffer_.data() + start + 4, length - 4);
+        std::memcpy(&buffer_[start], &crc, sizeof(crc));
+
+        next_lsn_ += length;
+        over_limit = buffer_.size() >= WAL_BUFFER_LIMIT;
+    }
+
+    if (over_limit) writeOut(lsn + length, false);
+    return lsn;
+}
+
+Lsn Wal::appendPageWrite(PageId page, uint16_t offset, const void* data, uint16_t length) {
+    std::string payload;
+    payload.reserve(8 + length);
+    put<uint32_t>(payload, page);
+    put<uint16_t>(payload, offset);
+    put<uint16_t>(payload, length);
+    payload.append(static_cast<const char*>(data), length);
+    return append(WalRecordType::PAGE_WRITE, payload);
+}
+
+Lsn Wal::appendCheckpoint(Lsn redo_lsn) {
+    std::string payload;
+    put<uint64_t>(payload, redo_lsn);
+    return append(WalRecordType::CHECKPOINT, payload);
+}
+
+Lsn Wal::appendTableRecord(WalRecordType type, const std::string& payload) {
+    if (payload.size() > WAL_MAX_PAYLOAD) {
+        throw std::runtime_error("WAL record too large (" + std::to_string(payload.size()) + " bytes)");
+    }
+    return append(type, payload);
+}
+
+// Escreve o buffer; com sync, garante durabilidade até target (exclusivo)
+void Wal::writeOut(Lsn target, bool sync) {
+    std::lock_guard<std::mutex> write_lock(write_mutex_);
+
+    std::string data;
+    Lsn start;
+    Lsn end;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        checkFailedLocked();
+        if (sync && durable_ >= target) return;     // outro fsync já cobriu
+        data.swap(buffer_);
+        start = buffer_start_;
+        end = next_lsn_;
+        buffer_start_ = next_lsn_;
+    }
+
+    if (!data.empty()) {
+        IoRequest request;
+        request.op = IoOp::WRITE;
+        request.fd = fd_;
+        request.buffer = data.data();
+        request.length = data.size();
+        request.offset = start - base_;
+        int64_t result = io_.execute(std::move(request));
+        if (result != static_cast<int64_t>(data.size())) {
+            // Devolve os bytes à frente do que foi anexado nesse meio tempo
+            // (começa em end); a próxima escrita cobre [start, end) de novo
+            std::lock_guard<std::mutex> lock(mutex_);
+            buffer_.insert(0, data);
+            buffer_start_ = start;
+            throw std::runtime_error("Cannot write WAL '" + path_ + "': " +
+                                     (result < 0 ? ioErrorMessage(result)
+                                                 : "short write (" + std::to_string(result) + " of " +
+                                                       std::to_string(data.size()) + " bytes)"));
+        }
+    }
+
+    if (sync) {
+        metrics::ScopedTimer timer(metrics::Histogram::WAL_FSYNC_LATENCY);
+        IoRequest request;
+        request.op = IoOp::DATASYNC;
+        request.fd = fd_;
+        int64_t result = io_.execute(std::move(request));
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (result != 0) {
+            failure_ = "Cannot sync WAL '" + path_ + "': " + ioErrorMessage(result);
+            throw std::runtime_error(failure_);
+        }
+        durable_ = std::max(durable_, end);
+    }
+}
+
+uint64_t Wal::truncateBefore(Lsn lsn) {
+    std::lock_guard<std::mutex> write_lock(write_mutex_);
+
+    Lsn written;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        checkFailedLocked();
+        written = buffer_start_;
+    }
+    lsn = std::min(lsn, written);
+    Lsn first = base_ + WAL_START_LSN;
+    if (lsn <= first) return 0;
+    uint64_t dropped = lsn - first;
+    uint64_t kept = written - lsn;
+    if (dropped < std::max(kept, WAL_TRUNCATE_MIN_BYTES)) return 0;
+
+    Lsn base = lsn - WAL_START_LSN;
+    std::string tmp = path_ + ".tmp";
+    int fd = ::open(tmp.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) throw ioError("Cannot create WAL", tmp);
+    try {
+        writeHeader(fd, base, tmp);
+        std::vector<char> chunk(std::min<uint64_t>(kept, WAL_BUFFER_LIMIT));
+        for (uint64_t done = 0; done < kept;) {
+            size_t want = static_cast<size_t>(std::min<uint64_t>(chunk.size(), kept - done));
+            ssize_t n = ::pread(fd_, chunk.data(), want, static_cast<off_t>(lsn - base_ + done));
+            if (n < 0 && errno == EINTR) continue;
+            if (n < 0) throw ioError("Cannot read WAL", path_);
+            if (n == 0) throw std::runtime_error("Cannot read WAL '" + path_ + "': unexpected end of file");
+            writeFully(fd, chunk.data(), static_cast<size_t>(n), static_cast<off_t>(WAL_START_LSN + done), tmp);
+            done += static_cast<uint64_t>(n);
+        }
+        if (::fsync(fd) != 0) throw ioError("Cannot sync WAL", tmp);
+        if (::rename(tmp.c_str(), path_.c_str()) != 0) throw ioError("Cannot install WAL", path_);
+    } catch (...) {
+        // O log antigo continua intacto e em uso
+        ::close(fd);
+        ::unlink(tmp.c_str());
+        throw;
+    }
+
+    ::close(fd_);
+    fd_ = fd;
+    base_ = base;
+    std::lock_guard<std::mutex> lock(mutex_);
+    durable_ = std::max(durable_, written);     // a cópia passou por fsync
+    return dropped;
+}
+
+void Wal::checkFailedLocked() const {
+    if (!failure_.empty()) throw std::runtime_error(failure_ + " (WAL is unusable until reopened)");
+}
+
+void Wal::flush(Lsn lsn) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (durable_ > lsn) return;
+    }
+    writeOut(lsn + 1, true);
+}
+
+void Wal::flushAll() {
+    writeOut(endLsn(), true);
+}
+
+Lsn Wal::endLsn() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return next_lsn_;
+}
+
+Lsn Wal::durableLsn() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return durable_;
+}
+
+// ============================================================================
+// LEITURA
+// ============================================================================
+
+WalReader::WalReader(const std::string& path, Lsn start)
+    : fd_(-1), base_(0), position_(std::max(start, WAL_START_LSN)), ended_(false) {
+    fd_ = ::open(path.c_str(), O_RDONLY);
+    // WAL inexistente é um log vazio
+    if (fd_ < 0) {
+        if (errno != ENOENT) throw ioError("Cannot open WAL", path);
+        ended_ = true;
+        return;
+    }
+    base_ = readBase(fd_);
+    position_ = std::max(position_, base_ + WAL_START_LSN);
+}
+
+WalReader::~WalReader() {
+    if (fd_ >= 0) ::close(fd_);
+}
+
+bool WalReader::nextBatch(WalBatch& batch, size_t max_bytes) {
+    batch.start = position_;
+    batch.offsets.clear();
+    if (ended_) return false;
+
+    max_bytes = std::max(max_bytes, MAX_RECORD_SIZE);
+    batch.data.resize(max_bytes);
+    size_t filled = 0;
+    while (filled < max_bytes) {
+        ssize_t n = ::pread(fd_, batch.data.data() + filled, max_bytes - filled,
+                            static_cast<off_t>(position_ - base_ + filled));
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            throw std::runtime_error(std::string("Cannot read WAL: ") + std::strerror(errno));
+        }
+        if (n == 0) break;
+        filled += static_cast<size_t>(n);
+    }
+
+    // Registro incompleto no fim do lote é relido no próximo; no fim do
+    // arquivo (ou com enquadramento inválido) é a cauda rasgada do log
+    size_t offset = 0;
+    batch.offsets.push_back(0);
+    while (offset + RECORD_HEADER_SIZE <= filled) {
+        const char* data = batch.data.data() + offset;
+        uint32_t length = get<uint32_t>(data + 4);
+        if (length < RECORD_HEADER_SIZE || length > MAX_RECORD_SIZE ||
+            get<uint64_t>(data + 8) != position_ + offset) {
+            ended_ = true;
+            break;
+        }
+        if (offset + length > filled) break;
+        offset += length;
+        batch.offsets.push_back(static_cast<uint32_t>(offset));
+    }
+    // Leitura curta: o arquivo acabou dentro deste lote
+    if (filled < max_bytes) ended_ = true;
+
+    position_ += offset;
+    if (batch.size() == 0) {
+        batch.offsets.clear();
+        ended_ = true;
+        return false;
+    }
+    return true;
+}
+
+bool decodeWalRecord(const char* data, uint32_t length, Lsn lsn, WalRecord& record) {
+    if (length < RECORD_HEADER_SIZE) return false;
+    if (crc32(data + 4, length - 4) != get<uint32_t>(data)) return false;
+
+    record.lsn = lsn;
+    record.type = static_cast<WalRecordType>(get<uint8_t>(data + 16));
+    const char* payload = data + RECORD_HEADER_SIZE;
+    size_t payload_size = length - RECORD_HEADER_SIZE;
+
+    switch (record.type) {
+        case WalRecordType::PAGE_WRITE:
+            if (payload_size < 8) return false;
+            record.page = get<uint32_t>(payload);
+            record.offset = get<uint16_t>(payload + 4);
+            record.length = get<uint16_t>(payload + 6);
+            record.bytes = payload + 8;
+            return payload_size == 8u + record.length &&
+                   record.offset + record.length <= PAGE_PAYLOAD_SIZE;
+        case WalRecordType::CHECKPOINT:
+            if (payload_size != 8) return false;
+            record.redo_lsn = get<uint64_t>(payload);
+            return true;
+        case WalRecordType::TABLE_CREATE:
+        case WalRecordType::ROW_INSERT:
+        case WalRecordType::ROW_DELETE:
+            record.length = static_cast<uint32_t>(payload_size);
+            record.bytes = payload;
+            return true;
+    }
+    return false;
+}
+
+} // namespace storage
+} // namespace miniql
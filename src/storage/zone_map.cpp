@@ -0,0 +1,108 @@
+#include "storage/zone_map.h"
+#include <algorithm>
+
+namespace miniql {
+namespace storage {
+
+namespace {
+
+void widen(ZoneSummary& zone, const Value& value) {
+    if (value.isNull()) {
+        zone.nulls++;
+        return;
+    }
+    if (zone.min.isNull() || value < zone.min) zone.min = value;
+    if (zone.max.isNull() || value > zone.max) zone.max = value;
+}
+
+// O intervalo [min, max] do bloco intersecta o limite?
+bool overlaps(const ZoneSummary& zone, const ColumnRange& range) {
+    if (zone.min.isNull()) return false;        // só NULLs: comparação nunca é verdadeira
+    if (!range.low.isNull()) {
+        int cmp = zone.max.compare(range.low);
+        if (cmp < 0 || (cmp == 0 && !range.low_inclusive)) return false;
+    }
+    if (!range.high.isNull()) {
+        int cmp = zone.min.compare(range.high);
+        if (cmp > 0 || (cmp == 0 && !range.high_inclusive)) return false;
+    }
+    return true;
+}
+
+} // namespace
+
+ZoneMap::ZoneMap(const catalog::TableSchema& schema) : slots_(schema.columns.size(), -1) {
+    for (size_t i = 0; i < schema.columns.size(); i++) {
+        if (!isNumericType(schema.columns[i].type)) continue;
+        slots_[i] = static_cast<int>(columns_.size());
+        columns_.push_back(i);
+    }
+    zones_.resize(columns_.size());
+}
+
+void ZoneMap::insert(RowId id, const Row& row) {
+    size_t block = id / ZONE_BLOCK_ROWS;
+    if (block >= live_rows_.size()) {
+        live_rows_.resize(block + 1, 0);
+        for (auto& zones : zones_) zones.resize(block + 1);
+    }
+
+    live_rows_[block]++;
+    for (size_t slot = 0; slot < columns_.size(); slot++) {
+        widen(zones_[slot][block], row[columns_[slot]]);
+    }
+}
+
+void ZoneMap::erase(RowId id, const Row& removed, const std::vector<Row>& rows, const std::vector<uint8_t>& live) {
+    size_t block = id / ZONE_BLOCK_ROWS;
+    if (block >= live_rows_.size()) return;
+
+    live_rows_[block]--;
+    for (size_t slot = 0; slot < columns_.size(); slot++) {
+        ZoneSummary& zone = zones_[slot][block];
+        const Value& value = removed[columns_[slot]];
+        if (value.isNull()) {
+            zone.nulls--;
+        } else if (value == zone.min || value == zone.max) {
+            recompute(slot, block, rows, live);
+        }
+    }
+}
+
+void ZoneMap::clear() {
+    live_rows_.clear();
+    for (auto& zones : zones_) zones.clear();
+}
+
+bool ZoneMap::mayMatch(size_t block, const std::vector<ColumnRange>& ranges) const {
+    if (block >= live_rows_.size() || live_rows_[block] == 0) return false;
+    for (const ColumnRange& range : ranges) {
+        if (!tracks(range.column)) continue;
+        if (!overlaps(zones_[slots_[range.column]][block], range)) return false;
+    }
+    return true;
+}
+
+const ZoneSummary* ZoneMap::summary(size_t block, size_t column) const {
+    if (!tracks(column) || block >= live_rows_.size()) return nullptr;
+    return &zones_[slots_[column]][block];
+}
+
+size_t ZoneMap::memoryBytes() const {
+    size_t bytes = live_rows_.capacity() * sizeof(uint32_t);
+    for (const auto& zones : zones_) bytes += zones.capacity() * sizeof(ZoneSummary);
+    return bytes;
+}
+
+void ZoneMap::recompute(size_t slot, size_t block, const std::vector<Row>& rows, const std::vector<uint8_t>& live) {
+    ZoneSummary zone;
+    size_t column = columns_[slot];
+    size_t end = std::min(rows.size(), (block + 1) * ZONE_BLOCK_ROWS);
+    for (size_t id = block * ZONE_BLOCK_ROWS; id < end; id++) {
+        if (live[id]) widen(zone, rows[id][column]);
+    }
+    zones_[slot][block] = zone;
+}
+
+} // namespace storage
+} // namespace miniql